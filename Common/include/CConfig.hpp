@@ -524,6 +524,7 @@ private:
   Kind_Graph_Part_Algo,    /*!< \brief Algorithm for parallel partitioning of the matrix graph. */
   Kind_Linear_Solver,                    /*!< \brief Numerical solver for the implicit scheme. */
   Kind_Linear_Solver_Prec,               /*!< \brief Preconditioner of the linear solver. */
+  Kind_Linear_Solver_AMG_Smoother,       /*!< \brief Smoother of the AMG preconditioner. */
   Kind_DiscAdj_Linear_Solver,            /*!< \brief Linear solver for the discrete adjoint system. */
   Kind_DiscAdj_Linear_Prec,              /*!< \brief Preconditioner of the discrete adjoint linear solver. */
   Kind_TimeNumScheme,           /*!< \brief Global explicit or implicit time integration. */
@@ -572,6 +573,7 @@ private:
   BGS_RELAXATION Kind_BGS_RelaxMethod; /*!< \brief Kind of relaxation method for Block Gauss Seidel method in FSI problems. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
+  bool StoreLSGradientWeights;  /*!< \brief Precompute the geometric weights of least-squares gradients. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
   UPWIND
@@ -591,6 +593,7 @@ private:
   MUSCL_AdjFlow,           /*!< \brief MUSCL scheme for the adj flow equations.*/
   MUSCL_AdjTurb;           /*!< \brief MUSCL scheme for the adj turbulence equations.*/
   bool MUSCL_Species;      /*!< \brief MUSCL scheme for the species equations.*/
+  bool FusedGradientLimiter; /*!< \brief Compute the flow limiters together with the Green-Gauss reconstruction gradients. */
   bool Use_Accurate_Jacobians;  /*!< \brief Use numerically computed Jacobians for AUSM+up(2) and SLAU(2). */
   bool Use_Accurate_Turb_Jacobians; /*!< \brief Use numerically computed Jacobians for standard SA turbulence model. */
   bool EulerPersson;       /*!< \brief Boolean to determine whether this is an Euler simulation with Persson shock capturing. */
@@ -633,8 +636,20 @@ private:
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  LINEAR_SOLVER_ORTHOGONALIZATION Linear_Solver_Orthogonalization; /*!< \brief Orthogonalization method of FGMRES. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Number of vectors recycled by GCRO_DR. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_Prec_Level_Scheduling;     /*!< \brief Use level scheduling in thread-parallel ILU and LU_SGS preconditioners. */
+  unsigned short Linear_Solver_Schwarz_Overlap;  /*!< \brief Layers of overlap between ranks for ILU and LU_SGS (restricted additive Schwarz). */
+  bool Linear_Solver_Float_Storage_Flow;        /*!< \brief Single precision storage of the flow Jacobian and preconditioner. */
+  bool Linear_Solver_Float_Storage_Turb;        /*!< \brief Single precision storage of the turbulence Jacobian and preconditioner. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Max. number of levels of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
+  bool Linear_Solver_AMG_Smooth_Prolongation;    /*!< \brief Use smoothed (instead of plain) aggregation in AMG. */
+  unsigned short Linear_Solver_Chebyshev_Degree; /*!< \brief Degree of the Chebyshev polynomial preconditioner. */
+  long Linear_System_Dump_Iter;                  /*!< \brief Inner iteration at which the linear systems are written to file (-1 disables). */
+  string Linear_System_Dump_Filename;            /*!< \brief Prefix of the linear system dump files. */
   unsigned short Cuda_Block_Size;                /*!< \brief  User-specified value for the X-Axis dimension of thread blocks
                                                               that are deployed by the CUDA Kernels. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
@@ -1203,6 +1218,9 @@ private:
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
   bool edgeColoringRelaxDiscAdj;    /*!< \brief Allow fallback to smaller edge color group sizes and use more colors for the discrete adjoint. */
+  bool CommOverlap;                 /*!< \brief Overlap the halo exchange of gradients and limiters with computation. */
+  bool P2PPersistentRequests;       /*!< \brief Use persistent MPI requests for point-to-point comms. */
+  unsigned short P2PSharedMemoryCount; /*!< \brief Values per point exchanged through shared memory on the same node, 0 to disable. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -4163,6 +4181,12 @@ public:
    */
   bool GetLeastSquaresRequired(void) const { return LeastSquaresRequired; }
 
+  /*!
+   * \brief Get flag for whether the geometric weights of least-squares gradients are precomputed and stored.
+   * \return <code>TRUE</code> means that least-squares gradients are computed as weighted sums over neighbors.
+   */
+  bool GetStoreLSGradientWeights(void) const { return StoreLSGradientWeights; }
+
     /*!
    * \brief Get the type of algorithm used for partitioning the matrix graph.
    * \return Algorithm that divides the matrix into partitions that are executed parallely.
@@ -4218,12 +4242,65 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the smoother of the AMG preconditioner (ILU, LU_SGS, or JACOBI).
+   * \return Kind of smoother used on all levels of the AMG preconditioner.
+   */
+  unsigned short GetKind_Linear_Solver_AMG_Smoother(void) const { return Kind_Linear_Solver_AMG_Smoother; }
+
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner (including the finest).
+   * \return Maximum number of levels.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the threshold used to detect strong connections during AMG aggregation.
+   * \return Strength of connection threshold.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
+  /*!
+   * \brief Check if the AMG prolongation is smoothed with damped Jacobi.
+   * \return <code>TRUE</code> for smoothed aggregation, <code>FALSE</code> for plain aggregation.
+   */
+  bool GetLinear_Solver_AMG_Smooth_Prolongation(void) const { return Linear_Solver_AMG_Smooth_Prolongation; }
+
+  /*!
+   * \brief Get the degree of the Chebyshev polynomial preconditioner.
+   * \return Number of Jacobi preconditioned iterations (matrix-vector products plus one) per application.
+   */
+  unsigned short GetLinear_Solver_Chebyshev_Degree(void) const { return Linear_Solver_Chebyshev_Degree; }
+
+  /*!
+   * \brief Get the inner iteration at which the linear systems are written to file for offline replay.
+   * \return Inner iteration, negative if the systems are not written.
+   */
+  long GetLinear_System_Dump_Iter(void) const { return Linear_System_Dump_Iter; }
+
+  /*!
+   * \brief Get the prefix of the linear system dump files (completed with the block size and rank).
+   * \return File name prefix.
+   */
+  const string& GetLinear_System_Dump_Filename(void) const { return Linear_System_Dump_Filename; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the orthogonalization method of the (restarted) FGMRES linear solver.
+   */
+  LINEAR_SOLVER_ORTHOGONALIZATION GetLinear_Solver_Orthogonalization(void) const { return Linear_Solver_Orthogonalization; }
+
+  /*!
+   * \brief Get the number of vectors recycled by the GCRO_DR linear solver.
+   * \return Size of the recycled subspace.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4708,6 +4785,12 @@ public:
    */
   LIMITER GetKind_SlopeLimit_Flow(void) const { return Kind_SlopeLimit_Flow; }
 
+  /*!
+   * \brief Get flag for computing the flow limiters in the same pass as the Green-Gauss reconstruction gradients.
+   * \return <code>TRUE</code> means that gradients and limiters are computed and communicated together.
+   */
+  bool GetFusedGradientLimiter(void) const { return FusedGradientLimiter; }
+
   /*!
    * \brief Get the method for limiting the spatial gradients.
    * \return Method for limiting the spatial gradients solving the turbulent equation.
@@ -9726,6 +9809,28 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Check if the thread-parallel ILU and LU_SGS preconditioners use level scheduling.
+   * \return <code>TRUE</code> if the triangular solves are independent of the number of threads.
+   */
+  bool GetLinear_Solver_Prec_Level_Scheduling(void) const { return Linear_Solver_Prec_Level_Scheduling; }
+
+  /*!
+   * \brief Get the number of layers of overlap between MPI ranks for the ILU and LU_SGS preconditioners.
+   * \return 0 for block-Jacobi coupling between ranks, 1 or 2 for restricted additive Schwarz.
+   */
+  unsigned short GetLinear_Solver_Schwarz_Overlap(void) const { return Linear_Solver_Schwarz_Overlap; }
+
+  /*!
+   * \brief Get whether the flow Jacobian and its preconditioner are stored in single precision by the linear solver.
+   */
+  bool GetLinear_Solver_Float_Storage_Flow(void) const { return Linear_Solver_Float_Storage_Flow; }
+
+  /*!
+   * \brief Get whether the turbulence Jacobian and its preconditioner are stored in single precision by the linear solver.
+   */
+  bool GetLinear_Solver_Float_Storage_Turb(void) const { return Linear_Solver_Float_Storage_Turb; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
@@ -9736,6 +9841,23 @@ public:
    */
   bool GetEdgeColoringRelaxDiscAdj() const { return edgeColoringRelaxDiscAdj; }
 
+  /*!
+   * \brief Check if the halo exchange of gradients and limiters should be overlapped with their computation.
+   * \note The exchange of limiters is also overlapped with the vectorized edge loop of the flow solvers.
+   */
+  bool GetCommOverlap() const { return CommOverlap; }
+
+  /*!
+   * \brief Check if point-to-point comms should use persistent MPI requests.
+   */
+  bool GetP2PPersistentRequests() const { return P2PPersistentRequests; }
+
+  /*!
+   * \brief Get the maximum number of values per point that point-to-point comms exchange through
+   *        shared memory with neighbors on the same node (0 if the shared-memory transport is not used).
+   */
+  unsigned short GetP2PSharedMemoryCount() const { return P2PSharedMemoryCount; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
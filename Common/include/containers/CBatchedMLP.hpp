@@ -0,0 +1,130 @@
+/*!
+ * \file CBatchedMLP.hpp
+ * \brief Batched evaluation of multi-layer perceptrons stored in the MLPCpp file format.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "C2DContainer.hpp"
+#include "../linear_algebra/blas_structure.hpp"
+
+/*!
+ * \brief Evaluation of a collection of multi-layer perceptrons for batches of query points.
+ * \ingroup LookUpInterp
+ * \note The networks are read from the ".mlp" files of MLPCpp, whose look-up class evaluates one point at a time
+ *       (one matrix-vector product per layer). Here each layer is applied to all the points of a batch, and to the
+ *       derivatives with respect to the inputs, with one matrix-matrix product (CBlasStructure::gemm).
+ *       Networks with activation functions or normalizations that are not implemented are flagged as unsupported,
+ *       the callers should then keep using MLPCpp.
+ */
+class CBatchedMLP {
+ private:
+  enum class ACTIVATION { LINEAR, RELU, ELU, EXPONENTIAL, SIGMOID, SWISH, TANH };
+
+  /*! \brief Layers, weights, and normalization of one network. */
+  struct CNetwork {
+    std::vector<std::string> inputNames, outputNames;
+    std::vector<std::pair<su2double, su2double>> inputNorm, outputNorm; /*!< \brief Min and max values. */
+    std::vector<unsigned long> nNeurons;                                 /*!< \brief Neurons of each layer. */
+    std::vector<ACTIVATION> activation;         /*!< \brief Activation function of each layer. */
+    std::vector<su2activematrix> weights;       /*!< \brief Of layer l (> 0), nNeurons[l] x nNeurons[l-1]. */
+    std::vector<std::vector<su2double>> biases; /*!< \brief Of each layer. */
+    bool supported = true;
+  };
+
+  /*! \brief Networks used by an input-output map, and how their variables relate to those of the map. */
+  struct CMap {
+    unsigned short nInput = 0, nOutput = 0;
+    std::vector<unsigned long> iNetwork;                  /*!< \brief Networks that provide outputs. */
+    std::vector<std::vector<unsigned short>> inputIndex;  /*!< \brief Map input of each network input. */
+    std::vector<std::vector<std::pair<unsigned long, unsigned short>>> outputIndex; /*!< \brief Network output,
+                                                                                          map output. */
+    std::vector<unsigned short> missing; /*!< \brief Outputs that no network provides. */
+    bool supported = true;
+  };
+
+  std::vector<CNetwork> networks;
+  std::vector<CMap> maps;
+
+  CBlasStructure blas;
+  std::vector<su2double> work[2]; /*!< \brief Neuron values of two consecutive layers, one row per neuron. */
+  std::vector<unsigned short> outside; /*!< \brief Whether the query points are outside the training range. */
+
+  /*!
+   * \brief Read a network file.
+   */
+  static CNetwork ReadNetwork(const std::string& fileName);
+
+  /*!
+   * \brief Evaluate one network for a batch of points.
+   * \param[in] network - The network.
+   * \param[in] nPoint - Number of points.
+   * \param[in] nBlock - 1 (values), 1 + nInput (and first derivatives), or 1 + nInput + nInput^2 (and second).
+   * \returns Pointer to the outputs (normalized), one row per output with nBlock blocks of nPoint columns.
+   * \note The network inputs (normalized) and their derivatives are expected in work[0].
+   */
+  const su2double* Evaluate(const CNetwork& network, unsigned long nPoint, unsigned long nBlock);
+
+ public:
+  /*!
+   * \brief Constructor, reads the networks.
+   * \param[in] nNetworks - Number of networks.
+   * \param[in] fileNames - Names of the ".mlp" files.
+   */
+  CBatchedMLP(unsigned short nNetworks, const std::string* fileNames);
+
+  /*!
+   * \brief Define an input-output map, i.e. the networks that provide the outputs given the inputs.
+   * \param[in] inputNames - Names of the inputs.
+   * \param[in] outputNames - Names of the outputs.
+   * \returns Index of the map.
+   */
+  unsigned short PairVariables(const std::vector<std::string>& inputNames,
+                               const std::vector<std::string>& outputNames);
+
+  /*!
+   * \brief Whether all the networks used by a map are supported.
+   */
+  bool IsSupported(unsigned short iMap) const { return maps[iMap].supported; }
+
+  /*!
+   * \brief Evaluate the outputs of an input-output map for a batch of points.
+   * \param[in] iMap - Index of the input-output map.
+   * \param[in] nPoint - Number of points.
+   * \param[in] inputs - Inputs, one row per input of the map (at least nPoint columns).
+   * \param[out] outputs - Outputs, one row per output of the map (at least nPoint columns), those that no
+   *             network provides are set to zero.
+   * \param[out] extrapolation - Per point, 1 if any input is outside the training range of the networks, else 0.
+   * \param[out] dOutputs - Optional, derivatives of the outputs, row iOutput * nInput + iInput.
+   * \param[out] d2Outputs - Optional (requires dOutputs), second derivatives, row
+   *             (iOutput * nInput + iInput) * nInput + jInput.
+   * \returns Number of points outside the training range.
+   */
+  unsigned long Predict(unsigned short iMap, unsigned long nPoint, const su2activematrix& inputs,
+                        su2activematrix& outputs, unsigned long* extrapolation, su2activematrix* dOutputs = nullptr,
+                        su2activematrix* d2Outputs = nullptr);
+};
@@ -29,6 +29,7 @@
 
 #include <array>
 #include <iomanip>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -105,9 +106,24 @@ class CLookUpTable {
   su2vector<CTrapezoidalMap> trap_map_x_y;
 
   /*! \brief
-   * Vector of all the weight factors for the interpolation.
+   * Inverse interpolation matrices (weight factors) of all the triangles of each table level.
+   * Each row holds the 3x3 matrix of one triangle in row-major order.
    */
-  su2vector<su2vector<su2activematrix>> interp_mat_inv_x_y;
+  su2vector<su2activematrix> interp_mat_inv_x_y;
+
+  /*! \brief
+   * Neighbors of each triangle for each table level, the k-th entry is the triangle across the edge
+   * opposite to the k-th vertex of the triangle, or NO_TRIANGLE if that edge is on the hull.
+   */
+  su2vector<su2matrix<unsigned long>> triangle_neighbors;
+
+  /*! \brief
+   * Last inclusion triangle found on each table level, start of the walking search for the next query.
+   */
+  su2vector<unsigned long> last_triangle;
+
+  static constexpr unsigned long NO_TRIANGLE = std::numeric_limits<unsigned long>::max();
+  static constexpr unsigned short MAX_WALK_STEPS = 16; /*!< \brief Before falling back to the trapezoidal map. */
 
   /*! \brief
    * Returns true if the string is null or zero (ignores case).
@@ -143,6 +159,11 @@ class CLookUpTable {
    */
   void IdentifyUniqueEdges();
 
+  /*!
+   * \brief Find the neighbors of each triangle from the edge to triangle connectivity.
+   */
+  void IdentifyTriangleNeighbors();
+
   /*!
    * \brief Read the lookup table from file and store the data.
    * \param[in] file_name_lut - the filename of the lookup table.
@@ -159,19 +180,19 @@ class CLookUpTable {
    * \param[in] vec_CV1 - Pointer to first coordinate (progress variable).
    * \param[in] vec_CV2 - Pointer to second coordinate (enthalpy).
    * \param[in] point_ids - Single triangle data.
-   * \param[out] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[out] interp_mat_inv - Inverse matrix for interpolation (row-major).
    */
   void GetInterpMatInv(const su2double* vec_CV1, const su2double* vec_CV2, std::array<unsigned long, 3>& point_ids,
-                       su2activematrix& interp_mat_inv);
+                       su2double* interp_mat_inv);
 
   /*!
    * \brief Compute the interpolation coefficients for the triangular interpolation.
    * \param[in] val_CV1 - Value of first coordinate (progress variable).
    * \param[in] val_CV2 - Value of second coordinate (enthalpy).
-   * \param[in] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[in] interp_mat_inv - Inverse matrix for interpolation (row-major).
    * \param[out] interp_coeffs - Interpolation coefficients.
    */
-  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                        std::array<su2double, 3>& interp_coeffs) const;
 
   /*!
@@ -297,14 +318,31 @@ class CLookUpTable {
 
   /*!
    * \brief Find the triangle within which the query point (val_CV1, val_CV2) is located.
+   * \note Successive queries are usually close to each other, therefore the search starts by walking
+   *       from the last inclusion triangle, the trapezoidal map is only used if the walk fails.
    * \param[in] val_CV1 - First controlling variable value.
    * \param[in] val_CV2 - Second controlling variable value.
-   * \param[in] id_triangle - Reference to inclusion triangle index.
+   * \param[out] id_triangle - Reference to inclusion triangle index.
+   * \param[out] interp_coeffs - Interpolation coefficients of the query point in the inclusion triangle.
    * \param[in] iLevel - Table level index.
    * \returns if query point is within data set.
    */
   bool FindInclusionTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
-                             const unsigned long iLevel = 0);
+                             std::array<su2double, 3>& interp_coeffs, const unsigned long iLevel = 0);
+
+  /*!
+   * \brief Walk across triangle edges, from the last inclusion triangle towards the query point.
+   * \note The interpolation coefficients are the barycentric coordinates of the query point, the walk
+   *       crosses the edge opposite to the most negative one.
+   * \param[in] val_CV1 - First controlling variable value.
+   * \param[in] val_CV2 - Second controlling variable value.
+   * \param[out] id_triangle - Reference to inclusion triangle index.
+   * \param[out] interp_coeffs - Interpolation coefficients of the query point in the inclusion triangle.
+   * \param[in] iLevel - Table level index.
+   * \returns if the inclusion triangle was found.
+   */
+  bool WalkToTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
+                      std::array<su2double, 3>& interp_coeffs, const unsigned long iLevel) const;
 
   /*!
    * \brief Identify the nearest second nearest hull nodes w.r.t. the query point (val_CV1, val_CV2).
@@ -356,6 +394,23 @@ class CLookUpTable {
    */
   bool LookUp_XY(const std::vector<unsigned long>& idx_var, std::vector<su2double*>& val_vars, const su2double val_CV1,
                  su2double val_CV2, const unsigned long i_level = 0);
+  /*!
+   * \brief Lookup the values of the variables stored under idx_var for a batch of query points.
+   * \note The query points are located first, each search starting from the inclusion triangle of the previous
+   *       point, the variables are then interpolated one at a time for all points.
+   * \param[in] idx_var - Table data column indices corresponding to look-up variables.
+   * \param[in] n_points - Number of query points.
+   * \param[in] val_CV1 - Values of controlling variable 1 of the query points.
+   * \param[in] val_CV2 - Values of controlling variable 2 of the query points.
+   * \param[out] val_vars - Looked up values, one row per variable (at least n_points columns).
+   * \param[out] inside - Optional, whether each query is inside (true) or outside (false) the data set.
+   * \param[in] i_level - Table level index.
+   * \returns Number of queries outside the data set.
+   */
+  unsigned long LookUpBatch_XY(const std::vector<unsigned long>& idx_var, unsigned long n_points,
+                               const su2double* val_CV1, const su2double* val_CV2, su2activematrix& val_vars,
+                               bool* inside = nullptr, const unsigned long i_level = 0);
+
   /*!
    * \brief Lookup the value of the variable stored under idx_var using controlling variable values(val_CV1,val_CV2,
    * val_CV3). \param[in] val_name_var - String name of the variable to look up. \param[out] val_var - The stored value
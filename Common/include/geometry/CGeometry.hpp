@@ -51,6 +51,7 @@ extern "C" {
 #include <climits>
 #include <memory>
 #include <unordered_map>
+#include <tuple>
 
 #include "primal_grid/CPrimalGrid.hpp"
 #include "dual_grid/CDualGrid.hpp"
@@ -202,6 +203,12 @@ class CGeometry {
 
   ColMajorMatrix<uint8_t> CoarseGridColor_; /*!< \brief Coarse grid levels, colorized. */
 
+  /*--- Split of the domain points to overlap computation and point-to-point comms. ---*/
+
+  bool commOverlap{false}; /*!< \brief Whether point loops are split to overlap computation and comms. */
+  vector<unsigned long> pointsBeforeComms; /*!< \brief Boundary and send points, computed before comms start. */
+  vector<unsigned long> pointsDuringComms; /*!< \brief Remaining domain points, computed while comms are in flight. */
+
  public:
   /*!< \brief Linelets (mesh lines perpendicular to stretching direction). */
   struct CLineletInfo {
@@ -290,11 +297,38 @@ class CGeometry {
                                         in point-to-point comms. */
   su2double* bufD_P2PRecv{nullptr};  /*!< \brief Data structure for su2double point-to-point receive. */
   su2double* bufD_P2PSend{nullptr};  /*!< \brief Data structure for su2double point-to-point send. */
+  su2double* bufD_P2PSendLocal{nullptr}; /*!< \brief Private send buffer, bufD_P2PSend may point to the shared one. */
   unsigned short* bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short* bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*!< \brief Persistent requests of the point-to-point comms for one type of data, count per point, and direction. */
+  struct CP2PPersistentRequests {
+    vector<SU2_MPI::Request> send, recv;
+  };
+  bool persistentP2P{false}; /*!< \brief Whether point-to-point comms use persistent requests. */
+  mutable map<tuple<unsigned short, unsigned short, bool, unsigned short>, CP2PPersistentRequests>
+      persistentP2PRequests; /*!< \brief Persistent requests by type of data, count per point, direction, and half
+                                of the shared send buffer. */
+
+  /*!< \brief Location of a message in the shared send buffer of a neighbor on the same node. */
+  struct CSharedP2PRecv {
+    const su2double* buffer{nullptr}; /*!< \brief Shared send buffer of the neighbor, nullptr if not on this node. */
+    unsigned long offset{0};          /*!< \brief Offset of the message, in points. */
+    unsigned long halfSize{0};        /*!< \brief Size of each half of the buffer, in points. */
+  };
+  unsigned short sharedP2PCountPerPoint{0}; /*!< \brief Capacity of the shared send buffer, 0 if it is not used. */
+  unsigned short sharedP2PParity{0};        /*!< \brief Half of the shared send buffer used by the current comms. */
+  su2double* bufD_P2PSendShared{nullptr};   /*!< \brief Shared send buffer, made of two halves used alternately. */
+  vector<bool> sharedP2PSend;               /*!< \brief Whether each send is to a neighbor on the same node. */
+  vector<CSharedP2PRecv> sharedP2PRecv;     /*!< \brief Location of each recv in the buffer of its neighbor. */
+  vector<int> sharedP2PRecvIndex;           /*!< \brief Indices of the recvs from neighbors on the same node. */
+#ifdef HAVE_MPI
+  MPI_Comm sharedP2PComm{MPI_COMM_NULL}; /*!< \brief Communicator of the ranks on the same node. */
+  MPI_Win sharedP2PWin{MPI_WIN_NULL};    /*!< \brief Window of the shared send buffers. */
+#endif
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0}; /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -360,6 +394,31 @@ class CGeometry {
    */
   void PreprocessP2PComms(CGeometry* geometry, CConfig* config);
 
+  /*!
+   * \brief Split the domain points into those that must be computed before the point-to-point comms
+   *        start (points on markers and points that are sent) and those that can be computed while the
+   *        comms are in flight, if requested (COMM_OVERLAP).
+   * \note Called by PreprocessP2PComms, the split is not used when there are periodic markers. Only the point
+   *       loops of the gradient and limiter routines use it, edge loops are not split.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetCommOverlapPoints(const CConfig* config);
+
+  /*!
+   * \brief Check if point loops should be split to overlap computation and point-to-point comms.
+   */
+  inline bool GetCommOverlap() const { return commOverlap; }
+
+  /*!
+   * \brief Get the domain points that must be computed before the point-to-point comms start.
+   */
+  inline const vector<unsigned long>& GetPointsBeforeComms() const { return pointsBeforeComms; }
+
+  /*!
+   * \brief Get the domain points that can be computed while the point-to-point comms are in flight.
+   */
+  inline const vector<unsigned long>& GetPointsDuringComms() const { return pointsDuringComms; }
+
   /*!
    * \brief Routine to allocate buffers for point-to-point MPI communications. Also called to dynamically reallocate if
    * not enough memory is found for comms during runtime. \param[in] val_countPerPoint - Maximum count of the data type
@@ -392,6 +451,82 @@ class CGeometry {
   void PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType, unsigned short countPerPoint,
                     int val_iMessage, bool val_reverse) const;
 
+  /*!
+   * \brief Get the persistent requests of the point-to-point comms, they are created on first use.
+   * \note The requests refer to the current buffers, they are freed when the buffers are reallocated.
+   * \param[in] commType - Enumerated type for the data to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Send and recv requests, in the order of the messages.
+   */
+  const CP2PPersistentRequests& GetPersistentP2PRequests(unsigned short commType, unsigned short countPerPoint,
+                                                         bool reverse) const;
+
+  /*!
+   * \brief Free all the persistent requests of the point-to-point comms.
+   */
+  void FreePersistentP2PRequests();
+
+  /*!
+   * \brief Get the number of persistent requests of the point-to-point comms that were not freed yet.
+   */
+  inline size_t GetnPersistentP2PRequests() const {
+    size_t nRequests = 0;
+    for (const auto& entry : persistentP2PRequests) nRequests += entry.second.send.size() + entry.second.recv.size();
+    return nRequests;
+  }
+
+  /*!
+   * \brief Set up the shared send buffers used instead of messages for neighbors on the same node.
+   * \note Collective, called by PreprocessP2PComms. Only available in MPI builds without AD.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSharedP2PComms(const CConfig* config);
+
+  /*!
+   * \brief Free the shared send buffers of the point-to-point comms (collective).
+   */
+  void FreeSharedP2PComms();
+
+  /*!
+   * \brief Make the data packed in the shared send buffer visible to the neighbors before flagging them.
+   */
+  void SyncSharedP2PComms() const;
+
+  /*!
+   * \brief Wait for one of the recvs of the point-to-point comms, replaces MPI_Waitany in the completion loops.
+   * \note Must be called by one thread, once per recv. With the shared memory transport, the first call waits for
+   *       the flags of all the neighbors on the same node, followed by a single memory barrier (to see the data
+   *       they packed), and those recvs are returned first. The others are returned in the order they arrive.
+   * \param[in] iMessage - Number of recvs already completed by these comms.
+   * \param[in] commType - Enumerated type for the data to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[out] status - Status of the recv, as set by MPI_Waitany.
+   */
+  void WaitAnyP2PRecv(int iMessage, unsigned short commType, unsigned short countPerPoint, bool reverse,
+                      SU2_MPI::Status& status) const;
+
+  /*!
+   * \brief Whether the data of some comms is read from the shared send buffers of neighbors on the same node.
+   * \param[in] commType - Enumerated type for the data to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  inline bool SharedP2PComms(unsigned short commType, unsigned short countPerPoint, bool reverse) const {
+    return sharedP2PCountPerPoint > 0 && commType == COMM_TYPE_DOUBLE && !reverse &&
+           countPerPoint <= sharedP2PCountPerPoint;
+  }
+
+  /*!
+   * \brief Get the start of the data of a forward point-to-point recv of su2double's, in the recv
+   *        buffer or, for neighbors on the same node, directly in their shared send buffer.
+   * \note Only valid after the recv is complete, the data of point i starts at i*countPerPoint.
+   * \param[in] iRecv - Index of the message in the order they are stored.
+   * \param[in] countPerPoint - Number of variables per point.
+   */
+  const su2double* GetP2PRecvBuffer(int iRecv, unsigned short countPerPoint) const;
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -797,6 +932,14 @@ class CGeometry {
    */
   inline virtual void SetMaxLength(CConfig* config) {}
 
+  /*!
+   * \brief Compute and store the least-squares gradient weights of the neighbors of each point,
+   *        if requested (STORE_LS_GRADIENT_WEIGHTS) and used by the gradient methods.
+   * \note Must be called again when the coordinates change.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLeastSquaresWeights(const CConfig* config);
+
   /*!
    * \brief  Sets control volume.
    * \param[in] config - Definition of the particular problem.
@@ -110,6 +110,8 @@ class CPoint {
   su2activevector SharpEdge_Distance; /*!< \brief Distance to a sharp edge. */
   su2activevector Curvature;          /*!< \brief Value of the surface curvature (SU2_GEO). */
   su2activevector MaxLength;          /*!< \brief The maximum cell-center to cell-center length. */
+  su2activematrix LeastSquaresWeights[2]; /*!< \brief Unweighted and inverse-distance weighted least-squares gradient
+                                             weights of each neighbor (same sparse structure as Point). */
   su2activevector RoughnessHeight;    /*!< \brief Roughness of the nearest wall. */
 
   su2matrix<AD::Identifier>
@@ -492,6 +494,11 @@ class CPoint {
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the distance to the nearest wall of all points.
+   */
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -506,6 +513,11 @@ class CPoint {
    */
   inline su2double GetRoughnessHeight(unsigned long iPoint) const { return RoughnessHeight(iPoint); }
 
+  /*!
+   * \brief Get the roughness height of the nearest wall of all points.
+   */
+  inline const su2activevector& GetRoughnessHeight() const { return RoughnessHeight; }
+
   /*!
    * \brief Set the value of the distance to a sharp edge.
    * \param[in] iPoint - Index of the point.
@@ -549,6 +561,15 @@ class CPoint {
    */
   inline su2double GetMaxLength(unsigned long iPoint) const { return MaxLength(iPoint); }
 
+  /*!
+   * \brief Get the least-squares gradient weights of all the neighbors of all the points.
+   * \note The rows follow the sparse structure of Point, the matrix is empty if the weights are not stored.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   * \return Matrix of weights, with nDim columns.
+   */
+  inline su2activematrix& GetLeastSquaresWeights(bool weighted) { return LeastSquaresWeights[weighted]; }
+  inline const su2activematrix& GetLeastSquaresWeights(bool weighted) const { return LeastSquaresWeights[weighted]; }
+
   /*!
    * \brief Get area or volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -557,6 +578,11 @@ class CPoint {
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
 
+  /*!
+   * \brief Get the volumes of all control volumes.
+   */
+  inline const su2activevector& GetVolume() const { return Volume; }
+
   /*!
    * \brief Set the volume of the control volume.
    * \param[in] iPoint - Index of the point.
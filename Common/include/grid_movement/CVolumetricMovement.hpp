@@ -57,6 +57,24 @@ class CVolumetricMovement : public CGridMovement {
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  enum : size_t { OMP_MIN_SIZE = 32 }; /*!< \brief Chunk size for small loops. */
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > ElemColoring; /*!< \brief Element colors. */
+  bool LockStrategy = false;         /*!< \brief Whether to use OpenMP locks to guard updates of the matrix. */
+  vector<omp_lock_t> UpdateLocks;    /*!< \brief Locks to protect accesses to CSysMatrix in element loops. */
+#else
+  array<DummyGridColor<>, 1> ElemColoring;    /*--- Behaves like a normal integer type. ---*/
+  static constexpr bool LockStrategy = false; /*--- Lock strategy is never needed for MPI-only. ---*/
+  DummyVectorOfLocks UpdateLocks;
+#endif
+
+  /*!
+   * \brief Set up the element coloring used to parallelize the stiffness assembly with OpenMP.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void HybridParallelInitialization(CGeometry* geometry);
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -0,0 +1,353 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Hierarchy of coarse operators for the block smoothed-aggregation AMG preconditioner.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../option_structure.hpp"
+#include "CSysVector.hpp"
+
+#include <vector>
+
+using namespace std;
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Coarse levels of a smoothed-aggregation algebraic multigrid method for block sparse matrices.
+ * \note The finest level is the CSysMatrix that owns this object, it is smoothed by that matrix, i.e. with
+ *       all the OpenMP machinery of its preconditioners. With several ranks the hierarchy is distributed: each
+ *       rank aggregates its rows, but points may join aggregates of other ranks, the prolongation is smoothed
+ *       with the couplings to halos, and the Galerkin operators keep the couplings between ranks. The halos
+ *       of the finest level are those of the point-to-point comms of the geometry (see CSysMatrixComms), the
+ *       halos of a coarse level are the aggregates of other ranks coupled to local ones, their comms are
+ *       derived from those of the finer level. The coarse levels are smoothed and transferred by all threads,
+ *       the triangular sweeps of ILU and LU_SGS follow level sets and only couple the rows of one rank. One
+ *       aggregate has one unknown per variable of the blocks (the near null space of a system of PDEs is
+ *       approximated by piecewise constants for each variable).
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  enum : size_t { MAXNVAR = 20 };                /*!< \brief Maximum block size, same as CSysMatrix. */
+  enum : unsigned long { COARSEST_SIZE = 64 };   /*!< \brief Stop coarsening below this number of blocks. */
+  enum : unsigned long { MAX_DENSE_SIZE = 1024 }; /*!< \brief Max. unknowns solved directly on the coarsest level. */
+  enum : unsigned long { COARSE_SMOOTHING_ITER = 4 }; /*!< \brief Smoothing iterations if not solved directly. */
+  enum : unsigned long { OMP_MAX_SIZE = 512 };        /*!< \brief Max. chunk size of the parallel loops. */
+  enum : unsigned long { OMP_MIN_SIZE = 32 };         /*!< \brief Levels narrower than this per thread are serial. */
+
+  /*!
+   * \brief Non-owning view of a block-compressed-row-storage matrix.
+   * \note Column indices larger or equal to nCol are ignored. In the operators of the levels the columns
+   *       in [nRow, nCol) are halos, i.e. rows of other ranks.
+   */
+  struct CBlockCSRView {
+    unsigned long nRow = 0;
+    unsigned long nCol = 0;
+    const unsigned long* rowPtr = nullptr;
+    const unsigned long* colInd = nullptr;
+    const unsigned long* diaPtr = nullptr;
+    const ScalarType* values = nullptr;
+  };
+
+  /*!
+   * \brief Block-compressed-row-storage matrix with sorted column indices.
+   */
+  struct CBlockCSR {
+    unsigned long nRow = 0;
+    unsigned long nCol = 0;
+    vector<unsigned long> rowPtr, colInd, diaPtr;
+    vector<ScalarType> values;
+
+    CBlockCSRView View() const {
+      CBlockCSRView view;
+      view.nRow = nRow;
+      view.nCol = nCol;
+      view.rowPtr = rowPtr.data();
+      view.colInd = colInd.data();
+      view.diaPtr = diaPtr.empty() ? nullptr : diaPtr.data();
+      view.values = values.data();
+      return view;
+    }
+  };
+
+  /*!
+   * \brief Level sets of the lower or upper triangular part of a matrix (see CLevelScheduling).
+   */
+  struct CLevelSets {
+    vector<unsigned long> rows;    /*!< \brief Rows sorted by level. */
+    vector<unsigned long> offsets; /*!< \brief Start of each level in "rows". */
+    vector<unsigned long> chains;  /*!< \brief Start of each chain of consecutive narrow levels. */
+    unsigned long minWidth = 0;    /*!< \brief Levels at least this wide are shared by all threads. */
+  };
+
+  /*!
+   * \brief Point-to-point comms of the halos of a level, same layout as those of CGeometry.
+   */
+  struct CHaloComms {
+    using Request = typename SelectMPIWrapper<ScalarType>::W::Request;
+
+    vector<int> sendRank, recvRank;         /*!< \brief Ranks of the neighbors. */
+    vector<unsigned long> sendPtr, recvPtr; /*!< \brief Start of the rows of each neighbor in the lists. */
+    vector<unsigned long> sendInd, recvInd; /*!< \brief Rows sent to each neighbor, halos received from each. */
+    mutable vector<ScalarType> sendBuf, recvBuf;
+    mutable vector<Request> requests;
+
+    bool empty() const { return sendRank.empty() && recvRank.empty(); }
+  };
+
+  /*!
+   * \brief Data of one level of the hierarchy.
+   */
+  struct CLevel {
+    CBlockCSR A;                        /*!< \brief Galerkin operator (not used on the finest level). */
+    CHaloComms comms;                   /*!< \brief Comms of the halo columns of A. */
+    vector<unsigned long> haloGlobal;   /*!< \brief Global index of the halo columns of A. */
+    CBlockCSR P;                        /*!< \brief Prolongation from the next (coarser) level. */
+    CBlockCSR R;                        /*!< \brief Restriction to the next level (halo rows included). */
+    vector<ScalarType> factors;         /*!< \brief ILU(0) factors of A, same pattern as A. */
+    vector<ScalarType> invDiag;         /*!< \brief Inverse of the diagonal blocks of A, or of U for ILU. */
+    CLevelSets lower, upper;            /*!< \brief Level sets of the forward and backward sweeps of A. */
+    unsigned long ompChunk = 1;         /*!< \brief Chunk size of the parallel loops over the rows of A. */
+    mutable vector<ScalarType> x, b, r; /*!< \brief Solution, right hand side, and residual (with halos). */
+    mutable vector<ScalarType> dx;      /*!< \brief Update of the smoothing iterations of the coarsest level. */
+  };
+
+  unsigned long nVar = 0;                      /*!< \brief Size of the blocks. */
+  unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Chunk size of the fine level transfer loops. */
+  CBlockCSRView fine;                          /*!< \brief The finest level matrix (owned by CSysMatrix). */
+  vector<CLevel> levels;                       /*!< \brief The hierarchy, level 0 only has transfer operators. */
+
+  ENUM_LINEAR_SOLVER_PREC kindSmoother = ILU; /*!< \brief Smoother of the coarse levels. */
+  unsigned short maxLevels = 0;               /*!< \brief Maximum number of levels, including the finest. */
+  passivedouble strength = 0.0;               /*!< \brief Threshold for strong connections. */
+  bool smoothProlongation = true;             /*!< \brief Apply one step of damped Jacobi to the tentative P. */
+
+  vector<ScalarType> denseLU;        /*!< \brief LU factors of the (global) coarsest operator. */
+  vector<unsigned long> densePivots; /*!< \brief Row permutation of the LU factorization. */
+  vector<int> denseCounts;           /*!< \brief Number of unknowns of the coarsest level on each rank. */
+  vector<int> denseDispls;           /*!< \brief Offset of the unknowns of each rank in the global system. */
+  mutable vector<ScalarType> denseRhs; /*!< \brief Global right hand side and solution of the direct solve. */
+
+  /*!
+   * \brief Compute the aggregates (groups of strongly connected points) of a level.
+   * \note Collective, points may join aggregates of other ranks that contain a halo they are coupled to.
+   * \param[in] A - Operator of the level.
+   * \param[in] comms - Comms of the halos of A.
+   * \param[out] aggregate - Global index of the aggregate of each point and halo (if it is known).
+   * \param[out] offsets - Global index of the first aggregate of each rank (and total number at the end).
+   * \return Number of aggregates of this rank.
+   */
+  unsigned long Aggregate(const CBlockCSRView& A, const CHaloComms& comms, vector<unsigned long>& aggregate,
+                          vector<unsigned long>& offsets) const;
+
+  /*!
+   * \brief Build the transfer operators of a level, and the Galerkin operator and halo comms of the next one.
+   * \note Collective, the rows of the Galerkin product for aggregates of other ranks are sent to their owners.
+   * \param[in] A - Operator of the level.
+   * \param[in] aggregate - Global index of the aggregate of each point and halo.
+   * \param[in] nAggregate - Number of aggregates of this rank.
+   * \param[in] offsets - Global index of the first aggregate of each rank.
+   * \param[in,out] level - The level, its comms must be set.
+   * \param[out] coarse - The next level.
+   */
+  void Coarsen(const CBlockCSRView& A, const vector<unsigned long>& aggregate, unsigned long nAggregate,
+               const vector<unsigned long>& offsets, CLevel& level, CLevel& coarse) const;
+
+  /*!
+   * \brief Build the (smoothed) prolongation operator from the aggregates of a level.
+   * \param[in] A - Operator of the level.
+   * \param[in] comms - Comms of the halos of A.
+   * \param[in] aggregate - Aggregate of each point and halo (column of P).
+   * \param[in] nCol - Number of columns of P.
+   * \param[out] P - Prolongation operator.
+   */
+  void Prolongation(const CBlockCSRView& A, const CHaloComms& comms, const vector<unsigned long>& aggregate,
+                    unsigned long nCol, CBlockCSR& P) const;
+
+  /*!
+   * \brief Estimate the spectral radius of D^{-1} A by power iterations (collective).
+   * \param[in] A - Operator of the level.
+   * \param[in] comms - Comms of the halos of A.
+   * \param[in] invDiag - Inverse of the diagonal blocks of A.
+   */
+  passivedouble SpectralRadius(const CBlockCSRView& A, const CHaloComms& comms,
+                               const vector<ScalarType>& invDiag) const;
+
+  /*!
+   * \brief Copy the rows of a vector to the halos of the neighbors (forward), or add the halos to the rows
+   *        of their owners (reverse).
+   * \note Called by one thread.
+   */
+  void HaloExchange(const CHaloComms& comms, ScalarType* x, bool reverse) const;
+
+  /*!
+   * \brief HaloExchange by the master thread, followed by a barrier.
+   * \note Must be called by all threads, the writes to x must be complete (e.g. after an OpenMP for).
+   */
+  inline void SyncHalos(const CHaloComms& comms, ScalarType* x, bool reverse) const {
+    if (comms.empty()) return;
+    SU2_OMP_MASTER
+    HaloExchange(comms, x, reverse);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*!
+   * \brief Sparse matrix-matrix product, Z = X * Y.
+   */
+  void Multiply(const CBlockCSRView& X, const CBlockCSRView& Y, CBlockCSR& Z) const;
+
+  /*!
+   * \brief Block transpose, XT(j,i) = X(i,j)^T.
+   */
+  void Transpose(const CBlockCSR& X, CBlockCSR& XT) const;
+
+  /*!
+   * \brief Compute the level sets and chunk size of a level, and allocate its working memory.
+   * \param[in] level - Level of the hierarchy, its operator A must be set.
+   * \param[in] coarsest - Whether it is the coarsest level.
+   */
+  void SetUpLevel(CLevel& level, bool coarsest) const;
+
+  /*!
+   * \brief Compute the inverse of the diagonal blocks of A (all smoothers), and the ILU(0) factors if needed.
+   * \note Must be called by all threads.
+   */
+  void BuildSmoother(CLevel& level) const;
+
+  /*!
+   * \brief Apply a row kernel to all the rows of a triangular sweep, in the order given by the level sets.
+   * \note Must be called by all threads, the rows of a level are divided among them.
+   */
+  template <class RowKernel>
+  void LevelScheduledSweep(const CLevelSets& levelSets, const RowKernel& rowKernel) const;
+
+  /*!
+   * \brief Factorize the coarsest operator, gathered from all ranks, if it is small enough (collective).
+   */
+  void BuildCoarsestSolver(const CLevel& level);
+
+  /*!
+   * \brief Apply the smoother to a vector, x = M^{-1} b.
+   * \note Must be called by all threads.
+   */
+  void Smooth(const CLevel& level, const ScalarType* b, ScalarType* x) const;
+
+  /*!
+   * \brief Compute the residual of a level, r = b - A x.
+   * \note Must be called by all threads.
+   */
+  void Residual(const CLevel& level) const;
+
+  /*!
+   * \brief Recursive V-cycle with zero initial guess, level.x = M_level^{-1} level.b.
+   * \note Must be called by all threads.
+   */
+  void VCycle(unsigned short iLevel) const;
+
+  /*!
+   * \brief Product of a block row of a matrix by a vector, y = X(i,:) * x.
+   */
+  inline void RowProduct(const CBlockCSRView& X, unsigned long iRow, const ScalarType* x, ScalarType* y) const {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) y[iVar] = 0.0;
+    for (auto idx = X.rowPtr[iRow]; idx < X.rowPtr[iRow + 1]; ++idx) {
+      const auto j = X.colInd[idx];
+      if (j >= X.nCol) continue;
+      BlockVectorAdd(&X.values[idx * nVar * nVar], &x[j * nVar], y);
+    }
+  }
+
+  /*!
+   * \brief y += A x, for one block.
+   */
+  inline void BlockVectorAdd(const ScalarType* A, const ScalarType* x, ScalarType* y) const {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      for (auto jVar = 0ul; jVar < nVar; ++jVar) y[iVar] += A[iVar * nVar + jVar] * x[jVar];
+  }
+
+  /*!
+   * \brief y = A x, for one block.
+   */
+  inline void BlockVectorProduct(const ScalarType* A, const ScalarType* x, ScalarType* y) const {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) y[iVar] = 0.0;
+    BlockVectorAdd(A, x, y);
+  }
+
+  /*!
+   * \brief C += alpha A B, for one block.
+   */
+  inline void BlockProductAdd(const ScalarType* A, const ScalarType* B, ScalarType* C, ScalarType alpha = 1.0) const {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      for (auto kVar = 0ul; kVar < nVar; ++kVar) {
+        const ScalarType aik = alpha * A[iVar * nVar + kVar];
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) C[iVar * nVar + jVar] += aik * B[kVar * nVar + jVar];
+      }
+  }
+
+  /*!
+   * \brief Invert one block by Gauss-Jordan elimination with partial pivoting.
+   */
+  void BlockInverse(const ScalarType* A, ScalarType* invA) const;
+
+ public:
+  /*!
+   * \brief Set the finest level matrix, the pointers must remain valid while the hierarchy is used.
+   * \param[in] nVar - Size of the blocks.
+   * \param[in] nPointDomain - Number of rows.
+   * \param[in] nPoint - Number of columns, those of halo points start at nPointDomain.
+   * \param[in] rowPtr - Pointers to the first element in each row.
+   * \param[in] colInd - Column indices (sorted in each row).
+   * \param[in] diaPtr - Pointers to the diagonal element in each row.
+   * \param[in] values - Entries of the matrix.
+   */
+  void SetMatrix(unsigned long nVar, unsigned long nPointDomain, unsigned long nPoint, const unsigned long* rowPtr,
+                 const unsigned long* colInd, const unsigned long* diaPtr, const ScalarType* values);
+
+  /*!
+   * \brief Build the hierarchy (aggregation, transfer operators, Galerkin operators, and smoothers).
+   * \note Must be called by all threads (and ranks), the aggregation and the Galerkin products are computed by
+   *       the master thread, the smoothers of the coarse levels by all threads.
+   * \param[in] geometry - Geometrical definition of the problem (point-to-point comms of the finest level).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Get the number of levels, including the finest.
+   */
+  inline unsigned short GetNumLevels() const { return levels.size(); }
+
+  /*!
+   * \brief Restrict a fine residual, apply one V-cycle on the coarse levels, and prolongate the result.
+   * \note Must be called by all threads, the halos of the correction are not updated (nor the residual used).
+   * \param[in] res - Fine level residual.
+   * \param[out] corr - Fine level correction.
+   */
+  void CoarseGridCorrection(const CSysVector<ScalarType>& res, CSysVector<ScalarType>& corr) const;
+};
@@ -81,15 +81,23 @@ class CLevelScheduling final : public CGraphPartitioning<ScalarType> {
     maxLevelWidth = 0ul;
   }
 
+  /*!
+   * \brief Constructor of the class for partitioning sparse patterns (see the CSR version of Partition).
+   * \param[in] nPointDomain_ref - number of points associated with the problem
+   */
+  explicit inline CLevelScheduling<ScalarType>(ScalarType nPointDomain_ref)
+      : CLevelScheduling<ScalarType>(nPointDomain_ref, nullptr) {}
+
   CLevelScheduling() = delete;  // Removing default constructor
 
   /*!
    * \brief Divides the levels into groups of chains depending on the preset GPU block and warp size.
+   * \note On the CPU, "rowsPerBlock" is the minimum level width worth sharing between threads.
    * \param[in] levelOffsets - Represents the vector array containing the ordered list of starting rows of each level.
    * \param[in] chainPtr - Represents the vector array containing the ordered list of starting levels of each chain.
    * \param[in] rowsPerBlock - Represents the maximum number of rows that can be accomodated per CUDA block.
    */
-  void CalculateChain(vector<ScalarType> levelOffsets, vector<ScalarType>& chainPtr, unsigned short rowsPerBlock) {
+  void CalculateChain(vector<ScalarType> levelOffsets, vector<ScalarType>& chainPtr, ScalarType rowsPerBlock) {
     ScalarType levelWidth = 0;
 
     /*This is not a magic number. We are simply initializing
@@ -179,4 +187,64 @@ class CLevelScheduling final : public CGraphPartitioning<ScalarType> {
 
     CalculateChain(levelOffsets, chainPtr, rowsPerBlock);
   }
+
+  /*!
+   * \brief Computes the level sets of the lower (or upper) triangular part of a sparse pattern, without
+   *        reordering the points. Rows of the same level do not depend on each other during a forward (or
+   *        backward) substitution, which allows thread-parallel triangular solves that remain exact.
+   * \note Only the first nPointDomain rows and columns are considered (i.e. halos are ignored).
+   * \param[in] rowPtr - Pointer to the first element of each row of the pattern.
+   * \param[in] diaPtr - Pointer to the diagonal element of each row of the pattern.
+   * \param[in] colInd - Column indices of the pattern, sorted in each row.
+   * \param[in] upper - Compute the levels of the upper triangular part (backward substitution).
+   * \param[out] levelRows - Rows sorted by level, in order of execution.
+   * \param[out] levelOffsets - Start of each level in levelRows.
+   * \param[out] chainPtr - Start of each chain of levels, consecutive narrow levels are grouped in one chain.
+   * \param[in] rowsPerChain - Levels wider than this are not grouped with others.
+   */
+  void Partition(const ScalarType* rowPtr, const ScalarType* diaPtr, const ScalarType* colInd, bool upper,
+                 vector<ScalarType>& levelRows, vector<ScalarType>& levelOffsets, vector<ScalarType>& chainPtr,
+                 ScalarType rowsPerChain) {
+    levels.assign(nPointDomain, 0);
+    nLevels = 0;
+
+    /*--- The level of a row is one more than the highest level it depends on. ---*/
+
+    auto updateLevel = [&](ScalarType iPoint) {
+      const auto begin = upper ? diaPtr[iPoint] + 1 : rowPtr[iPoint];
+      const auto end = upper ? rowPtr[iPoint + 1] : diaPtr[iPoint];
+
+      for (auto index = begin; index < end; ++index) {
+        const auto jPoint = colInd[index];
+        if (jPoint < nPointDomain) levels[iPoint] = std::max(levels[iPoint], levels[jPoint] + 1);
+      }
+      nLevels = std::max(nLevels, levels[iPoint] + 1);
+    };
+
+    if (upper) {
+      for (auto iPoint = nPointDomain; iPoint > 0;) updateLevel(--iPoint);
+    } else {
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) updateLevel(iPoint);
+    }
+
+    /*--- Counting sort of the rows by level, the execution order is the
+     *    order of the levels, and within each level, the order of the rows. ---*/
+
+    levelOffsets.assign(nLevels + 1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      ++levelOffsets[levels[iPoint] + 1];
+    }
+    for (auto iLevel = 1ul; iLevel <= nLevels; ++iLevel) {
+      levelOffsets[iLevel] += levelOffsets[iLevel - 1];
+    }
+
+    levelRows.resize(nPointDomain);
+    auto position = levelOffsets;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      levelRows[position[levels[iPoint]]++] = iPoint;
+    }
+
+    chainPtr.clear();
+    CalculateChain(levelOffsets, chainPtr, rowsPerChain);
+  }
 };
@@ -0,0 +1,96 @@
+/*!
+ * \file CLinearSystemFile.hpp
+ * \brief Binary storage of distributed linear systems for offline replay (SU2_LINBENCH).
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \class CLinearSystemFile
+ * \ingroup SpLinSys
+ * \brief Rows of a block sparse linear system owned by one rank, its right hand side, and the settings of the
+ *        linear solver that was used for it. Written by CSysSolve and read by SU2_LINBENCH.
+ * \note After the header the file contains the global indices of the rows, the row pointer, the global indices
+ *       of the columns, the (row-major) blocks and the right hand side. Integers are 64-bit, values are doubles.
+ */
+class CLinearSystemFile {
+ public:
+  enum : uint32_t { VERSION = 1 };
+
+  /*!
+   * \brief Fixed size header, the members are ordered such that it has no padding.
+   */
+  struct Header {
+    char magic[8] = {'S', 'U', '2', 'L', 'S', 'Y', 'S', '\0'};
+    uint32_t version = VERSION;
+    int32_t rank = 0;              /*!< \brief Rank that wrote the file. */
+    int32_t size = 1;              /*!< \brief Number of ranks (files) that make up the system. */
+    int32_t kindSolver = 0;        /*!< \brief ENUM_LINEAR_SOLVER used when the system was written. */
+    int32_t kindPrec = 0;          /*!< \brief ENUM_LINEAR_SOLVER_PREC used when the system was written. */
+    uint32_t iluFill = 0;          /*!< \brief ILU fill-in level. */
+    uint32_t chebyshevDegree = 0;  /*!< \brief Degree of the Chebyshev preconditioner. */
+    uint32_t schwarzOverlap = 0;   /*!< \brief Overlap of the ILU and LU_SGS preconditioners. */
+    uint64_t nVar = 0;             /*!< \brief Rows of the blocks. */
+    uint64_t nEqn = 0;             /*!< \brief Columns of the blocks. */
+    uint64_t nPointDomain = 0;     /*!< \brief Block rows in this file. */
+    uint64_t nPointGlobal = 0;     /*!< \brief Block rows in all files. */
+    uint64_t nNonZero = 0;         /*!< \brief Non zero blocks in this file. */
+    uint64_t maxIter = 0;          /*!< \brief Maximum number of linear iterations. */
+    uint64_t restart = 0;          /*!< \brief Restart frequency of the Krylov solvers. */
+    double tolerance = 0;          /*!< \brief Relative tolerance of the linear solver. */
+  };
+
+  Header header;                   /*!< \brief Dimensions and settings. */
+  std::vector<uint64_t> globalRow; /*!< \brief Global index of each local row (the row partitioning). */
+  std::vector<uint64_t> rowPtr;    /*!< \brief Start of each row in globalCol. */
+  std::vector<uint64_t> globalCol; /*!< \brief Global index of the column of each non zero block. */
+  std::vector<double> values;      /*!< \brief Non zero blocks, nVar x nEqn each. */
+  std::vector<double> rhs;         /*!< \brief Right hand side, nVar per row. */
+
+  /*!
+   * \brief Name of the file of a rank.
+   * \param[in] prefix - Common part of the file names.
+   * \param[in] rank - Rank that writes (or wrote) the file.
+   */
+  static std::string FileName(const std::string& prefix, int rank) {
+    return prefix + "_" + std::to_string(rank) + ".dat";
+  }
+
+  /*!
+   * \brief Write the header and the arrays.
+   * \param[in] fileName - Name of the file.
+   */
+  void Write(const std::string& fileName) const;
+
+  /*!
+   * \brief Read the header, and optionally the arrays, from file.
+   * \param[in] fileName - Name of the file.
+   * \param[in] headerOnly - Skip the arrays.
+   */
+  void Read(const std::string& fileName, bool headerOnly = false);
+};
@@ -31,6 +31,7 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -76,6 +77,7 @@ struct mkl_jit_wrapper<float> {
 #endif
 
 class CGeometry;
+class CLinearSystemFile;
 
 /*!
  * \brief Helper to communicate distributed vectors.
@@ -132,11 +134,34 @@ class CSysMatrix {
   unsigned long omp_heavy_size;   /*!< \brief Actual chunk size used in heavy loops (e.g. over rows). */
   unsigned long omp_num_parts;    /*!< \brief Number of threads used in thread-parallel LU_SGS and ILU. */
   unsigned long* omp_partitions;  /*!< \brief Point indexes of LU_SGS and ILU thread-parallel sub partitioning. */
+  bool omp_level_sched;           /*!< \brief Use level scheduling instead of sub partitioning in LU_SGS and ILU. */
+
+  /*!
+   * \brief Level sets of the lower or upper triangular part of the preconditioner pattern (see CLevelScheduling).
+   */
+  struct CLevelSets {
+    vector<unsigned long> rows;    /*!< \brief Rows sorted by level. */
+    vector<unsigned long> offsets; /*!< \brief Start of each level in "rows". */
+    vector<unsigned long> chains;  /*!< \brief Start of each chain of consecutive narrow levels. */
+    unsigned long minWidth = 0;    /*!< \brief Levels at least this wide are shared by all threads. */
+  };
+  CLevelSets lowerLevels; /*!< \brief Level sets for forward substitutions. */
+  CLevelSets upperLevels; /*!< \brief Level sets for backward substitutions. */
+
+  /*--- Restricted additive Schwarz, the ILU and LU_SGS preconditioners are applied on the subdomain
+   * extended with (part of) the halo layer, whose rows are otherwise not used by the matrix. ---*/
+  unsigned short schwarzOverlap;         /*!< \brief Layers of overlap between ranks, 0 is block-Jacobi. */
+  unsigned long nPointPrec;              /*!< \brief Rows of the ILU and LU_SGS subdomain (nPointDomain or nPoint). */
+  vector<unsigned long> schwarzExcluded; /*!< \brief Halo points outside of the overlap, decoupled by identity rows. */
+  CSysVector<ScalarType> schwarzDiag;    /*!< \brief Diagonal blocks of the halo rows, received from their owners. */
+  mutable CSysVector<ScalarType> schwarzVec; /*!< \brief Right hand side extended to the overlapping subdomain. */
 
   unsigned long nPoint;       /*!< \brief Number of points in the grid. */
   unsigned long nPointDomain; /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;         /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;         /*!< \brief Number of equations (and columns of the blocks). */
+  unsigned long fixedBlockSize; /*!< \brief Size of the square blocks for which compile-time specialized kernels
+                                     are used, 0 selects the generic ones (see CSysMatrix.inl). */
 
   ScalarType* matrix;           /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;            /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -162,13 +187,27 @@ class CSysMatrix {
 
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
-  /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> >
-      LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> >
-      LineletInvDiag; /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> >
-      LineletVector; /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  /*--- Single precision storage of the values used by the linear solvers (the Krylov vectors keep ScalarType).
+   * When ScalarType is not double (mixed precision or forward AD builds) the option has no effect. ---*/
+  using FloatType = su2conditional_t<std::is_same<ScalarType, passivedouble>::value, float, ScalarType>;
+  bool floatStorage;             /*!< \brief Use the single precision copies below in products and preconditioners. */
+  mutable bool floatStale;       /*!< \brief The matrix changed since matrix_flt was last updated. */
+  FloatType* matrix_flt;         /*!< \brief Entries of the sparse matrix rounded to single precision. */
+  FloatType* ILU_matrix_flt;     /*!< \brief Replaces ILU_matrix with single precision storage. */
+  FloatType* invM_flt;           /*!< \brief Replaces invM with single precision storage. */
+
+  /*--- The linelets are solved in batches, one linelet per SIMD lane, the tri-diag systems of a batch are
+   *    stored interleaved (as SIMD arrays) in temporary (hence mutable) working memory, outer vector is for threads. ---*/
+  using LineletSIMD = simd::Array<ScalarType>;
+  vector<unsigned long> LineletOrder; /*!< \brief Linelets sorted by decreasing length, consecutive groups form batches. */
+  mutable vector<vector<LineletSIMD> >
+      LineletUpper; /*!< \brief Upper blocks of the tri-diag systems of a batch (working memory). */
+  mutable vector<vector<LineletSIMD> >
+      LineletInvDiag; /*!< \brief Inverse of the diagonal blocks of the tri-diag systems (working memory). */
+  mutable vector<vector<LineletSIMD> >
+      LineletVector; /*!< \brief Solution and RHS of the tri-diag systems (working memory). */
+  mutable vector<vector<LineletSIMD> >
+      LineletTemp; /*!< \brief Small temporary blocks and vector of the tri-diag solver (working memory). */
 
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
@@ -187,6 +226,16 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Coarse levels of the AMG preconditioner. */
+  mutable CSysVector<ScalarType> amg_residual;   /*!< \brief Fine level residual of the AMG cycle. */
+  mutable CSysVector<ScalarType> amg_correction; /*!< \brief Fine level correction of the AMG cycle. */
+
+  enum : unsigned short { CHEB_LANCZOS_STEPS = 10 }; /*!< \brief Steps to estimate the spectrum for Chebyshev. */
+  enum : unsigned short { CHEB_MAX_EIG_RATIO = 30 }; /*!< \brief Max. ratio of the Chebyshev spectrum bounds. */
+  unsigned short cheb_degree;                 /*!< \brief Degree of the Chebyshev preconditioner. */
+  ScalarType cheb_lower, cheb_upper;          /*!< \brief Bounds of the spectrum of the Jacobi preconditioned matrix. */
+  mutable CSysVector<ScalarType> cheb_vec[5]; /*!< \brief Working vectors of the Chebyshev preconditioner. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -253,6 +302,18 @@ class CSysMatrix {
    */
   void MatrixMatrixProduct(const ScalarType* matrix_a, const ScalarType* matrix_b, ScalarType* product) const;
 
+  /*!
+   * \brief Overloads of the block products for blocks stored with another type (see FloatType).
+   */
+  template <class OtherType>
+  void MatrixVectorProduct(const OtherType* matrix, const ScalarType* vector, ScalarType* product) const;
+  template <class OtherType>
+  void MatrixVectorProductAdd(const OtherType* matrix, const ScalarType* vector, ScalarType* product) const;
+  template <class OtherType>
+  void MatrixVectorProductSub(const OtherType* matrix, const ScalarType* vector, ScalarType* product) const;
+  template <class OtherType>
+  void MatrixMatrixProduct(const OtherType* matrix_a, const OtherType* matrix_b, OtherType* product) const;
+
   /*!
    * \brief Subtract b from a and store the result in c.
    */
@@ -263,7 +324,8 @@ class CSysMatrix {
   /*!
    * \brief Subtract b from a and store the result in c.
    */
-  FORCEINLINE void MatrixSubtraction(const ScalarType* a, const ScalarType* b, ScalarType* c) const {
+  template <class T>
+  FORCEINLINE void MatrixSubtraction(const T* a, const T* b, T* c) const {
     SU2_OMP_SIMD
     for (unsigned long iVar = 0; iVar < nVar * nEqn; iVar++) c[iVar] = a[iVar] - b[iVar];
   }
@@ -271,7 +333,8 @@ class CSysMatrix {
   /*!
    * \brief Copy matrix src into dst, transpose if required.
    */
-  FORCEINLINE void MatrixCopy(const ScalarType* src, ScalarType* dst) const {
+  template <class SrcType, class DstType>
+  FORCEINLINE void MatrixCopy(const SrcType* src, DstType* dst) const {
     SU2_OMP_SIMD
     for (auto iVar = 0ul; iVar < nVar * nEqn; ++iVar) dst[iVar] = src[iVar];
   }
@@ -292,11 +355,13 @@ class CSysMatrix {
 
   /*!
    * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i,i) subblock and rhs.
+   * \param[in] values - Entries of the matrix (matrix or matrix_flt).
    * \param[in] block_i - Index of the (i,i) diagonal block.
    * \param[in] rhs - Right-hand-side of the linear system.
    * \return Solution of the linear system (overwritten on rhs).
    */
-  inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const;
+  template <class T>
+  inline void Gauss_Elimination(const T* values, unsigned long block_i, ScalarType* rhs) const;
 
   /*!
    * \brief Inverse diagonal block.
@@ -306,62 +371,128 @@ class CSysMatrix {
   inline void InverseDiagonalBlock(unsigned long block_i, ScalarType* invBlock) const;
 
   /*!
-   * \brief Inverse diagonal block.
+   * \brief Inverse diagonal block (the inverse is computed with ScalarType).
+   * \param[in] ilu - Entries of the ILU matrix (ILU_matrix or ILU_matrix_flt).
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
-  inline void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType* invBlock) const;
+  template <class T>
+  inline void InverseDiagonalBlock_ILUMatrix(const T* ilu, unsigned long block_i, T* invBlock) const;
 
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
+   * \param[in] ilu - Entries of the ILU matrix (ILU_matrix or ILU_matrix_flt).
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    */
-  inline ScalarType* GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
+  template <class T>
+  inline T* GetBlock_ILUMatrix(T* ilu, unsigned long block_i, unsigned long block_j) const;
 
   /*!
    * \brief Set the value of a block in the sparse matrix.
+   * \param[in] ilu - Entries of the ILU matrix (ILU_matrix or ILU_matrix_flt).
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] **val_block - Block to set to A(i, j).
    */
-  inline void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType* val_block);
+  template <class T>
+  inline void SetBlock_ILUMatrix(T* ilu, unsigned long block_i, unsigned long block_j,
+                                 const ScalarType* val_block) const;
+
+  /*!
+   * \brief Mark the single precision copy of the matrix as stale (must be called by all threads).
+   * \note The block setters do not track changes (they are called concurrently during assembly),
+   *       instead the copy is invalidated when a preconditioner is built, i.e. before each linear solve.
+   */
+  void InvalidateFloatValues();
+
+  /*!
+   * \brief Update the single precision copy of the matrix if needed (must be called by all threads).
+   * \return Pointer to matrix_flt.
+   */
+  const FloatType* UpdateFloatValues() const;
+
+  /*!
+   * \brief Build the ILU preconditioner, implementation for the storage type of the factors.
+   */
+  template <class T>
+  void BuildILUPreconditioner(T* ilu, T* inv);
+
+  /*!
+   * \brief Apply the ILU preconditioner, implementation for the storage type of the factors.
+   */
+  template <class T>
+  void ComputeILUPreconditioner(const T* ilu, const T* inv, const CSysVector<ScalarType>& vec,
+                                CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Apply the LU_SGS preconditioner, implementation for the storage type of the matrix.
+   */
+  template <class T>
+  void ComputeLU_SGSPreconditioner(const T* values, const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                   CGeometry* geometry, const CConfig* config) const;
+
+  /*!
+   * \brief Restriction of a vector to the overlapping subdomain of the Schwarz preconditioner.
+   * \param[in] vec - Vector with valid values in the domain points.
+   * \return "vec" if there is no overlap, otherwise a copy with the halo values of the subdomain.
+   */
+  const CSysVector<ScalarType>& SchwarzRestriction(const CSysVector<ScalarType>& vec, CGeometry* geometry,
+                                                   const CConfig* config) const;
+
+  /*!
+   * \brief Applies a row operation to all rows following the order of the level sets. Wide levels are
+   *        shared by all threads, chains of narrow levels are processed by one thread to avoid barriers.
+   * \param[in] levelSets - Lower or upper level sets.
+   * \param[in] rowKernel - Function of the row index, applied once per domain row.
+   */
+  template <class RowKernel>
+  void LevelScheduledSweep(const CLevelSets& levelSets, const RowKernel& rowKernel) const;
 
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
+   * \param[in] values - Entries of the matrix (matrix or matrix_flt).
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
-  inline void UpperProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, unsigned long col_ub,
-                           ScalarType* prod) const;
+  template <class T>
+  inline void UpperProduct(const T* values, const CSysVector<ScalarType>& vec, unsigned long row_i,
+                           unsigned long col_ub, ScalarType* prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the lower part of a sparse matrix by a vector.
+   * \param[in] values - Entries of the matrix (matrix or matrix_flt).
    * \param[in] vec - Vector to be multiplied by the lower part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
-  inline void LowerProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, unsigned long col_lb,
-                           ScalarType* prod) const;
+  template <class T>
+  inline void LowerProduct(const T* values, const CSysVector<ScalarType>& vec, unsigned long row_i,
+                           unsigned long col_lb, ScalarType* prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the diagonal part of a sparse matrix by a vector.
+   * \param[in] values - Entries of the matrix (matrix or matrix_flt).
    * \param[in] vec - Vector to be multiplied by the diagonal part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
-  inline void DiagonalProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
+  template <class T>
+  inline void DiagonalProduct(const T* values, const CSysVector<ScalarType>& vec, unsigned long row_i,
+                              ScalarType* prod) const;
 
   /*!
    * \brief Performs the product of i-th row of a sparse matrix by a vector.
+   * \param[in] values - Entries of the matrix (matrix or matrix_flt).
    * \param[in] vec - Vector to be multiplied by the row of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return Result of the product (stored at *prod_row_vector).
    */
-  void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
+  template <class T>
+  void RowProduct(const T* values, const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
 
  public:
   /*!
@@ -374,6 +505,20 @@ class CSysMatrix {
    */
   ~CSysMatrix(void);
 
+  /*!
+   * \brief Store the values used by the linear solvers (matrix-vector product, ILU, LU_SGS, and JACOBI
+   *        preconditioners) in single precision, the assembly and the vectors keep ScalarType.
+   * \note Must be called before Initialize. The single precision copy of the matrix is updated on first use
+   *       after SetValZero, other operations on the entire matrix, or building a preconditioner.
+   * \param[in] enable - Use single precision storage, ignored if ScalarType is not double.
+   */
+  inline void SetFloatStorage(bool enable) { floatStorage = enable && !std::is_same<FloatType, ScalarType>::value; }
+
+  /*!
+   * \brief Whether the values used by the linear solvers are stored in single precision.
+   */
+  inline bool GetFloatStorage() const { return floatStorage; }
+
   /*!
    * \brief Initializes the sparse matrix.
    * \note The preconditioners require nVar == nEqn (square blocks).
@@ -776,6 +921,37 @@ class CSysMatrix {
     AddBlock2Diag(block_i, val_block, -1.0);
   }
 
+  /*!
+   * \brief SIMD version of AddBlock2Diag, updates the diagonal blocks of multiple points.
+   * \note The mask is also a scale factor, nothing is updated if it is 0.
+   */
+  template <class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void AddBlock2Diag(simd::Array<I, N> iPoint, const MatTypeSIMD& block, simd::Array<F, N> mask = 1) {
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar * nEqn);
+
+    /*--- "Transpose" the blocks, scale, and possibly convert types. ---*/
+    ScalarType blk[N][blkSz];
+
+    for (size_t i = 0; i < blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k = 0; k < N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]] * blkSz];
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < blkSz; ++i) bii[i] += blk[k][i];
+    }
+  }
+
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
    *        of the matrix-by-blocks structure.
@@ -924,6 +1100,16 @@ class CSysMatrix {
   void ComputeJacobiPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
 
+  /*!
+   * \brief Complete the halo rows used by the ILU and LU_SGS preconditioners with overlap (restricted additive
+   *        Schwarz), the diagonal blocks are received from the owning ranks, and the rows of the halo points
+   *        outside of the overlap are replaced by the identity. Nothing is done without overlap.
+   * \note Must be called before building those preconditioners, or after the matrix is transposed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildSchwarzOverlap(CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Build the ILU preconditioner.
    */
@@ -962,6 +1148,42 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the smoothed-aggregation AMG preconditioner (smoother of this matrix and coarse levels).
+   * \param[in] geometry - Geometrical definition of the problem (halos of the coarse levels).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle with zero initial guess).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
+  /*!
+   * \brief Build the Chebyshev preconditioner, i.e. the Jacobi preconditioner and the bounds of the spectrum
+   *        of the Jacobi preconditioned matrix, estimated with a few Lanczos steps.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildChebyshevPreconditioner(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (Jacobi preconditioned Chebyshev iterations with zero
+   *        initial guess), which only requires matrix-vector products and vector updates.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeChebyshevPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                      CGeometry* geometry, const CConfig* config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
@@ -971,6 +1193,14 @@ class CSysMatrix {
   void ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                        CSysVector<ScalarType>& res) const;
 
+  /*!
+   * \brief Copy the rows of the domain points, with global column indices, to a linear system file.
+   * \note Only the matrix part of the file (dimensions, pattern, and values) is set.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] file - Linear system file.
+   */
+  void ExportLinearSystem(CGeometry* geometry, CLinearSystemFile& file) const;
+
   /*!
    * \brief Factorize matrix using PaStiX.
    * \param[in] geometry - Geometrical definition of the problem.
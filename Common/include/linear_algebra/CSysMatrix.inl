@@ -33,30 +33,33 @@
 #include "CSysMatrix.hpp"
 
 template <class ScalarType>
-FORCEINLINE ScalarType* CSysMatrix<ScalarType>::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
+template <class T>
+FORCEINLINE T* CSysMatrix<ScalarType>::GetBlock_ILUMatrix(T* ilu, unsigned long block_i, unsigned long block_j) const {
   /*--- The position of the diagonal block is known which allows halving the search space. ---*/
   const auto end = (block_j < block_i) ? dia_ptr_ilu[block_i] : row_ptr_ilu[block_i + 1];
   for (auto index = (block_j < block_i) ? row_ptr_ilu[block_i] : dia_ptr_ilu[block_i]; index < end; ++index)
-    if (col_ind_ilu[index] == block_j) return &ILU_matrix[index * nVar * nVar];
+    if (col_ind_ilu[index] == block_j) return &ilu[index * nVar * nVar];
   return nullptr;
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j,
-                                                            ScalarType* val_block) {
-  auto ilu_ij = GetBlock_ILUMatrix(block_i, block_j);
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(T* ilu, unsigned long block_i, unsigned long block_j,
+                                                            const ScalarType* val_block) const {
+  auto ilu_ij = GetBlock_ILUMatrix(ilu, block_i, block_j);
   if (!ilu_ij) return;
   MatrixCopy(val_block, ilu_ij);
 }
 
 namespace {
 
-template <class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T* a, const T* b, T* c) {
+template <class T, bool alpha, bool beta, bool transp, class U = T>
+FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const U* a, const T* b, T* c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
-   This is still the traditional "row dot vector" method.
+   This is still the traditional "row dot vector" method. The matrix
+   may have a different type (e.g. single precision storage).
   ---*/
   if (!transp) {
     for (auto i = 0ul; i < n; i++) {
@@ -82,6 +85,152 @@ FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
     }
   }
 }
+
+/*--- Largest power of 2 not greater than n, simd::Array sizes must be powers of 2. ---*/
+constexpr size_t floorPow2(size_t n) { return n < 2 ? n : 2 * floorPow2(n / 2); }
+
+/*!
+ * \brief Row of a block with compile-time size N, stored as a chain of simd::Array of decreasing
+ *        (power of 2) sizes, e.g. 7 = 4 + 2 + 1, such that no element is loaded out of bounds.
+ */
+template <class T, size_t N>
+struct CBlockRow {
+  enum : size_t { Head = floorPow2(N) };
+  simd::Array<T, Head> head;
+  CBlockRow<T, N - Head> tail;
+
+  FORCEINLINE void zero() {
+    head = T(0);
+    tail.zero();
+  }
+  FORCEINLINE void load(const T* ptr) {
+    head.load(ptr);
+    tail.load(ptr + Head);
+  }
+  /*--- Blocks stored with another type (e.g. single precision) are converted while loading. ---*/
+  template <class U>
+  FORCEINLINE void load(const U* ptr) {
+    for (size_t k = 0; k < Head; ++k) head[k] = ptr[k];
+    tail.load(ptr + Head);
+  }
+  FORCEINLINE void store(T* ptr) const {
+    head.store(ptr);
+    tail.store(ptr + Head);
+  }
+  /*! \brief this += a * b, element-wise. */
+  FORCEINLINE void multAdd(const CBlockRow& a, const CBlockRow& b) {
+    head += a.head * b.head;
+    tail.multAdd(a.tail, b.tail);
+  }
+  /*! \brief this += a * b, with scalar a. */
+  FORCEINLINE void multAdd(T a, const CBlockRow& b) {
+    head += a * b.head;
+    tail.multAdd(a, b.tail);
+  }
+  FORCEINLINE T sum() const { return head.sum() + tail.sum(); }
+  FORCEINLINE T dot(const CBlockRow& other) const { return head.dot(other.head) + tail.dot(other.tail); }
+};
+
+template <class T>
+struct CBlockRow<T, 0> {
+  FORCEINLINE void zero() {}
+  template <class U>
+  FORCEINLINE void load(const U*) {}
+  FORCEINLINE void store(T*) const {}
+  FORCEINLINE void multAdd(const CBlockRow&, const CBlockRow&) {}
+  FORCEINLINE void multAdd(T, const CBlockRow&) {}
+  FORCEINLINE T sum() const { return T(0); }
+  FORCEINLINE T dot(const CBlockRow&) const { return T(0); }
+};
+
+/*--- Block sizes for which compile-time specialized kernels are generated, see "fixedBlockSize". ---*/
+#define FOREACH_FIXED_BLOCK_SIZE(CASE) CASE(1) CASE(2) CASE(4) CASE(5) CASE(6) CASE(7)
+
+/*!
+ * \brief Call "fixed" with std::integral_constant<size_t, N> if N is one of the fixed block sizes, otherwise
+ *        call "generic" (without arguments). E.g. the kernel of a generic lambda "[&](auto N) {...}" is
+ *        instantiated with decltype(N)::value known at compile time, for each fixed size.
+ * \param[in] blockSize - Size of the square blocks (0 to always use the generic version).
+ * \param[in] fixed - Specialized version, callable with the block size as an integral constant.
+ * \param[in] generic - Version for any block size.
+ */
+template <class Fixed, class Generic>
+FORCEINLINE auto DispatchBlockSize(unsigned long blockSize, const Fixed& fixed, const Generic& generic)
+    -> decltype(generic()) {
+  switch (blockSize) {
+#define FIXED_CASE(N) \
+  case N:             \
+    return fixed(std::integral_constant<size_t, N>());
+    FOREACH_FIXED_BLOCK_SIZE(FIXED_CASE)
+#undef FIXED_CASE
+    default:
+      return generic();
+  }
+}
+
+template <size_t N, bool alpha, bool beta, class T, class U>
+FORCEINLINE void gemv_fixed(const U* a, const T* b, T* c) {
+  /*--- Square block, each row of the result is the dot product of a row of the block and the vector. ---*/
+  CBlockRow<T, N> x, row;
+  x.load(b);
+  for (size_t i = 0; i < N; ++i) {
+    row.load(a + i * N);
+    const T dot = row.dot(x);
+    c[i] = (beta ? c[i] : T(0)) + (alpha ? dot : -dot);
+  }
+}
+
+template <size_t N, class T>
+FORCEINLINE void gemm_fixed(const T* a, const T* b, T* c) {
+  /*--- Rows of the product are linear combinations of the rows of b. ---*/
+  CBlockRow<T, N> bRow[N], cRow;
+  for (size_t k = 0; k < N; ++k) bRow[k].load(b + k * N);
+  for (size_t i = 0; i < N; ++i) {
+    cRow.zero();
+    for (size_t k = 0; k < N; ++k) cRow.multAdd(a[i * N + k], bRow[k]);
+    cRow.store(c + i * N);
+  }
+}
+
+template <size_t N, class T>
+FORCEINLINE void gauss_fixed(T* a, T* b) {
+  /*--- Same algorithm as the generic Gauss_Elimination, with loops of known length. ---*/
+  for (size_t i = 1; i < N; ++i) {
+    for (size_t j = 0; j < i; ++j) {
+      const T weight = a[i * N + j] / a[j * N + j];
+      for (size_t k = j; k < N; ++k) a[i * N + k] -= weight * a[j * N + k];
+      b[i] -= weight * b[j];
+    }
+  }
+  for (size_t i = N; i > 0;) {
+    --i;
+    for (size_t j = i + 1; j < N; ++j) b[i] -= a[i * N + j] * b[j];
+    b[i] /= a[i * N + i];
+  }
+}
+
+/*!
+ * \brief Product of a row of blocks (in the index range [begin, end) of the sparse pattern) by a vector.
+ * \note The accumulation is element-wise and the horizontal reductions happen once per row of the result.
+ */
+template <size_t N, class T, class U, class Filter>
+FORCEINLINE void rowprod_fixed(const U* values, const unsigned long* col_ind, unsigned long begin, unsigned long end,
+                               const T* vec, T* prod, Filter keep) {
+  CBlockRow<T, N> acc[N], x, row;
+  for (size_t i = 0; i < N; ++i) acc[i].zero();
+
+  for (auto index = begin; index < end; ++index) {
+    const auto col_j = col_ind[index];
+    if (!keep(col_j)) continue;
+    x.load(&vec[col_j * N]);
+    const U* block = &values[index * N * N];
+    for (size_t i = 0; i < N; ++i) {
+      row.load(block + i * N);
+      acc[i].multAdd(row, x);
+    }
+  }
+  for (size_t i = 0; i < N; ++i) prod[i] = acc[i].sum();
+}
 }  // namespace
 
 #define __MATVECPROD_SIGNATURE__(TYPE, NAME) \
@@ -92,26 +241,18 @@ FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
   __MATVECPROD_SIGNATURE__(ScalarType, NAME)
 
 #if !defined(USE_MKL)
-MATVECPROD_SIGNATURE(MatrixVectorProduct) {
-  /*---
-   Without MKL (default) picture copying the body of gemv_impl
-   here and resolving the conditionals at compilation.
-  ---*/
-  gemv_impl<ScalarType, true, false, false>(nVar, nEqn, matrix, vector, product);
-}
+/*--- Without MKL (default) use the same implementation as for blocks stored with another type. ---*/
 
-MATVECPROD_SIGNATURE(MatrixVectorProductAdd) {
-  gemv_impl<ScalarType, true, true, false>(nVar, nEqn, matrix, vector, product);
-}
+MATVECPROD_SIGNATURE(MatrixVectorProduct) { MatrixVectorProduct<ScalarType>(matrix, vector, product); }
 
-MATVECPROD_SIGNATURE(MatrixVectorProductSub) {
-  gemv_impl<ScalarType, false, true, false>(nVar, nEqn, matrix, vector, product);
-}
+MATVECPROD_SIGNATURE(MatrixVectorProductAdd) { MatrixVectorProductAdd<ScalarType>(matrix, vector, product); }
+
+MATVECPROD_SIGNATURE(MatrixVectorProductSub) { MatrixVectorProductSub<ScalarType>(matrix, vector, product); }
 
 template <class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType* matrix_a, const ScalarType* matrix_b,
                                                              ScalarType* product) const {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  MatrixMatrixProduct<ScalarType>(matrix_a, matrix_b, product);
 }
 #else
 MATVECPROD_SIGNATURE(MatrixVectorProduct) {
@@ -141,11 +282,53 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType* m
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
+/*--- Blocks stored with another type always use the templated implementation. The kernels specialized
+ * for the block size are used when possible (picture copying the body of gemv_impl here and resolving
+ * the conditionals at compilation otherwise). ---*/
+
+template <class ScalarType>
+template <class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProduct(const OtherType* matrix, const ScalarType* vector,
+                                                             ScalarType* product) const {
+  DispatchBlockSize(
+      fixedBlockSize, [&](auto N) { gemv_fixed<decltype(N)::value, true, false>(matrix, vector, product); },
+      [&]() { gemv_impl<ScalarType, true, false, false>(nVar, nEqn, matrix, vector, product); });
+}
+
+template <class ScalarType>
+template <class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProductAdd(const OtherType* matrix, const ScalarType* vector,
+                                                                ScalarType* product) const {
+  DispatchBlockSize(
+      fixedBlockSize, [&](auto N) { gemv_fixed<decltype(N)::value, true, true>(matrix, vector, product); },
+      [&]() { gemv_impl<ScalarType, true, true, false>(nVar, nEqn, matrix, vector, product); });
+}
+
+template <class ScalarType>
+template <class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProductSub(const OtherType* matrix, const ScalarType* vector,
+                                                                ScalarType* product) const {
+  DispatchBlockSize(
+      fixedBlockSize, [&](auto N) { gemv_fixed<decltype(N)::value, false, true>(matrix, vector, product); },
+      [&]() { gemv_impl<ScalarType, false, true, false>(nVar, nEqn, matrix, vector, product); });
+}
+
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const {
+template <class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const OtherType* matrix_a, const OtherType* matrix_b,
+                                                             OtherType* product) const {
+  DispatchBlockSize(
+      fixedBlockSize, [&](auto N) { gemm_fixed<decltype(N)::value>(matrix_a, matrix_b, product); },
+      [&]() { gemm_impl<OtherType>(nVar, matrix_a, matrix_b, product); });
+}
+
+template <class ScalarType>
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(const T* values, unsigned long block_i,
+                                                           ScalarType* rhs) const {
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR * MAXNVAR];
-  MatrixCopy(&matrix[dia_ptr[block_i] * nVar * nVar], block);
+  MatrixCopy(&values[dia_ptr[block_i] * nVar * nVar], block);
 
   Gauss_Elimination(block, rhs);
 }
@@ -160,52 +343,86 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock(unsigned long bloc
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned long block_i,
-                                                                        ScalarType* invBlock) const {
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(const T* ilu, unsigned long block_i,
+                                                                        T* invBlock) const {
   /*--- Copy block, as the algorithm modifies the matrix ---*/
-  ScalarType block[MAXNVAR * MAXNVAR];
-  MatrixCopy(&ILU_matrix[dia_ptr_ilu[block_i] * nVar * nVar], block);
+  ScalarType block[MAXNVAR * MAXNVAR], inverse[MAXNVAR * MAXNVAR];
+  MatrixCopy(&ilu[dia_ptr_ilu[block_i] * nVar * nVar], block);
 
-  MatrixInverse(block, invBlock);
+  MatrixInverse(block, inverse);
+  MatrixCopy(inverse, invBlock);
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
-                                                    ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const T* values, const CSysVector<ScalarType>& vec,
+                                                    unsigned long row_i, ScalarType* prod) const {
+  const auto begin = row_ptr[row_i];
+  const auto end = row_ptr[row_i + 1];
+  const auto all = [](unsigned long) { return true; };
 
-  for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
-    auto col_j = col_ind[index];
-    MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
-  }
+  DispatchBlockSize(
+      fixedBlockSize,
+      [&](auto N) { rowprod_fixed<decltype(N)::value>(values, col_ind, begin, end, vec.GetBlock(0), prod, all); },
+      [&]() {
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+
+        for (auto index = begin; index < end; index++) {
+          auto col_j = col_ind[index];
+          MatrixVectorProductAdd(&values[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+        }
+      });
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
-                                                      unsigned long col_ub, ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
-
-  for (auto index = dia_ptr[row_i] + 1; index < row_ptr[row_i + 1]; index++) {
-    auto col_j = col_ind[index];
-    /*--- Always include halos. ---*/
-    if (col_j < col_ub || col_j >= nPointDomain)
-      MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
-  }
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const T* values, const CSysVector<ScalarType>& vec,
+                                                      unsigned long row_i, unsigned long col_ub,
+                                                      ScalarType* prod) const {
+  const auto begin = dia_ptr[row_i] + 1;
+  const auto end = row_ptr[row_i + 1];
+  /*--- Always include halos. ---*/
+  const auto keep = [&](unsigned long col_j) { return col_j < col_ub || col_j >= nPointDomain; };
+
+  DispatchBlockSize(
+      fixedBlockSize,
+      [&](auto N) { rowprod_fixed<decltype(N)::value>(values, col_ind, begin, end, vec.GetBlock(0), prod, keep); },
+      [&]() {
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+
+        for (auto index = begin; index < end; index++) {
+          auto col_j = col_ind[index];
+          if (keep(col_j)) MatrixVectorProductAdd(&values[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+        }
+      });
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
-                                                      unsigned long col_lb, ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const T* values, const CSysVector<ScalarType>& vec,
+                                                      unsigned long row_i, unsigned long col_lb,
+                                                      ScalarType* prod) const {
+  const auto begin = row_ptr[row_i];
+  const auto end = dia_ptr[row_i];
+  const auto keep = [&](unsigned long col_j) { return col_j >= col_lb; };
 
-  for (auto index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
-    auto col_j = col_ind[index];
-    if (col_j >= col_lb) MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
-  }
+  DispatchBlockSize(
+      fixedBlockSize,
+      [&](auto N) { rowprod_fixed<decltype(N)::value>(values, col_ind, begin, end, vec.GetBlock(0), prod, keep); },
+      [&]() {
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+
+        for (auto index = begin; index < end; index++) {
+          auto col_j = col_ind[index];
+          if (keep(col_j)) MatrixVectorProductAdd(&values[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+        }
+      });
 }
 
 template <class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
-                                                         ScalarType* prod) const {
-  MatrixVectorProduct(&matrix[dia_ptr[row_i] * nVar * nEqn], &vec[row_i * nEqn], prod);
+template <class T>
+FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const T* values, const CSysVector<ScalarType>& vec,
+                                                         unsigned long row_i, ScalarType* prod) const {
+  MatrixVectorProduct(&values[dia_ptr[row_i] * nVar * nEqn], &vec[row_i * nEqn], prod);
 }
@@ -100,6 +100,17 @@ class CSysSolve {
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  /*!
+   * \brief Subspace recycled by GCRO-DR between restarts and between calls, such that A * U = C, with orthonormal C.
+   */
+  struct CRecycleSpace {
+    std::vector<VectorType> U; /*!< \brief Basis of the recycled subspace (in the space of the solution). */
+    std::vector<VectorType> C; /*!< \brief Image of U by the matrix, orthonormal. */
+    unsigned long size = 0;    /*!< \brief Number of vectors currently in use. */
+  };
+  CRecycleSpace primalRecycle;  /*!< \brief Recycled subspace for Solve. */
+  CRecycleSpace adjointRecycle; /*!< \brief Recycled subspace for Solve_b (the transposed system). */
+
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType
@@ -114,6 +125,24 @@ class CSysSolve {
   bool xIsZero = false;              /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;         /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10;    /*!< \brief Monitoring frequency. */
+  bool systemWritten = false;        /*!< \brief The linear system was already written for offline replay. */
+  std::string systemName;            /*!< \brief Identifies the files of the system written for offline replay. */
+
+  /*!
+   * \brief Write the linear system and the settings of the solver to file, for replay with SU2_LINBENCH.
+   * \note Each rank writes its own file, threads wait for the master thread to write it.
+   * \param[in] Jacobian - Matrix of the linear system.
+   * \param[in] LinSysRes - Right hand side of the linear system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] kindSolver - Type of linear solver.
+   * \param[in] kindPrec - Type of preconditioner.
+   * \param[in] maxIter - Maximum number of iterations.
+   * \param[in] tol - Tolerance of the linear solver.
+   */
+  void WriteLinearSystem(const CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
+                         CGeometry* geometry, const CConfig* config, unsigned short kindSolver,
+                         unsigned short kindPrec, unsigned long maxIter, ScalarType tol);
 
   /*!
    * \brief sign transfer function
@@ -184,6 +213,35 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with one (unconditional) reorthogonalization pass, CGS2.
+   * \note The inner products of each pass are reduced together, therefore each Arnoldi step costs three global
+   *       reductions regardless of the size of the basis, instead of at least i+2 with ModGramSchmidt.
+   * \param[in] shared_hsbg - if the Hessenberg matrix is shared by multiple threads
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the previous vectors in w
+   */
+  void ClassicalGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
+
+  /*!
+   * \brief Replaces the recycled subspace by the harmonic Ritz vectors associated with the smallest harmonic Ritz
+   *        values of the last GCRO-DR cycle, i.e. the slowest modes of the preconditioned operator.
+   * \note The cycle satisfies A * Z[0:n] = W[0:n+1] * G, the Ritz vectors y are the dominant eigenvectors of
+   *       pinv(G) * W^T * Z (the eigenvalues are the inverse of the harmonic Ritz values).
+   * \param[in] n - number of columns of the cycle (recycled vectors included)
+   * \param[in] kMax - maximum size of the recycled subspace
+   * \param[in] G - (n+1) x n matrix of the Arnoldi-like relation
+   * \param[in] R - G reduced to upper triangular form by the Givens rotations sn, cs
+   * \param[in] sn - sine of the Givens rotations
+   * \param[in] cs - cosine of the Givens rotations
+   * \param[in,out] space - the recycled subspace
+   * \return The new size of the recycled subspace.
+   */
+  unsigned long UpdateRecycleSpace(unsigned long n, unsigned long kMax, const su2matrix<ScalarType>& G,
+                                   const su2matrix<ScalarType>& R, const su2vector<ScalarType>& sn,
+                                   const su2vector<ScalarType>& cs, CRecycleSpace& space) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -333,6 +391,27 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config);
 
+  /*!
+   * \brief GCRO-DR, flexible GMRES with deflated restarts and recycling of the deflation space between calls.
+   * \note The subspace size (m) is the restart frequency, which includes the recycled vectors, the number of
+   *       recycled vectors comes from the config. Each call starts by computing the image of the recycled subspace
+   *       by the (new) matrix, which costs one product per recycled vector.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] MaxIter - maximum number of iterations (applications of the preconditioner)
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] transposed - The system is the transpose of the one solved by Solve (selects the recycled subspace).
+   */
+  unsigned long GCRODR_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                 const PrecondType& precond, ScalarType tol, unsigned long MaxIter,
+                                 ScalarType& residual, bool monitoring, const CConfig* config,
+                                 bool transposed = false);
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -419,4 +498,9 @@ class CSysSolve {
    * \brief Set the screen output frequency during monitoring.
    */
   inline void SetMonitoringFrequency(bool frequency) { monitorFreq = frequency; }
+
+  /*!
+   * \brief Set the name of the linear system, part of the names of the files written for SU2_LINBENCH.
+   */
+  inline void SetName(const std::string& name) { systemName = name; }
 };
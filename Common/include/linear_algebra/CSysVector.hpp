@@ -358,6 +358,50 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   inline ScalarType squaredNorm() const { return dot(*this); }
 
+  /*!
+   * \brief Dot products between "this" and several vectors, with a single reduction (one MPI message).
+   * \note Must be called by all threads, each one gets a copy of the results.
+   * \param[in] n - Number of vectors.
+   * \param[in] vecs - Pointer to the first of n contiguous vectors (e.g. the data of a std::vector).
+   * \param[out] res - The n dot products, should be private to each thread.
+   */
+  void multiDot(unsigned long n, const CSysVector* vecs, ScalarType* res) const {
+    static std::vector<ScalarType> dotRes;
+    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
+    SU2_OMP_SAFE_GLOBAL_ACCESS(dotRes.assign(n, 0.0);)
+
+    /*--- Local dot products for each thread, the loops have the same (static) partition. ---*/
+    for (auto k = 0ul; k < n; ++k) {
+      ScalarType sum = 0.0;
+
+      CSYSVEC_PARFOR
+      for (auto i = 0ul; i < nElmDomain; ++i) {
+        sum += vec_val[i] * vecs[k].vec_val[i];
+      }
+      END_CSYSVEC_PARFOR
+
+      res[k] = sum;
+    }
+
+    /*--- Update shared variables with "our" partial sums. ---*/
+    for (auto k = 0ul; k < n; ++k) atomicAdd(res[k], dotRes[k]);
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto k = 0ul; k < n; ++k) res[k] = dotRes[k];
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(res, dotRes.data(), n, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#else
+    /*--- Make view of results consistent across threads. ---*/
+    SU2_OMP_BARRIER
+#endif
+
+    for (auto k = 0ul; k < n; ++k) res[k] = dotRes[k];
+  }
+
   /*!
    * \brief L2 norm of the vector.
    * \return L2 norm.
@@ -445,6 +489,26 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Vectorized version of AddBlock, updates multiple iPoint's.
+   * \note See SIMD overload of SetBlock.
+   */
+  template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
+  FORCEINLINE void AddBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
+    /*--- "Transpose" and scale input vector. ---*/
+    constexpr size_t nVar = VecTypeSIMD::StaticSize;
+    assert(nVar == this->nVar);
+    ScalarType vec[N][nVar];
+    UnpackBlock(vector, mask, vec);
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < nVar; ++i) vec_val[iPoint[k] * nVar + i] += vec[k][i];
+    }
+  }
+
   /*!
    * \brief Vectorized version of UpdateBlocks, updates multiple i/jPoint's.
    * \note See SIMD overload of SetBlock.
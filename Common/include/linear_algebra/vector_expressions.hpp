@@ -140,6 +140,8 @@ MAKE_UNARY_FUN(operator-, minus_, -)
 MAKE_UNARY_FUN(abs, abs_, math::abs)
 MAKE_UNARY_FUN(sqrt, sqrt_, math::sqrt)
 MAKE_UNARY_FUN(sign, sign_, sign_impl)
+MAKE_UNARY_FUN(exp, exp_, math::exp)
+MAKE_UNARY_FUN(tanh, tanh_, math::tanh)
 #undef sign_impl
 
 #undef MAKE_UNARY_FUN
@@ -2383,6 +2383,7 @@ enum ENUM_LINEAR_SOLVER {
   FGMRES,               /*!< \brief Flexible Generalized Minimal Residual method. */
   BCGSTAB,              /*!< \brief BCGSTAB - Biconjugate Gradient Stabilized Method (main solver). */
   RESTARTED_FGMRES,     /*!< \brief Flexible Generalized Minimal Residual method with restart. */
+  GCRO_DR,              /*!< \brief Restarted FGMRES with deflated restarts and subspace recycling between solves. */
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
@@ -2392,11 +2393,24 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("GCRO_DR", GCRO_DR)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
 };
 
+/*!
+ * \brief Orthogonalization of the Krylov basis in FGMRES.
+ */
+enum class LINEAR_SOLVER_ORTHOGONALIZATION {
+  MGS,   /*!< \brief Modified Gram-Schmidt with selective reorthogonalization (one reduction per basis vector). */
+  CGS2,  /*!< \brief Classical Gram-Schmidt with one reorthogonalization pass (three reductions per iteration). */
+};
+static const MapType<std::string, LINEAR_SOLVER_ORTHOGONALIZATION> Linear_Solver_Orthogonalization_Map = {
+  MakePair("MGS", LINEAR_SOLVER_ORTHOGONALIZATION::MGS)
+  MakePair("CGS2", LINEAR_SOLVER_ORTHOGONALIZATION::CGS2)
+};
+
 /*!
  * \brief Types surface continuity at the intersection with the FFD
  */
@@ -2451,6 +2465,8 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
+  CHEBYSHEV,      /*!< \brief Jacobi preconditioned Chebyshev polynomial. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2460,6 +2476,8 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
+  MakePair("CHEBYSHEV", CHEBYSHEV)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2664,6 +2682,7 @@ enum class MPI_QUANTITIES {
   PRIMITIVE_GRADIENT   ,  /*!< \brief Primitive gradient communication. */
   PRIMITIVE_GRAD_REC   ,  /*!< \brief Primitive reconstruction gradient communication. */
   PRIMITIVE_LIMITER    ,  /*!< \brief Primitive limiter communication. */
+  PRIMITIVE_GRAD_REC_LIMITER,  /*!< \brief Primitive reconstruction gradient and limiter communication. */
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
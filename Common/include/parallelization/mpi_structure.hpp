@@ -173,6 +173,20 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int count, Request* request) { MPI_Startall(count, request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
@@ -376,6 +390,26 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Irecv(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm), request);
   }
 
+  /*--- Persistent requests are not differentiated (see CGeometry::PreprocessP2PComms). ---*/
+
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not available with AD types.", CURRENT_FUNCTION);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not available with AD types.", CURRENT_FUNCTION);
+  }
+
+  static inline void Start(Request* request) {
+    Error("Persistent requests are not available with AD types.", CURRENT_FUNCTION);
+  }
+
+  static inline void Startall(int count, Request* request) {
+    Error("Persistent requests are not available with AD types.", CURRENT_FUNCTION);
+  }
+
   static inline void Wait(SU2_MPI::Request* request, Status* status) { AMPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return AMPI_Request_free(request); }
@@ -539,6 +573,16 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int count, Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request* request) { return 0; }
@@ -224,5 +224,64 @@ inline void TangentProjection(Int nDim, const Mat& tensor, const Scalar* vector,
 
   for (Int iDim = 0; iDim < nDim; iDim++) proj[iDim] -= normalProj * vector[iDim];
 }
+/*!
+ * \brief Compute S = inv(R) * transpose(inv(R)), where transpose(R) * R is the normal matrix of a
+ *        least-squares gradient and R is obtained by Cholesky factorization.
+ * \note Only the upper triangular part of S is set, it is zero if R is singular.
+ * \param[in] r11, r12, r22, r13, r33 - Entries of the normal matrix (r13 and r33 are not used in 2D).
+ * \param[in] r23_a, r23_b - Entry (1,2) of the normal matrix and entry (0,2) again (not used in 2D).
+ * \param[in] eps - Regularization of the diagonal entries of R and threshold for singular matrices.
+ * \param[out] S - Upper triangular part of S.
+ */
+template <int nDim, class Scalar, class Eps>
+inline void LeastSquaresSmatrix(Scalar r11, Scalar r12, Scalar r22, Scalar r13, Scalar r23_a, Scalar r23_b,
+                                Scalar r33, Eps eps, Scalar S[][nDim]) {
+  Scalar r23 = 0.0;
+
+  r11 = sqrt(r11 > eps ? r11 : Scalar(eps));
+  r12 /= r11;
+  r22 -= r12 * r12;
+  r22 = sqrt(r22 > eps ? r22 : Scalar(eps));
+
+  if (nDim == 3) {
+    r13 /= r11;
+    r23 = r23_a / r22 - r23_b * r12 / (r11 * r22);
+    r33 = r33 - r23 * r23 - r13 * r13;
+    r33 = sqrt(r33 > eps ? r33 : Scalar(eps));
+  } else {
+    r13 = 0.0;
+    r33 = 1.0;
+  }
+
+  const Scalar detR2 = pow(r11 * r22 * r33, 2);
+
+  for (int iDim = 0; iDim < nDim; ++iDim)
+    for (int jDim = 0; jDim < nDim; ++jDim) S[iDim][jDim] = 0.0;
+
+  /*--- Detect singular matrix. ---*/
+  if (detR2 <= eps) return;
+
+  if (nDim == 2) {
+    S[0][0] = (r12 * r12 + r22 * r22) / detR2;
+    S[0][1] = -r11 * r12 / detR2;
+    S[1][1] = r11 * r11 / detR2;
+  } else {
+    const Scalar z11 = r22 * r33;
+    const Scalar z12 = -r12 * r33;
+    const Scalar z13 = r12 * r23 - r13 * r22;
+    const Scalar z22 = r11 * r33;
+    const Scalar z23 = -r11 * r23;
+    const Scalar z33 = r11 * r22;
+
+    /*--- Indices are written such that they are valid in 2D. ---*/
+    S[0][0] = (z11 * z11 + z12 * z12 + z13 * z13) / detR2;
+    S[0][1] = (z12 * z22 + z13 * z23) / detR2;
+    S[0][nDim - 1] = (z13 * z33) / detR2;
+    S[1][1] = (z22 * z22 + z23 * z23) / detR2;
+    S[1][nDim - 1] = (z23 * z33) / detR2;
+    S[nDim - 1][nDim - 1] = (z33 * z33) / detR2;
+  }
+}
+
 /// @}
 }  // namespace GeometryToolbox
@@ -1877,10 +1877,36 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Orthogonalization of the FGMRES basis, MGS or CGS2 (fewer global reductions, better for many ranks). */
+  addEnumOption("LINEAR_SOLVER_ORTHOGONALIZATION", Linear_Solver_Orthogonalization, Linear_Solver_Orthogonalization_Map, LINEAR_SOLVER_ORTHOGONALIZATION::MGS);
+  /* DESCRIPTION: Number of vectors recycled by GCRO_DR between restarts and linear solves (less than the restart frequency). */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 5);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Use level scheduling (instead of additive domain decomposition) for thread-parallel ILU and LU_SGS. */
+  addBoolOption("LINEAR_SOLVER_PREC_LEVEL_SCHEDULING", Linear_Solver_Prec_Level_Scheduling, false);
+  /* DESCRIPTION: Layers of overlap between MPI ranks for ILU and LU_SGS, restricted additive Schwarz (0 is block-Jacobi, max 2). */
+  addUnsignedShortOption("LINEAR_SOLVER_SCHWARZ_OVERLAP", Linear_Solver_Schwarz_Overlap, 0);
+  /* DESCRIPTION: Store the flow Jacobian and the ILU/LU_SGS/JACOBI preconditioner in single precision (the Krylov vectors remain double). */
+  addBoolOption("LINEAR_SOLVER_FLOAT_STORAGE_FLOW", Linear_Solver_Float_Storage_Flow, false);
+  /* DESCRIPTION: Store the turbulence Jacobian and the ILU/LU_SGS/JACOBI preconditioner in single precision. */
+  addBoolOption("LINEAR_SOLVER_FLOAT_STORAGE_TURB", Linear_Solver_Float_Storage_Turb, false);
+  /* DESCRIPTION: Smoother used on all levels of the AMG preconditioner (ILU, LU_SGS, or JACOBI). */
+  addEnumOption("LINEAR_SOLVER_AMG_SMOOTHER", Kind_Linear_Solver_AMG_Smoother, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Maximum number of levels of the AMG preconditioner (including the finest). */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Strength of connection threshold for the aggregation of the AMG preconditioner. */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
+  /* DESCRIPTION: Smooth the tentative AMG prolongation with damped Jacobi (smoothed aggregation). */
+  addBoolOption("LINEAR_SOLVER_AMG_SMOOTH_PROLONGATION", Linear_Solver_AMG_Smooth_Prolongation, true);
+  /* DESCRIPTION: Degree of the Chebyshev polynomial preconditioner (number of Jacobi iterations it replaces). */
+  addUnsignedShortOption("LINEAR_SOLVER_CHEBYSHEV_DEGREE", Linear_Solver_Chebyshev_Degree, 4);
+  /* DESCRIPTION: Inner iteration at which the assembled linear systems are written for replay with SU2_LINBENCH (-1 disables). */
+  addLongOption("LINEAR_SYSTEM_DUMP_ITER", Linear_System_Dump_Iter, -1);
+  /* DESCRIPTION: Prefix of the linear system dump files. */
+  addStringOption("LINEAR_SYSTEM_DUMP_FILENAME", Linear_System_Dump_Filename, string("linear_system"));
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1955,6 +1981,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief STORE_LS_GRADIENT_WEIGHTS
+   *  \n DESCRIPTION: Precompute the geometric weights of least-squares gradients after each update of the dual grid. \n DEFAULT: NO. \ingroup Config*/
+  addBoolOption("STORE_LS_GRADIENT_WEIGHTS", StoreLSGradientWeights, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1978,6 +2007,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief SLOPE_LIMITER_FLOW
    * DESCRIPTION: Slope limiter for the direct solution. \n OPTIONS: See \link Limiter_Map \endlink \n DEFAULT VENKATAKRISHNAN \ingroup Config*/
   addEnumOption("SLOPE_LIMITER_FLOW", Kind_SlopeLimit_Flow, Limiter_Map, LIMITER::VENKATAKRISHNAN);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute the flow limiters in the same pass as the Green-Gauss reconstruction gradients. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", FusedGradientLimiter, false);
   jst_coeff[0] = 0.5; jst_coeff[1] = 0.02;
   /*!\brief JST_SENSOR_COEFF \n DESCRIPTION: 2nd and 4th order artificial dissipation coefficients for the JST method \ingroup Config*/
   addDoubleArrayOption("JST_SENSOR_COEFF", 2, jst_coeff);
@@ -2990,6 +3022,15 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Allow fallback to smaller edge color group sizes for the discrete adjoint and allow more colors. */
   addBoolOption("EDGE_COLORING_RELAX_DISC_ADJ", edgeColoringRelaxDiscAdj, true);
 
+  /* DESCRIPTION: Overlap the MPI exchange of gradients and limiters with the computation for points away from the partition boundaries. */
+  addBoolOption("COMM_OVERLAP", CommOverlap, false);
+
+  /* DESCRIPTION: Create persistent MPI requests for point-to-point comms once and restart them for every exchange. */
+  addBoolOption("P2P_PERSISTENT_REQUESTS", P2PPersistentRequests, false);
+
+  /* DESCRIPTION: Maximum number of values per point that point-to-point comms read directly from the shared memory of neighbors on the same node (0 disables). */
+  addUnsignedShortOption("P2P_SHARED_MEMORY_COUNT", P2PSharedMemoryCount, 0);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -5375,6 +5416,20 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /*--- The AMG smoothers are the preconditioners that work on any block sparse matrix. ---*/
+  if (Kind_Linear_Solver_AMG_Smoother != ILU && Kind_Linear_Solver_AMG_Smoother != LU_SGS &&
+      Kind_Linear_Solver_AMG_Smoother != JACOBI) {
+    SU2_MPI::Error("LINEAR_SOLVER_AMG_SMOOTHER must be ILU, LU_SGS, or JACOBI.", CURRENT_FUNCTION);
+  }
+
+  /*--- Only one layer of halo points is available, with 2 layers of overlap it is used entirely. ---*/
+  if (Linear_Solver_Schwarz_Overlap > 2) {
+    SU2_MPI::Error("LINEAR_SOLVER_SCHWARZ_OVERLAP must be 0, 1, or 2.", CURRENT_FUNCTION);
+  }
+
+  if (Linear_Solver_Chebyshev_Degree == 0) {
+    SU2_MPI::Error("LINEAR_SOLVER_CHEBYSHEV_DEGREE must be at least 1.", CURRENT_FUNCTION);
+  }
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -5495,6 +5550,18 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     LeastSquaresRequired = true;
   }
 
+  if (StoreLSGradientWeights && DiscreteAdjoint) {
+    SU2_MPI::Error("STORE_LS_GRADIENT_WEIGHTS is not available for discrete adjoint problems.", CURRENT_FUNCTION);
+  }
+
+  if (FusedGradientLimiter && DiscreteAdjoint) {
+    SU2_MPI::Error("FUSED_GRADIENT_LIMITER is not available for discrete adjoint problems.", CURRENT_FUNCTION);
+  }
+
+  if (CommOverlap && DiscreteAdjoint) {
+    SU2_MPI::Error("COMM_OVERLAP is not available for discrete adjoint problems.", CURRENT_FUNCTION);
+  }
+
   if (Kind_Gradient_Method == LEAST_SQUARES) {
     SU2_MPI::Error(string("LEAST_SQUARES gradient method not allowed for viscous / source terms.\n") +
                    string("Please select either WEIGHTED_LEAST_SQUARES or GREEN_GAUSS."),
@@ -7147,6 +7214,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case GCRO_DR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
               else
@@ -7156,6 +7224,8 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an AMG preconditioning."<< endl; break;
+                case CHEBYSHEV: cout << "Using a Chebyshev preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -7164,6 +7234,8 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An AMG"; break;
+                case CHEBYSHEV: cout << "A Chebyshev"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -7193,7 +7265,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case GCRO_DR:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -10056,31 +10128,36 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) const {
   const double val_elapsed_time = val_stop_time - val_start_time;
 
   /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
+     stored in the map GEMM_Profile_MNK. The profiling data is shared by all
+     threads of the hybrid FEM-DG solver, hence the critical section. */
   CLong3T MNK(M, N, K);
-  map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
+  SU2_OMP_CRITICAL
+  {
+    map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-  if(MI == GEMM_Profile_MNK.end()) {
+    if(MI == GEMM_Profile_MNK.end()) {
 
-    /* Entry is not present yet. Create it. */
-    const int ind = GEMM_Profile_MNK.size();
-    GEMM_Profile_MNK[MNK] = ind;
+      /* Entry is not present yet. Create it. */
+      const int ind = GEMM_Profile_MNK.size();
+      GEMM_Profile_MNK[MNK] = ind;
 
-    GEMM_Profile_NCalls.push_back(1);
-    GEMM_Profile_TotTime.push_back(val_elapsed_time);
-    GEMM_Profile_MinTime.push_back(val_elapsed_time);
-    GEMM_Profile_MaxTime.push_back(val_elapsed_time);
-  }
-  else {
+      GEMM_Profile_NCalls.push_back(1);
+      GEMM_Profile_TotTime.push_back(val_elapsed_time);
+      GEMM_Profile_MinTime.push_back(val_elapsed_time);
+      GEMM_Profile_MaxTime.push_back(val_elapsed_time);
+    }
+    else {
 
-    /* Entry is already present. Determine its index in the
-       map and update the corresponding vectors. */
-    const int ind = MI->second;
-    ++GEMM_Profile_NCalls[ind];
-    GEMM_Profile_TotTime[ind] += val_elapsed_time;
-    GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
-    GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+      /* Entry is already present. Determine its index in the
+         map and update the corresponding vectors. */
+      const int ind = MI->second;
+      ++GEMM_Profile_NCalls[ind];
+      GEMM_Profile_TotTime[ind] += val_elapsed_time;
+      GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
+      GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+    }
   }
+  END_SU2_OMP_CRITICAL
 
 #endif
 
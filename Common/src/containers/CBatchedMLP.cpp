@@ -0,0 +1,388 @@
+/*!
+ * \file CBatchedMLP.cpp
+ * \brief Batched evaluation of multi-layer perceptrons stored in the MLPCpp file format.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/containers/CBatchedMLP.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+#include "../../include/parallelization/mpi_structure.hpp"
+
+using namespace std;
+
+namespace {
+
+/*--- Next non-empty line without trailing whitespace, false at the end of the file. ---*/
+bool NextLine(ifstream& file, string& line) {
+  while (getline(file, line)) {
+    const auto end = line.find_last_not_of(" \n\r\t\f\v");
+    if (end == string::npos) continue;
+    line.resize(end + 1);
+    return true;
+  }
+  return false;
+}
+
+void SkipTo(ifstream& file, const string& flag, const string& fileName) {
+  string line;
+  while (NextLine(file, line)) {
+    if (line == flag) return;
+  }
+  SU2_MPI::Error("Flag " + flag + " not found in file " + fileName, CURRENT_FUNCTION);
+}
+
+/*--- Value, first, and second derivative of the activation functions. ---*/
+template <class Activation>
+inline void Activate(Activation kind, su2double x, su2double& f, su2double& df, su2double& d2f) {
+  switch (kind) {
+    case Activation::LINEAR:
+      f = x;
+      df = 1;
+      d2f = 0;
+      break;
+    case Activation::RELU:
+      f = (x > 0) ? x : su2double(0);
+      df = (x > 0) ? 1 : 0;
+      d2f = 0;
+      break;
+    case Activation::ELU:
+      if (x > 0) {
+        f = x;
+        df = 1;
+        d2f = 0;
+      } else {
+        df = exp(x);
+        d2f = df;
+        f = df - 1;
+      }
+      break;
+    case Activation::EXPONENTIAL:
+      f = exp(x);
+      df = f;
+      d2f = f;
+      break;
+    case Activation::SIGMOID: {
+      const su2double s = 1 / (1 + exp(-x));
+      f = s;
+      df = s * (1 - s);
+      d2f = df * (1 - 2 * s);
+      break;
+    }
+    case Activation::SWISH: {
+      const su2double s = 1 / (1 + exp(-x)), ds = s * (1 - s);
+      f = x * s;
+      df = s + x * ds;
+      d2f = ds * (2 + x * (1 - 2 * s));
+      break;
+    }
+    case Activation::TANH: {
+      const su2double t = tanh(x);
+      f = t;
+      df = 1 - t * t;
+      d2f = -2 * t * df;
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+CBatchedMLP::CBatchedMLP(unsigned short nNetworks, const string* fileNames) {
+  networks.reserve(nNetworks);
+  for (auto iNetwork = 0u; iNetwork < nNetworks; ++iNetwork) networks.push_back(ReadNetwork(fileNames[iNetwork]));
+}
+
+CBatchedMLP::CNetwork CBatchedMLP::ReadNetwork(const string& fileName) {
+  ifstream file(fileName);
+  if (!file.is_open()) SU2_MPI::Error("There is no MLP file called " + fileName, CURRENT_FUNCTION);
+
+  CNetwork network;
+  string line;
+
+  auto readNames = [&](unsigned long n, vector<string>& names) {
+    names.resize(n);
+    for (auto& name : names) NextLine(file, name);
+  };
+  auto readNorm = [&](unsigned long n, vector<pair<su2double, su2double>>& norm) {
+    norm.resize(n);
+    for (auto& minMax : norm) {
+      NextLine(file, line);
+      istringstream stream(line);
+      passivedouble lower, upper;
+      stream >> lower >> upper;
+      minMax = {lower, upper};
+    }
+  };
+
+  /*--- Header, architecture and normalization. ---*/
+  SkipTo(file, "<header>", fileName);
+  while (NextLine(file, line) && line != "</header>") {
+    if (line == "[number of layers]") {
+      NextLine(file, line);
+      network.nNeurons.resize(stoul(line));
+    } else if (line == "[neurons per layer]") {
+      for (auto& n : network.nNeurons) {
+        NextLine(file, line);
+        n = stoul(line);
+      }
+    } else if (line == "[activation function]") {
+      network.activation.resize(network.nNeurons.size());
+      for (auto& kind : network.activation) {
+        NextLine(file, line);
+        transform(line.begin(), line.end(), line.begin(), ::tolower);
+        if (line == "linear") kind = ACTIVATION::LINEAR;
+        else if (line == "relu") kind = ACTIVATION::RELU;
+        else if (line == "elu") kind = ACTIVATION::ELU;
+        else if (line == "exponential") kind = ACTIVATION::EXPONENTIAL;
+        else if (line == "sigmoid") kind = ACTIVATION::SIGMOID;
+        else if (line == "swish") kind = ACTIVATION::SWISH;
+        else if (line == "tanh") kind = ACTIVATION::TANH;
+        else network.supported = false;
+      }
+    } else if (line == "[input names]") {
+      readNames(network.nNeurons.front(), network.inputNames);
+    } else if (line == "[output names]") {
+      readNames(network.nNeurons.back(), network.outputNames);
+    } else if (line == "[input normalization]") {
+      readNorm(network.nNeurons.front(), network.inputNorm);
+    } else if (line == "[output normalization]") {
+      readNorm(network.nNeurons.back(), network.outputNorm);
+    } else if (line == "[input regularization method]" || line == "[output regularization method]") {
+      NextLine(file, line);
+      if (line != "minmax") network.supported = false;
+    }
+  }
+  const auto nLayer = network.nNeurons.size();
+  if (nLayer < 2 || network.activation.size() != nLayer || network.inputNorm.size() != network.nNeurons.front() ||
+      network.outputNorm.size() != network.nNeurons.back()) {
+    SU2_MPI::Error("Incomplete header in MLP file " + fileName, CURRENT_FUNCTION);
+  }
+  /*--- The input layer passes the normalized inputs. ---*/
+  if (network.activation.front() != ACTIVATION::LINEAR) network.supported = false;
+
+  /*--- Weights, one block per pair of consecutive layers, one row per neuron of the first layer. ---*/
+  SkipTo(file, "[weights per layer]", fileName);
+  network.weights.resize(nLayer);
+  for (auto iLayer = 1ul; iLayer < nLayer; ++iLayer) {
+    auto& weights = network.weights[iLayer];
+    weights.resize(network.nNeurons[iLayer], network.nNeurons[iLayer - 1]);
+    SkipTo(file, "<layer>", fileName);
+    for (auto jNeuron = 0ul; jNeuron < network.nNeurons[iLayer - 1]; ++jNeuron) {
+      NextLine(file, line);
+      istringstream stream(line);
+      for (auto iNeuron = 0ul; iNeuron < network.nNeurons[iLayer]; ++iNeuron) {
+        passivedouble value;
+        stream >> value;
+        weights(iNeuron, jNeuron) = value;
+      }
+    }
+  }
+
+  /*--- Biases, one row per layer. ---*/
+  SkipTo(file, "[biases per layer]", fileName);
+  network.biases.resize(nLayer);
+  for (auto iLayer = 0ul; iLayer < nLayer; ++iLayer) {
+    NextLine(file, line);
+    istringstream stream(line);
+    for (auto iNeuron = 0ul; iNeuron < network.nNeurons[iLayer]; ++iNeuron) {
+      passivedouble value;
+      stream >> value;
+      network.biases[iLayer].push_back(value);
+    }
+  }
+  if (!file) SU2_MPI::Error("Incomplete weights or biases in MLP file " + fileName, CURRENT_FUNCTION);
+
+  return network;
+}
+
+unsigned short CBatchedMLP::PairVariables(const vector<string>& inputNames, const vector<string>& outputNames) {
+  CMap map;
+  map.nInput = inputNames.size();
+  map.nOutput = outputNames.size();
+  vector<bool> found(map.nOutput, false);
+
+  for (auto iNetwork = 0ul; iNetwork < networks.size(); ++iNetwork) {
+    const auto& network = networks[iNetwork];
+
+    /*--- All the inputs of the network must be inputs of the map. ---*/
+    vector<unsigned short> inputIndex;
+    for (const auto& name : network.inputNames) {
+      const auto it = find(inputNames.begin(), inputNames.end(), name);
+      if (it == inputNames.end()) break;
+      inputIndex.push_back(it - inputNames.begin());
+    }
+    if (inputIndex.size() != network.inputNames.size()) continue;
+
+    /*--- The outputs not found in a previous network. ---*/
+    vector<pair<unsigned long, unsigned short>> outputIndex;
+    for (auto iOutput = 0ul; iOutput < network.outputNames.size(); ++iOutput) {
+      for (auto jOutput = 0u; jOutput < map.nOutput; ++jOutput) {
+        if (!found[jOutput] && outputNames[jOutput] == network.outputNames[iOutput]) {
+          found[jOutput] = true;
+          outputIndex.emplace_back(iOutput, jOutput);
+        }
+      }
+    }
+    if (outputIndex.empty()) continue;
+
+    map.iNetwork.push_back(iNetwork);
+    map.inputIndex.push_back(move(inputIndex));
+    map.outputIndex.push_back(move(outputIndex));
+    map.supported &= network.supported;
+  }
+  for (auto iOutput = 0u; iOutput < map.nOutput; ++iOutput) {
+    if (!found[iOutput]) map.missing.push_back(iOutput);
+  }
+
+  maps.push_back(move(map));
+  return maps.size() - 1;
+}
+
+const su2double* CBatchedMLP::Evaluate(const CNetwork& network, unsigned long nPoint, unsigned long nBlock) {
+  const auto nInput = network.nNeurons.front();
+  const auto nCol = nPoint * nBlock;
+  const bool firstDerivatives = nBlock > 1, secondDerivatives = nBlock > 1 + nInput;
+  int current = 0;
+
+  for (auto iLayer = 1ul; iLayer < network.nNeurons.size(); ++iLayer) {
+    const auto nOut = network.nNeurons[iLayer];
+    const auto& y = work[current];
+    auto& z = work[1 - current];
+    if (z.size() < nOut * nCol) z.resize(nOut * nCol);
+
+    /*--- One product for the values and derivatives of all the points. ---*/
+    blas.gemm(nOut, nCol, network.nNeurons[iLayer - 1], network.weights[iLayer].data(), y.data(), z.data(), nullptr);
+
+    /*--- Bias of the values, and activation function with the chain rule for the derivatives. ---*/
+    const auto kind = network.activation[iLayer];
+    for (auto iNeuron = 0ul; iNeuron < nOut; ++iNeuron) {
+      su2double* value = z.data() + iNeuron * nCol;
+      su2double* d = value + nPoint;
+      su2double* d2 = d + nInput * nPoint;
+      const su2double bias = network.biases[iLayer][iNeuron];
+
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        su2double f, df, d2f;
+        Activate(kind, value[iPoint] + bias, f, df, d2f);
+        value[iPoint] = f;
+        if (!firstDerivatives) continue;
+
+        if (secondDerivatives) {
+          for (auto iInput = 0ul; iInput < nInput; ++iInput) {
+            for (auto jInput = 0ul; jInput < nInput; ++jInput) {
+              auto& d2ij = d2[(iInput * nInput + jInput) * nPoint + iPoint];
+              d2ij = d2f * d[iInput * nPoint + iPoint] * d[jInput * nPoint + iPoint] + df * d2ij;
+            }
+          }
+        }
+        for (auto iInput = 0ul; iInput < nInput; ++iInput) d[iInput * nPoint + iPoint] *= df;
+      }
+    }
+    current = 1 - current;
+  }
+  return work[current].data();
+}
+
+unsigned long CBatchedMLP::Predict(unsigned short iMap, unsigned long nPoint, const su2activematrix& inputs,
+                                   su2activematrix& outputs, unsigned long* extrapolation,
+                                   su2activematrix* dOutputs, su2activematrix* d2Outputs) {
+  const auto& map = maps[iMap];
+  outside.assign(nPoint, 0);
+
+  for (const auto iOutput : map.missing)
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) outputs(iOutput, iPoint) = 0;
+
+  if (dOutputs) {
+    for (auto iRow = 0ul; iRow < map.nOutput * map.nInput; ++iRow)
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) (*dOutputs)(iRow, iPoint) = 0;
+  }
+  if (d2Outputs) {
+    for (auto iRow = 0ul; iRow < map.nOutput * map.nInput * map.nInput; ++iRow)
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) (*d2Outputs)(iRow, iPoint) = 0;
+  }
+
+  for (auto i = 0ul; i < map.iNetwork.size(); ++i) {
+    const auto& network = networks[map.iNetwork[i]];
+    const auto& inputIndex = map.inputIndex[i];
+    const auto nInput = network.nNeurons.front();
+    const unsigned long nBlock = 1 + (dOutputs ? nInput : 0) + (d2Outputs ? nInput * nInput : 0);
+    const auto nCol = nPoint * nBlock;
+
+    /*--- Normalized inputs, their derivatives are the unit vectors, and the second derivatives vanish. ---*/
+    auto& input = work[0];
+    if (input.size() < nInput * nCol) input.resize(nInput * nCol);
+    fill(input.begin(), input.begin() + nInput * nCol, su2double(0));
+
+    for (auto iInput = 0ul; iInput < nInput; ++iInput) {
+      const auto& norm = network.inputNorm[iInput];
+      su2double* row = input.data() + iInput * nCol;
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        const su2double x = inputs(inputIndex[iInput], iPoint);
+        if (x < norm.first || x > norm.second) outside[iPoint] = 1;
+        row[iPoint] = (x - norm.first) / (norm.second - norm.first);
+        if (dOutputs) row[(1 + iInput) * nPoint + iPoint] = 1;
+      }
+    }
+
+    const su2double* result = Evaluate(network, nPoint, nBlock);
+
+    /*--- Undo the normalization of the outputs (and of the inputs for the derivatives). ---*/
+    for (const auto& index : map.outputIndex[i]) {
+      const auto& norm = network.outputNorm[index.first];
+      const su2double scale = norm.second - norm.first;
+      const su2double* value = result + index.first * nCol;
+
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) outputs(index.second, iPoint) = value[iPoint] * scale + norm.first;
+      if (!dOutputs) continue;
+
+      for (auto iInput = 0ul; iInput < nInput; ++iInput) {
+        const auto& normI = network.inputNorm[iInput];
+        const su2double scaleI = scale / (normI.second - normI.first);
+        const auto row = index.second * map.nInput + inputIndex[iInput];
+        const su2double* d = value + (1 + iInput) * nPoint;
+        for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) (*dOutputs)(row, iPoint) = d[iPoint] * scaleI;
+
+        if (!d2Outputs) continue;
+        for (auto jInput = 0ul; jInput < nInput; ++jInput) {
+          const auto& normJ = network.inputNorm[jInput];
+          const su2double scaleIJ = scaleI / (normJ.second - normJ.first);
+          const su2double* d2 = value + (1 + nInput + iInput * nInput + jInput) * nPoint;
+          for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+            (*d2Outputs)(row * map.nInput + inputIndex[jInput], iPoint) = d2[iPoint] * scaleIJ;
+        }
+      }
+    }
+  }
+
+  unsigned long nOutside = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    extrapolation[iPoint] = outside[iPoint];
+    nOutside += outside[iPoint];
+  }
+  return nOutside;
+}
@@ -53,6 +53,8 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   IdentifyUniqueEdges();
 
+  IdentifyTriangleNeighbors();
+
   if (rank == MASTER_NODE) cout << " done." << endl;
 
   PrintTableInfo();
@@ -138,6 +140,8 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   interp_mat_inv_x_y.resize(n_table_levels);
   edges.resize(n_table_levels);
   edge_to_triangle.resize(n_table_levels);
+  triangle_neighbors.resize(n_table_levels);
+  last_triangle.resize(n_table_levels) = NO_TRIANGLE;
 
   for (unsigned long i_level = 0; i_level < n_table_levels; i_level++) {
     n_points[i_level] = file_reader.GetNPoints(i_level);
@@ -359,6 +363,29 @@ void CLookUpTable::IdentifyUniqueEdges() {
   }
 }
 
+void CLookUpTable::IdentifyTriangleNeighbors() {
+  for (auto i_level = 0u; i_level < n_table_levels; i_level++) {
+    triangle_neighbors[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE) = NO_TRIANGLE;
+
+    /* the neighbor across an edge is stored at the position of the vertex of the triangle that
+       is not on that edge, edges on the hull only have one triangle */
+    for (auto iEdge = 0u; iEdge < edges[i_level].size(); iEdge++) {
+      const auto& edge_triangles = edge_to_triangle[i_level][iEdge];
+      if (edge_triangles.size() != 2) continue;
+
+      for (auto iSide = 0u; iSide < 2; iSide++) {
+        const auto iTriangle = edge_triangles[iSide];
+        for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++) {
+          const auto iPoint = triangles[i_level][iTriangle][iVertex];
+          if (iPoint != edges[i_level][iEdge][0] && iPoint != edges[i_level][iEdge][1]) {
+            triangle_neighbors[i_level][iTriangle][iVertex] = edge_triangles[1 - iSide];
+          }
+        }
+      }
+    }
+  }
+}
+
 void CLookUpTable::ComputeInterpCoeffs() {
   for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
     /* build KD tree for y, x space */
@@ -370,21 +397,19 @@ void CLookUpTable::ComputeInterpCoeffs() {
 
     /* calculate weights for each triangle (basically a distance function) and
      * build inverse interpolation matrices */
-    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level]);
+    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE * N_POINTS_TRIANGLE);
     for (auto i_triangle = 0u; i_triangle < n_triangles[i_level]; i_triangle++) {
       for (auto p = 0u; p < N_POINTS_TRIANGLE; p++) {
         next_triangle[p] = triangles[i_level][i_triangle][p];
       }
 
-      su2activematrix x_interp_mat_inv(N_POINTS_TRIANGLE, N_POINTS_TRIANGLE);
-      GetInterpMatInv(val_CV1, val_CV2, next_triangle, x_interp_mat_inv);
-      interp_mat_inv_x_y[i_level][i_triangle] = x_interp_mat_inv;
+      GetInterpMatInv(val_CV1, val_CV2, next_triangle, interp_mat_inv_x_y[i_level][i_triangle]);
     }
   }
 }
 
 void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_y,
-                                   std::array<unsigned long, 3>& point_ids, su2activematrix& interp_mat_inv) {
+                                   std::array<unsigned long, 3>& point_ids, su2double* interp_mat_inv) {
   CSquareMatrixCM global_M(N_POINTS_TRIANGLE);
 
   /* setup LHM matrix for the interpolation */
@@ -402,7 +427,7 @@ void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_
 
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      interp_mat_inv[i][j] = global_M(i, j);
+      interp_mat_inv[i * N_POINTS_TRIANGLE + j] = global_M(i, j);
     }
   }
 }
@@ -572,17 +597,15 @@ std::array<std::array<su2double, 2>, 2> CLookUpTable::ComputeNormalizedXY(
 bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2double>& val_vars, const su2double val_CV1,
                              const su2double val_CV2, unsigned long i_level) {
   unsigned long id_triangle;
-  bool inside = FindInclusionTriangle(val_CV1, val_CV2, id_triangle, i_level);
+  std::array<su2double, 3> interp_coeffs{0};
+  bool inside = FindInclusionTriangle(val_CV1, val_CV2, id_triangle, interp_coeffs, i_level);
 
   /* loop over variable names and interpolate / get values */
   if (inside) {
-    std::array<su2double, 3> interp_coeffs{0};
     std::array<unsigned long, 3> triangle{0};
     for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++)
       triangle[iVertex] = triangles[i_level][id_triangle][iVertex];
 
-    GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
-
     for (auto iVar = 0u; iVar < idx_var.size(); iVar++) {
       if (idx_var[iVar] == idx_null) {
         val_vars[iVar] = 0;
@@ -615,23 +638,101 @@ bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2dou
   return inside;
 }
 
+unsigned long CLookUpTable::LookUpBatch_XY(const std::vector<unsigned long>& idx_var, unsigned long n_points,
+                                           const su2double* val_CV1, const su2double* val_CV2,
+                                           su2activematrix& val_vars, bool* inside, const unsigned long i_level) {
+  /* locate all the query points first, each search starts from the triangle of the previous point */
+  vector<unsigned long> id_triangle(n_points);
+  vector<std::array<su2double, 3>> interp_coeffs(n_points);
+  vector<bool> point_inside(n_points);
+  unsigned long n_outside = 0;
+
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    point_inside[iPoint] =
+        FindInclusionTriangle(val_CV1[iPoint], val_CV2[iPoint], id_triangle[iPoint], interp_coeffs[iPoint], i_level);
+    n_outside += !point_inside[iPoint];
+    if (inside) inside[iPoint] = point_inside[iPoint];
+  }
+
+  /* interpolate one variable at a time for all points */
+  for (auto iVar = 0u; iVar < idx_var.size(); iVar++) {
+    if (idx_var[iVar] == idx_null) {
+      for (auto iPoint = 0ul; iPoint < n_points; iPoint++) val_vars(iVar, iPoint) = 0;
+      continue;
+    }
+    const su2double* val_samples = table_data[i_level][idx_var[iVar]];
+
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      if (!point_inside[iPoint]) continue;
+      const auto* triangle = triangles[i_level][id_triangle[iPoint]];
+      su2double result = 0;
+      for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++)
+        result += interp_coeffs[iPoint][iVertex] * val_samples[triangle[iVertex]];
+      val_vars(iVar, iPoint) = result;
+    }
+  }
+
+  /* points outside the data set use the values of the nearest neighbors */
+  if (n_outside > 0) {
+    vector<su2double> var_vals(idx_var.size());
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      if (point_inside[iPoint]) continue;
+      InterpolateToNearestNeighbors(val_CV1[iPoint], val_CV2[iPoint], idx_var, var_vals, i_level);
+      for (auto iVar = 0u; iVar < idx_var.size(); iVar++) val_vars(iVar, iPoint) = var_vals[iVar];
+    }
+  }
+
+  return n_outside;
+}
+
 bool CLookUpTable::FindInclusionTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
-                                         const unsigned long iLevel) {
+                                         std::array<su2double, 3>& interp_coeffs, const unsigned long iLevel) {
   /* check if x value is in table x-dimension range
    * and if y is in table y-dimension table range */
   if ((val_CV1 >= *limits_table_x[iLevel].first && val_CV1 <= *limits_table_x[iLevel].second) &&
       (val_CV2 >= *limits_table_y[iLevel].first && val_CV2 <= *limits_table_y[iLevel].second)) {
-    /* if so, try to find the triangle that holds the (prog, enth) point */
+    /* try walking from the previous inclusion triangle first */
+    if (WalkToTriangle(val_CV1, val_CV2, id_triangle, interp_coeffs, iLevel)) {
+      last_triangle[iLevel] = id_triangle;
+      return true;
+    }
+
+    /* if that fails, find the triangle that holds the (prog, enth) point with the trapezoidal map */
     id_triangle = trap_map_x_y[iLevel].GetTriangle(val_CV1, val_CV2);
 
     /* check if point is inside a triangle (if table domain is non-rectangular,
      * the previous range check might be true but the point could still be outside of the domain) */
-    return IsInTriangle(val_CV1, val_CV2, id_triangle, iLevel);
+    if (IsInTriangle(val_CV1, val_CV2, id_triangle, iLevel)) {
+      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[iLevel][id_triangle], interp_coeffs);
+      last_triangle[iLevel] = id_triangle;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CLookUpTable::WalkToTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
+                                  std::array<su2double, 3>& interp_coeffs, const unsigned long iLevel) const {
+  id_triangle = last_triangle[iLevel];
+
+  for (auto iStep = 0u; iStep < MAX_WALK_STEPS && id_triangle != NO_TRIANGLE; iStep++) {
+    GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[iLevel][id_triangle], interp_coeffs);
+
+    /* the query point is inside if all barycentric coordinates are non-negative */
+    auto iMin = 0u;
+    for (auto iVertex = 1u; iVertex < N_POINTS_TRIANGLE; iVertex++) {
+      if (interp_coeffs[iVertex] < interp_coeffs[iMin]) iMin = iVertex;
+    }
+    if (interp_coeffs[iMin] >= 0) return true;
+
+    /* otherwise move to the neighbor across the edge opposite to the most negative coordinate,
+       the walk stops if this edge is on the hull */
+    id_triangle = triangle_neighbors[iLevel](id_triangle, iMin);
   }
   return false;
 }
 
-void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                                    std::array<su2double, N_POINTS_TRIANGLE>& interp_coeffs) const {
   std::array<su2double, N_POINTS_TRIANGLE> query_vector = {1, val_CV1, val_CV2};
 
@@ -639,7 +740,7 @@ void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const s
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     d = 0;
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      d = d + interp_mat_inv[i][j] * query_vector[j];
+      d = d + interp_mat_inv[i * N_POINTS_TRIANGLE + j] * query_vector[j];
     }
     interp_coeffs[i] = d;
   }
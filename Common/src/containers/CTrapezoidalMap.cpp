@@ -185,22 +185,22 @@ unsigned long CTrapezoidalMap::GetTriangle(const su2double val_x, const su2doubl
   /* within that band, find edges which enclose the (val_x, val_y) point */
   pair<unsigned long, unsigned long> edges = GetEdges(band, val_x, val_y);
 
-  /* identify the adjacent triangles using the two edges */
+  /* identify the adjacent triangles using the two edges (edges on the hull only have one) */
   std::array<unsigned long, 2> triangles_edge_low;
-  for (unsigned long i = 0; i < edge_to_triangle[edges.first].size(); i++)
-    triangles_edge_low[i] = edge_to_triangle[edges.first][i];
+  const auto n_low = edge_to_triangle[edges.first].size();
+  for (unsigned long i = 0; i < n_low; i++) triangles_edge_low[i] = edge_to_triangle[edges.first][i];
 
   std::array<unsigned long, 2> triangles_edge_up;
-  for (unsigned long i = 0; i < edge_to_triangle[edges.second].size(); i++)
-    triangles_edge_up[i] = edge_to_triangle[edges.second][i];
+  const auto n_up = edge_to_triangle[edges.second].size();
+  for (unsigned long i = 0; i < n_up; i++) triangles_edge_up[i] = edge_to_triangle[edges.second][i];
 
-  sort(triangles_edge_low.begin(), triangles_edge_low.end());
-  sort(triangles_edge_up.begin(), triangles_edge_up.end());
+  sort(triangles_edge_low.begin(), triangles_edge_low.begin() + n_low);
+  sort(triangles_edge_up.begin(), triangles_edge_up.begin() + n_up);
 
   /* The intersection of the faces to which upper or lower belongs is the face that both belong to. */
   vector<unsigned long> triangle;
-  set_intersection(triangles_edge_up.begin(), triangles_edge_up.end(), triangles_edge_low.begin(),
-                   triangles_edge_low.end(), std::back_inserter(triangle));
+  set_intersection(triangles_edge_up.begin(), triangles_edge_up.begin() + n_up, triangles_edge_low.begin(),
+                   triangles_edge_low.begin() + n_low, std::back_inserter(triangle));
 
   /*--- We failed to find an intersection, so take the lower triangle inside the band enclosing the point---*/
   if (triangle.size() < 1) {
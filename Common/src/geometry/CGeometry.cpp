@@ -95,11 +95,14 @@ CGeometry::~CGeometry() {
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
   delete[] bufD_P2PRecv;
-  delete[] bufD_P2PSend;
+  delete[] bufD_P2PSendLocal;
 
   delete[] bufS_P2PRecv;
   delete[] bufS_P2PSend;
 
+  FreePersistentP2PRequests();
+  FreeSharedP2PComms();
+
   delete[] req_P2PSend;
   delete[] req_P2PRecv;
 
@@ -272,6 +275,7 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
    the previously allocated memory is not sufficient. ---*/
 
   bufD_P2PSend = nullptr;
+  bufD_P2PSendLocal = nullptr;
   bufD_P2PRecv = nullptr;
 
   bufS_P2PSend = nullptr;
@@ -326,9 +330,52 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
     }
   }
 
-  /*--- In the future, some additional data structures could be created
-   here to separate the interior and boundary nodes in order to help
-   further overlap computation and communication. ---*/
+  /*--- Persistent requests are created on first use for each type of comms. They are not used
+   *    with AD types, which the MPI wrapper needs to record for the reverse sweep. ---*/
+
+  FreePersistentP2PRequests();
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  persistentP2P = config->GetP2PPersistentRequests();
+#endif
+
+  /*--- Shared send buffers for the neighbors on the same node. ---*/
+
+  SetSharedP2PComms(config);
+
+  /*--- Separate the interior and boundary nodes to overlap computation and communication. ---*/
+
+  SetCommOverlapPoints(config);
+}
+
+void CGeometry::SetCommOverlapPoints(const CConfig* config) {
+  pointsBeforeComms.clear();
+  pointsDuringComms.clear();
+
+  /*--- Periodic comms need all the contributions to be computed first. ---*/
+
+  commOverlap = config->GetCommOverlap() && (config->GetnMarker_Periodic() == 0);
+  if (!commOverlap) return;
+
+  /*--- Points on markers receive boundary contributions after the point loops, and
+   *    points that are sent must be final before the buffers are packed. ---*/
+
+  vector<bool> beforeComms(nPointDomain, false);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) beforeComms[iPoint] = nodes->GetBoundary(iPoint);
+
+  if (nP2PSend > 0) {
+    for (auto iSend = 0; iSend < nPoint_P2PSend[nP2PSend]; ++iSend) {
+      const auto iPoint = Local_Point_P2PSend[iSend];
+      if (iPoint < nPointDomain) beforeComms[iPoint] = true;
+    }
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    if (beforeComms[iPoint])
+      pointsBeforeComms.push_back(iPoint);
+    else
+      pointsDuringComms.push_back(iPoint);
+  }
 }
 
 void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
@@ -339,32 +386,70 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
    reallocate a large enough array. Note that after the first set
    communications, this routine will not need to be called again. ---*/
 
-  if (countPerPoint <= maxCountPerPoint) return;
+  if (countPerPoint > maxCountPerPoint) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      /*--- Persistent requests refer to the old buffers. ---*/
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    /*--- Store the larger packet size to the class data. ---*/
+      FreePersistentP2PRequests();
+
+      /*--- Store the larger packet size to the class data. ---*/
+
+      maxCountPerPoint = countPerPoint;
 
-    maxCountPerPoint = countPerPoint;
+      /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
-    /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
+      delete[] bufD_P2PSendLocal;
+      bufD_P2PSendLocal = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+      bufD_P2PSend = bufD_P2PSendLocal;
 
-    delete[] bufD_P2PSend;
-    bufD_P2PSend = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+      delete[] bufD_P2PRecv;
+      bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+
+      delete[] bufS_P2PSend;
+      bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+
+      delete[] bufS_P2PRecv;
+      bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
 
-    delete[] bufD_P2PRecv;
-    bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+  /*--- With the shared-memory transport, the data is packed alternately in each half of the shared
+   send buffer. Neighbors on the same node read one half while the next comms are packed in the
+   other, and before packing in the same half again, the comms in between must have completed,
+   which requires a message from each of those neighbors. Comms that do not fit in the shared
+   buffer are sent from the private one. Every rank calls this routine for every exchange, the
+   parity of both sides of a comm is therefore the same. ---*/
 
-    delete[] bufS_P2PSend;
-    bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+  if (sharedP2PCountPerPoint == 0) return;
 
-    delete[] bufS_P2PRecv;
-    bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    sharedP2PParity = 1 - sharedP2PParity;
+    if (countPerPoint <= sharedP2PCountPerPoint) {
+      const auto halfSize = size_t(sharedP2PCountPerPoint) * nPoint_P2PSend[nP2PSend];
+      bufD_P2PSend = bufD_P2PSendShared + sharedP2PParity * halfSize;
+    } else {
+      bufD_P2PSend = bufD_P2PSendLocal;
+    }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, bool val_reverse) const {
+  /*--- Restart the persistent requests. The handles are copied into the usual request
+   array, such that completing the comms does not depend on the kind of request. ---*/
+
+  if (persistentP2P) {
+    SU2_OMP_MASTER {
+      const auto& requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
+      copy(requests.recv.begin(), requests.recv.end(), req_P2PRecv);
+      SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -431,6 +516,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
       auto count = countPerPoint * nPointP2P;
 
+      /*--- Neighbors on the same node only send a flag, the data is read from their shared buffer. ---*/
+
+      if (SharedP2PComms(commType, countPerPoint, val_reverse) && sharedP2PRecv[iRecv].buffer) count = 0;
+
       /*--- Get the rank from which we receive the message. ---*/
 
       auto source = Neighbors_P2PRecv[iRecv];
@@ -458,6 +547,17 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
 void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, int val_iSend, bool val_reverse) const {
+  if (persistentP2P) {
+    SU2_OMP_MASTER {
+      if (SharedP2PComms(commType, countPerPoint, val_reverse) && sharedP2PSend[val_iSend]) SyncSharedP2PComms();
+      const auto& requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
+      req_P2PSend[val_iSend] = requests.send[val_iSend];
+      SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
   /*--- In some instances related to the adjoint solver, we need
@@ -519,6 +619,13 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
 
     auto count = countPerPoint * nPointP2P;
 
+    /*--- Neighbors on the same node read the data from our shared buffer, we only send a flag. ---*/
+
+    if (SharedP2PComms(commType, countPerPoint, val_reverse) && sharedP2PSend[val_iSend]) {
+      count = 0;
+      SyncSharedP2PComms();
+    }
+
     /*--- Get the rank to which we send the message. ---*/
 
     auto dest = Neighbors_P2PSend[val_iSend];
@@ -543,6 +650,217 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
   END_SU2_OMP_MASTER
 }
 
+const CGeometry::CP2PPersistentRequests& CGeometry::GetPersistentP2PRequests(unsigned short commType,
+                                                                            unsigned short countPerPoint,
+                                                                            bool reverse) const {
+  auto& requests = persistentP2PRequests[make_tuple(commType, countPerPoint, reverse, sharedP2PParity)];
+
+  if (requests.recv.size() == size_t(nP2PRecv) && requests.send.size() == size_t(nP2PSend)) return requests;
+
+  requests.recv.resize(nP2PRecv);
+  requests.send.resize(nP2PSend);
+
+  /*--- Same buffers, offsets, counts, and neighbors as in PostP2PRecvs and PostP2PSends,
+   *    the roles of the send and recv data structures are swapped in reverse mode. ---*/
+
+  const auto* recvOffsets = reverse ? nPoint_P2PSend : nPoint_P2PRecv;
+  const auto* recvRanks = reverse ? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const auto* sendOffsets = reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+  const auto* sendRanks = reverse ? Neighbors_P2PRecv : Neighbors_P2PSend;
+  const bool shared = SharedP2PComms(commType, countPerPoint, reverse);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto offset = countPerPoint * recvOffsets[iRecv];
+    const auto count =
+        shared && sharedP2PRecv[iRecv].buffer ? 0 : countPerPoint * (recvOffsets[iRecv + 1] - recvOffsets[iRecv]);
+    const auto source = recvRanks[iRecv];
+    const auto tag = source + 1;
+
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        SU2_MPI::Recv_init(&((reverse ? bufD_P2PSend : bufD_P2PRecv)[offset]), count, MPI_DOUBLE, source, tag,
+                           SU2_MPI::GetComm(), &(requests.recv[iRecv]));
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        SU2_MPI::Recv_init(&((reverse ? bufS_P2PSend : bufS_P2PRecv)[offset]), count, MPI_UNSIGNED_SHORT, source,
+                           tag, SU2_MPI::GetComm(), &(requests.recv[iRecv]));
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const auto offset = countPerPoint * sendOffsets[iSend];
+    const auto count =
+        shared && sharedP2PSend[iSend] ? 0 : countPerPoint * (sendOffsets[iSend + 1] - sendOffsets[iSend]);
+    const auto dest = sendRanks[iSend];
+    const auto tag = rank + 1;
+
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        SU2_MPI::Send_init(&((reverse ? bufD_P2PRecv : bufD_P2PSend)[offset]), count, MPI_DOUBLE, dest, tag,
+                           SU2_MPI::GetComm(), &(requests.send[iSend]));
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        SU2_MPI::Send_init(&((reverse ? bufS_P2PRecv : bufS_P2PSend)[offset]), count, MPI_UNSIGNED_SHORT, dest, tag,
+                           SU2_MPI::GetComm(), &(requests.send[iSend]));
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+  return requests;
+}
+
+void CGeometry::FreePersistentP2PRequests() {
+  for (auto& entry : persistentP2PRequests) {
+    for (auto& request : entry.second.recv) SU2_MPI::Request_free(&request);
+    for (auto& request : entry.second.send) SU2_MPI::Request_free(&request);
+  }
+  persistentP2PRequests.clear();
+}
+
+void CGeometry::SetSharedP2PComms(const CConfig* config) {
+  FreeSharedP2PComms();
+
+#if defined(HAVE_MPI) && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  const auto countPerPoint = config->GetP2PSharedMemoryCount();
+  if (countPerPoint == 0) return;
+
+  /*--- Group the ranks that can share memory, and find which neighbors are in that group. ---*/
+
+  MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &sharedP2PComm);
+
+  MPI_Group group, sharedGroup;
+  MPI_Comm_group(SU2_MPI::GetComm(), &group);
+  MPI_Comm_group(sharedP2PComm, &sharedGroup);
+
+  vector<int> sharedRankSend(nP2PSend), sharedRankRecv(nP2PRecv);
+  MPI_Group_translate_ranks(group, nP2PSend, Neighbors_P2PSend, sharedGroup, sharedRankSend.data());
+  MPI_Group_translate_ranks(group, nP2PRecv, Neighbors_P2PRecv, sharedGroup, sharedRankRecv.data());
+
+  MPI_Group_free(&group);
+  MPI_Group_free(&sharedGroup);
+
+  /*--- Each rank allocates its part of the window, two halves large enough for all its sends. ---*/
+
+  const auto halfSize = size_t(countPerPoint) * nPoint_P2PSend[nP2PSend];
+  MPI_Win_allocate_shared(2 * halfSize * sizeof(su2double), sizeof(su2double), MPI_INFO_NULL, sharedP2PComm,
+                          &bufD_P2PSendShared, &sharedP2PWin);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, sharedP2PWin);
+
+  sharedP2PCountPerPoint = countPerPoint;
+
+  /*--- The transport is used between neighbors on the same node that send to each other, since
+   the messages in the opposite direction are what guarantees the shared buffers can be reused
+   (see AllocateP2PComms). Halo layers are symmetric, in practice this is all neighbors. ---*/
+
+  sharedP2PSend.resize(nP2PSend);
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    sharedP2PSend[iSend] = (sharedRankSend[iSend] != MPI_UNDEFINED) && P2PRecv2Neighbor.count(Neighbors_P2PSend[iSend]);
+  }
+
+  /*--- Tell the neighbors where their message starts in our buffer, and how large each half is. ---*/
+
+  vector<unsigned long> sendInfo(2 * nP2PSend), recvInfo(2 * nP2PRecv);
+  vector<SU2_MPI::Request> requests;
+  requests.reserve(nP2PSend + nP2PRecv);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto source = Neighbors_P2PRecv[iRecv];
+    if (sharedRankRecv[iRecv] == MPI_UNDEFINED || !P2PSend2Neighbor.count(source)) continue;
+    requests.emplace_back();
+    SU2_MPI::Irecv(&recvInfo[2 * iRecv], 2, MPI_UNSIGNED_LONG, source, source + 1, SU2_MPI::GetComm(),
+                   &requests.back());
+  }
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    if (!sharedP2PSend[iSend]) continue;
+    sendInfo[2 * iSend] = nPoint_P2PSend[iSend];
+    sendInfo[2 * iSend + 1] = nPoint_P2PSend[nP2PSend];
+    requests.emplace_back();
+    SU2_MPI::Isend(&sendInfo[2 * iSend], 2, MPI_UNSIGNED_LONG, Neighbors_P2PSend[iSend], rank + 1,
+                   SU2_MPI::GetComm(), &requests.back());
+  }
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  sharedP2PRecv.resize(nP2PRecv);
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto source = Neighbors_P2PRecv[iRecv];
+    if (sharedRankRecv[iRecv] == MPI_UNDEFINED || !P2PSend2Neighbor.count(source)) continue;
+
+    MPI_Aint size;
+    int dispUnit;
+    su2double* buffer = nullptr;
+    MPI_Win_shared_query(sharedP2PWin, sharedRankRecv[iRecv], &size, &dispUnit, &buffer);
+
+    sharedP2PRecv[iRecv].buffer = buffer;
+    sharedP2PRecv[iRecv].offset = recvInfo[2 * iRecv];
+    sharedP2PRecv[iRecv].halfSize = recvInfo[2 * iRecv + 1];
+    sharedP2PRecvIndex.push_back(iRecv);
+  }
+#endif
+}
+
+void CGeometry::FreeSharedP2PComms() {
+#ifdef HAVE_MPI
+  if (sharedP2PWin != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(sharedP2PWin);
+    MPI_Win_free(&sharedP2PWin);
+  }
+  if (sharedP2PComm != MPI_COMM_NULL) MPI_Comm_free(&sharedP2PComm);
+#endif
+  bufD_P2PSendShared = nullptr;
+  bufD_P2PSend = bufD_P2PSendLocal;
+  sharedP2PCountPerPoint = 0;
+  sharedP2PParity = 0;
+  sharedP2PSend.clear();
+  sharedP2PRecv.clear();
+  sharedP2PRecvIndex.clear();
+}
+
+void CGeometry::SyncSharedP2PComms() const {
+  /*--- Memory barrier between packing the shared buffer and sending the flag to the neighbors,
+   and between receiving the flags of the neighbors and reading their buffers (see WaitAnyP2PRecv). ---*/
+#if defined(HAVE_MPI) && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  MPI_Win_sync(sharedP2PWin);
+#endif
+}
+
+const su2double* CGeometry::GetP2PRecvBuffer(int iRecv, unsigned short countPerPoint) const {
+  if (SharedP2PComms(COMM_TYPE_DOUBLE, countPerPoint, false) && sharedP2PRecv[iRecv].buffer) {
+    const auto& msg = sharedP2PRecv[iRecv];
+    return msg.buffer + sharedP2PParity * sharedP2PCountPerPoint * msg.halfSize + countPerPoint * msg.offset;
+  }
+  return bufD_P2PRecv + countPerPoint * nPoint_P2PRecv[iRecv];
+}
+
+void CGeometry::WaitAnyP2PRecv(int iMessage, unsigned short commType, unsigned short countPerPoint, bool reverse,
+                               SU2_MPI::Status& status) const {
+#if defined(HAVE_MPI) && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (SharedP2PComms(commType, countPerPoint, reverse) && !sharedP2PRecvIndex.empty()) {
+    const auto nShared = static_cast<int>(sharedP2PRecvIndex.size());
+
+    /*--- The neighbors on the same node are close, waiting for all their flags costs little and
+     allows a single memory barrier for all their buffers. The completed requests become inactive
+     (or null), hence they are ignored by the Waitany below. ---*/
+
+    if (iMessage == 0) {
+      for (const auto iRecv : sharedP2PRecvIndex) SU2_MPI::Wait(&req_P2PRecv[iRecv], MPI_STATUS_IGNORE);
+      SyncSharedP2PComms();
+    }
+    if (iMessage < nShared) {
+      status.MPI_SOURCE = Neighbors_P2PRecv[sharedP2PRecvIndex[iMessage]];
+      return;
+    }
+  }
+#endif
+  int ind;
+  SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+}
+
 void CGeometry::GetCommCountAndType(const CConfig* config, MPI_QUANTITIES commType, unsigned short& COUNT_PER_POINT,
                                     unsigned short& MPI_TYPE) const {
   switch (commType) {
@@ -680,7 +998,7 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
+  int source, iMessage, jRecv;
 
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
@@ -691,8 +1009,8 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  const su2double* bufDRecv = geometry->bufD_P2PRecv;
-  const unsigned short* bufSRecv = geometry->bufS_P2PRecv;
+  const su2double* bufDRecv = nullptr;
+  const unsigned short* bufSRecv = nullptr;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. Note that we
@@ -703,7 +1021,7 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(WaitAnyP2PRecv(iMessage, MPI_TYPE, COUNT_PER_POINT, false, status);)
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -721,15 +1039,21 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
 
     nRecv = nPoint_P2PRecv[jRecv + 1] - nPoint_P2PRecv[jRecv];
 
+    /*--- Get the start of this message, the su2double data of neighbors
+     on the same node may be read directly from their shared buffer. ---*/
+
+    bufDRecv = GetP2PRecvBuffer(jRecv, COUNT_PER_POINT);
+    bufSRecv = geometry->bufS_P2PRecv + msg_offset * COUNT_PER_POINT;
+
     SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for (iRecv = 0; iRecv < nRecv; iRecv++) {
       /*--- Get the local index for this communicated data. ---*/
 
       iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-      /*--- Compute the total offset in the recv buffer for this point. ---*/
+      /*--- Compute the offset in the message for this point. ---*/
 
-      buf_offset = (msg_offset + iRecv) * COUNT_PER_POINT;
+      buf_offset = iRecv * COUNT_PER_POINT;
 
       /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -2347,6 +2671,7 @@ void CGeometry::UpdateGeometry(CGeometry** geometry_container, CConfig* config)
   geometry_container[MESH_0]->SetControlVolume(config, UPDATE);
   geometry_container[MESH_0]->SetBoundControlVolume(config, UPDATE);
   geometry_container[MESH_0]->SetMaxLength(config);
+  geometry_container[MESH_0]->SetLeastSquaresWeights(config);
 
   for (unsigned short iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++) {
     /*--- Update the control volume structures ---*/
@@ -2354,12 +2679,95 @@ void CGeometry::UpdateGeometry(CGeometry** geometry_container, CConfig* config)
     geometry_container[iMesh]->SetControlVolume(geometry_container[iMesh - 1], UPDATE);
     geometry_container[iMesh]->SetBoundControlVolume(geometry_container[iMesh - 1], config, UPDATE);
     geometry_container[iMesh]->SetCoord(geometry_container[iMesh - 1]);
+    geometry_container[iMesh]->SetLeastSquaresWeights(config);
   }
 
   /*--- Compute the global surface areas for all markers. ---*/
   geometry_container[MESH_0]->ComputeSurfaceAreaCfgFile(config);
 }
 
+namespace {
+template <int nDim>
+void ComputeLeastSquaresWeights(const CPoint& nodes, unsigned long nPointDomain, bool weighted,
+                                su2activematrix& weights) {
+  const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(), 2);
+  const auto& coord = nodes.GetCoord();
+  const auto* neighborPtr = nodes.GetPoints().outerPtr();
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain, 2 * omp_get_max_threads()))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    /*--- Normal matrix of the least-squares problem, same entries as in computeGradientsLeastSquares. ---*/
+
+    su2double R[3][3] = {{0.0}};
+
+    for (const auto jPoint : nodes.GetPoints(iPoint)) {
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, coord[jPoint], coord[iPoint], dist_ij);
+
+      su2double weight = weighted ? GeometryToolbox::SquaredNorm(nDim, dist_ij) : su2double(1.0);
+      if (weight <= 0.0) continue;
+      weight = 1.0 / weight;
+
+      for (int iDim = 0; iDim < nDim; ++iDim)
+        for (int jDim = iDim; jDim < nDim; ++jDim) R[iDim][jDim] += dist_ij[iDim] * dist_ij[jDim] * weight;
+
+      if (nDim == 3) R[2][1] += dist_ij[0] * dist_ij[nDim - 1] * weight;
+    }
+
+    su2double S[nDim][nDim];
+    GeometryToolbox::LeastSquaresSmatrix<nDim>(R[0][0], R[0][1], R[1][1], R[0][2], R[1][2], R[2][1], R[2][2], eps, S);
+
+    /*--- The gradient is S * transpose(A) * b, i.e. a weighted sum of differences to the neighbors. ---*/
+
+    auto iNeigh = neighborPtr[iPoint];
+
+    for (const auto jPoint : nodes.GetPoints(iPoint)) {
+      su2double* weight_ij = weights[iNeigh++];
+
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, coord[jPoint], coord[iPoint], dist_ij);
+
+      su2double weight = weighted ? GeometryToolbox::SquaredNorm(nDim, dist_ij) : su2double(1.0);
+      if (weight <= 0.0) continue;
+      weight = 1.0 / weight;
+
+      for (int iDim = 0; iDim < nDim; ++iDim) {
+        su2double sum = 0.0;
+        for (int jDim = 0; jDim < nDim; ++jDim)
+          sum += S[min(iDim, jDim)][max(iDim, jDim)] * dist_ij[jDim];
+        weight_ij[iDim] = sum * weight;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+}  // namespace
+
+void CGeometry::SetLeastSquaresWeights(const CConfig* config) {
+  /*--- Periodic points need contributions from both sides of the boundary, the gradients
+   *    are computed without the stored weights in that case (see computeGradientsLeastSquares). ---*/
+
+  if (!config->GetStoreLSGradientWeights() || config->GetnMarker_Periodic() > 0) return;
+
+  for (const bool weighted : {false, true}) {
+    const auto method = weighted ? WEIGHTED_LEAST_SQUARES : LEAST_SQUARES;
+    auto& weights = nodes->GetLeastSquaresWeights(weighted);
+
+    if (config->GetKind_Gradient_Method() != method && config->GetKind_Gradient_Method_Recon() != method) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(weights.resize(0, 0);)
+      continue;
+    }
+
+    SU2_OMP_SAFE_GLOBAL_ACCESS(weights.resize(nodes->GetPoints().getNumNonZeros(), nDim) = su2double(0.0);)
+
+    if (nDim == 2) {
+      ComputeLeastSquaresWeights<2>(*nodes, nPointDomain, weighted, weights);
+    } else {
+      ComputeLeastSquaresWeights<3>(*nodes, nPointDomain, weighted, weights);
+    }
+  }
+}
+
 void CGeometry::SetCustomBoundary(CConfig* config) {
   unsigned short iMarker;
   unsigned long iVertex;
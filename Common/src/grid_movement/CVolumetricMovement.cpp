@@ -51,10 +51,58 @@ CVolumetricMovement::CVolumetricMovement(CGeometry* geometry, CConfig* config)
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    HybridParallelInitialization(geometry);
+  }
+}
+
+CVolumetricMovement::~CVolumetricMovement() {
+  if (LockStrategy) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) omp_destroy_lock(&UpdateLocks[iPoint]);
   }
 }
 
-CVolumetricMovement::~CVolumetricMovement() = default;
+void CVolumetricMovement::HybridParallelInitialization(CGeometry* geometry) {
+#ifdef HAVE_OMP
+  /*--- Get the element coloring, the same one is used by the FEA solver. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+
+  /*--- If the coloring is too bad use lock-guarded accesses
+   *    to CSysMatrix in element loops instead. ---*/
+  LockStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  /*--- When using locks force a single color to reduce the color loop overhead. ---*/
+  if (LockStrategy && (coloring.getOuterSize() > 1)) geometry->SetNaturalElementColoring();
+
+  if (!coloring.empty()) {
+    /*--- We are not constrained by the color group size when using locks. ---*/
+    auto groupSize = LockStrategy ? 1ul : geometry->GetElementColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    ElemColoring.reserve(nColor);
+
+    for (auto iColor = 0ul; iColor < nColor; ++iColor)
+      ElemColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  su2double minEff = 1.0;
+  SU2_MPI::Reduce(&parallelEff, &minEff, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (minEff < COLORING_EFF_THRESH && rank == MASTER_NODE) {
+    cout << "WARNING: The element coloring efficiency of the mesh deformation was " << minEff
+         << ", a fallback strategy is in use.\n"
+         << "         Better performance may be possible by reducing the number of threads per rank." << endl;
+  }
+
+  if (LockStrategy) {
+    UpdateLocks.resize(nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) omp_init_lock(&UpdateLocks[iPoint]);
+  }
+#else
+  ElemColoring[0] = DummyGridColor<>(geometry->GetnElem());
+#endif
+}
 
 void CVolumetricMovement::UpdateGridCoord(CGeometry* geometry, CConfig* config) {
   unsigned short iDim;
@@ -87,6 +135,7 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry* geometry, CConfig* config) {
   geometry->SetControlVolume(config, UPDATE);
   geometry->SetBoundControlVolume(config, UPDATE);
   geometry->SetMaxLength(config);
+  geometry->SetLeastSquaresWeights(config);
 }
 
 void CVolumetricMovement::UpdateMultiGrid(CGeometry** geometry, CConfig* config) {
@@ -100,6 +149,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry** geometry, CConfig* config)
     geometry[iMGlevel]->SetControlVolume(geometry[iMGfine], UPDATE);
     geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGfine], config, UPDATE);
     geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->SetLeastSquaresWeights(config);
     if (config->GetGrid_Movement()) geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine]);
   }
 }
@@ -222,136 +272,165 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
 
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, su2double& MinVolume,
                                                           su2double& MaxVolume, bool Screen_Output) {
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+  unsigned long ElemCounter = 0;
+  const auto nElem = geometry->GetnElem();
 
   if (rank == MASTER_NODE && Screen_Output) cout << "Computing volumes of the grid elements." << endl;
 
   MaxVolume = -1E22;
   MinVolume = 1E22;
 
-  /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
+  SU2_OMP_PARALLEL {
+    su2double MaxVolume_Thread = -1E22, MinVolume_Thread = 1E22;
+    unsigned long ElemCounter_Thread = 0;
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+    /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      unsigned short nNodes = 0;
+      unsigned long PointCorners[8];
+      su2double Volume = 0.0, CoordCorners[8][3];
+
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+
+      for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+        }
       }
-    }
 
-    /*--- 2D elements ---*/
+      /*--- 2D elements ---*/
 
-    if (nDim == 2) {
-      if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
-      if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
-    }
+      if (nDim == 2) {
+        if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
+        if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
+      }
 
-    /*--- 3D Elementes ---*/
+      /*--- 3D Elementes ---*/
 
-    if (nDim == 3) {
-      if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
-      if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
-      if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
-      if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
-    }
+      if (nDim == 3) {
+        if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
+        if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
+        if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
+        if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
+      }
 
-    RightVol = true;
-    if (Volume < 0.0) RightVol = false;
+      MaxVolume_Thread = max(MaxVolume_Thread, Volume);
+      MinVolume_Thread = min(MinVolume_Thread, Volume);
+      geometry->elem[iElem]->SetVolume(Volume);
 
-    MaxVolume = max(MaxVolume, Volume);
-    MinVolume = min(MinVolume, Volume);
-    geometry->elem[iElem]->SetVolume(Volume);
+      if (Volume < 0.0) ElemCounter_Thread++;
+    }
+    END_SU2_OMP_FOR
 
-    if (!RightVol) ElemCounter++;
-  }
+    SU2_OMP_CRITICAL {
+      MaxVolume = max(MaxVolume, MaxVolume_Thread);
+      MinVolume = min(MinVolume, MinVolume_Thread);
+      ElemCounter += ElemCounter_Thread;
+    }
+    END_SU2_OMP_CRITICAL
 
 #ifdef HAVE_MPI
-  unsigned long ElemCounter_Local = ElemCounter;
-  ElemCounter = 0;
-  su2double MaxVolume_Local = MaxVolume;
-  MaxVolume = 0.0;
-  su2double MinVolume_Local = MinVolume;
-  MinVolume = 0.0;
-  SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      unsigned long ElemCounter_Local = ElemCounter;
+      ElemCounter = 0;
+      su2double MaxVolume_Local = MaxVolume;
+      MaxVolume = 0.0;
+      su2double MinVolume_Local = MinVolume;
+      MinVolume = 0.0;
+      SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#else
+    SU2_OMP_BARRIER
 #endif
 
-  /*--- Volume from  0 to 1 ---*/
+    /*--- Volume from  0 to 1 ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    Volume = geometry->elem[iElem]->GetVolume() / MaxVolume;
-    geometry->elem[iElem]->SetVolume(Volume);
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      const su2double Volume = geometry->elem[iElem]->GetVolume() / MaxVolume;
+      geometry->elem[iElem]->SetVolume(Volume);
+    }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 
   if ((ElemCounter != 0) && (rank == MASTER_NODE) && (Screen_Output))
     cout << "There are " << ElemCounter << " elements with negative volume.\n" << endl;
 }
 
 void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Screen_Output) {
-  unsigned long iElem;
-  unsigned short iDim;
   unsigned long nNonconvexElements = 0;
 
   /*--- Load up each tetrahedron to check for convex properties. ---*/
   if (nDim == 2) {
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-      su2double minCrossProduct = 1.e6, maxCrossProduct = -1.e6;
+    SU2_OMP_PARALLEL {
+      unsigned long nNonconvexElements_Thread = 0;
 
-      const auto nNodes = geometry->elem[iElem]->GetnNodes();
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+        su2double minCrossProduct = 1.e6, maxCrossProduct = -1.e6;
 
-      /*--- Get coordinates of corner points ---*/
-      unsigned short iNodes;
-      unsigned long PointCorners[8];
-      const su2double* CoordCorners[8];
+        const auto nNodes = geometry->elem[iElem]->GetnNodes();
 
-      for (iNodes = 0; iNodes < nNodes; iNodes++) {
-        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-        CoordCorners[iNodes] = geometry->nodes->GetCoord(PointCorners[iNodes]);
-      }
+        /*--- Get coordinates of corner points ---*/
+        unsigned short iNodes;
+        unsigned long PointCorners[8];
+        const su2double* CoordCorners[8];
 
-      /*--- Determine whether element is convex ---*/
-      for (iNodes = 0; iNodes < nNodes; iNodes++) {
-        /*--- Calculate minimum and maximum angle between edge vectors adjacent to each node ---*/
-        su2double edgeVector_i[3], edgeVector_j[3];
+        for (iNodes = 0; iNodes < nNodes; iNodes++) {
+          PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+          CoordCorners[iNodes] = geometry->nodes->GetCoord(PointCorners[iNodes]);
+        }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          if (iNodes == 0) {
-            edgeVector_i[iDim] = CoordCorners[nNodes - 1][iDim] - CoordCorners[iNodes][iDim];
-          } else {
-            edgeVector_i[iDim] = CoordCorners[iNodes - 1][iDim] - CoordCorners[iNodes][iDim];
-          }
+        /*--- Determine whether element is convex ---*/
+        for (iNodes = 0; iNodes < nNodes; iNodes++) {
+          /*--- Calculate minimum and maximum angle between edge vectors adjacent to each node ---*/
+          su2double edgeVector_i[3], edgeVector_j[3];
 
-          if (iNodes == nNodes - 1) {
-            edgeVector_j[iDim] = CoordCorners[0][iDim] - CoordCorners[iNodes][iDim];
-          } else {
-            edgeVector_j[iDim] = CoordCorners[iNodes + 1][iDim] - CoordCorners[iNodes][iDim];
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            if (iNodes == 0) {
+              edgeVector_i[iDim] = CoordCorners[nNodes - 1][iDim] - CoordCorners[iNodes][iDim];
+            } else {
+              edgeVector_i[iDim] = CoordCorners[iNodes - 1][iDim] - CoordCorners[iNodes][iDim];
+            }
+
+            if (iNodes == nNodes - 1) {
+              edgeVector_j[iDim] = CoordCorners[0][iDim] - CoordCorners[iNodes][iDim];
+            } else {
+              edgeVector_j[iDim] = CoordCorners[iNodes + 1][iDim] - CoordCorners[iNodes][iDim];
+            }
           }
-        }
 
-        /*--- Calculate cross product of edge vectors ---*/
-        su2double crossProduct;
-        crossProduct = edgeVector_i[1] * edgeVector_j[0] - edgeVector_i[0] * edgeVector_j[1];
+          /*--- Calculate cross product of edge vectors ---*/
+          su2double crossProduct;
+          crossProduct = edgeVector_i[1] * edgeVector_j[0] - edgeVector_i[0] * edgeVector_j[1];
 
-        if (crossProduct < minCrossProduct) minCrossProduct = crossProduct;
-        if (crossProduct > maxCrossProduct) maxCrossProduct = crossProduct;
-      }
+          if (crossProduct < minCrossProduct) minCrossProduct = crossProduct;
+          if (crossProduct > maxCrossProduct) maxCrossProduct = crossProduct;
+        }
 
-      /*--- Element is nonconvex if cross product of at least one set of adjacent edges is negative ---*/
-      if (minCrossProduct < 0 && maxCrossProduct > 0) {
-        nNonconvexElements++;
+        /*--- Element is nonconvex if cross product of at least one set of adjacent edges is negative ---*/
+        if (minCrossProduct < 0 && maxCrossProduct > 0) {
+          nNonconvexElements_Thread++;
+        }
       }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_ATOMIC
+      nNonconvexElements += nNonconvexElements_Thread;
     }
+    END_SU2_OMP_PARALLEL
   } else if (rank == MASTER_NODE) {
     cout << "\nWARNING: Convexity is not checked for 3D elements (issue #1171).\n" << endl;
   }
@@ -366,10 +445,9 @@ void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Sc
 
 void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfig* config, su2double& MinDistance,
                                                      su2double& MaxDistance) const {
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
-  su2double dist, MaxDistance_Local, MinDistance_Local;
-  int rankID;
+  su2double MaxDistance_Local, MinDistance_Local;
 
   /*--- Initialize min and max distance ---*/
 
@@ -421,16 +499,32 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfi
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
-      WallADT.DetermineNearestNode(geometry->nodes->GetCoord(iPoint), dist, pointID, rankID);
-      geometry->nodes->SetWall_Distance(iPoint, dist);
+    SU2_OMP_PARALLEL {
+      su2double MaxDistance_Thread = -1E22, MinDistance_Thread = 1E22;
+
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+        su2double dist;
+        unsigned long pointID;
+        int rankID;
+        WallADT.DetermineNearestNode(geometry->nodes->GetCoord(iPoint), dist, pointID, rankID);
+        geometry->nodes->SetWall_Distance(iPoint, dist);
 
-      MaxDistance = max(MaxDistance, dist);
+        MaxDistance_Thread = max(MaxDistance_Thread, dist);
 
-      /*--- To discard points on the surface we use > EPS ---*/
+        /*--- To discard points on the surface we use > EPS ---*/
+
+        if (sqrt(dist) > EPS) MinDistance_Thread = min(MinDistance_Thread, dist);
+      }
+      END_SU2_OMP_FOR
 
-      if (sqrt(dist) > EPS) MinDistance = min(MinDistance, dist);
+      SU2_OMP_CRITICAL {
+        MaxDistance = max(MaxDistance, MaxDistance_Thread);
+        MinDistance = min(MinDistance, MinDistance_Thread);
+      }
+      END_SU2_OMP_CRITICAL
     }
+    END_SU2_OMP_PARALLEL
 
     MaxDistance_Local = MaxDistance;
     MaxDistance = 0.0;
@@ -448,23 +542,13 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfi
 }
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry* geometry, CConfig* config) {
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0,
-            ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output = config->GetDeform_Output();
 
   /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
 
-  if (nDim == 2)
-    StiffMatrix_nElem = 8;
-  else
-    StiffMatrix_nElem = 24;
-
-  StiffMatrix_Elem = new su2double*[StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++) StiffMatrix_Elem[iVar] = new su2double[StiffMatrix_nElem];
+  const unsigned short StiffMatrix_nElem = (nDim == 2) ? 8 : 24;
 
   /*--- Compute min volume in the entire mesh. ---*/
 
@@ -481,48 +565,67 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry* geometr
       cout << "Min. distance: " << MinDistance << ", max. distance: " << MaxDistance << "." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   *    Elements of the same color do not share nodes, hence they can be assembled
+   *    concurrently, each thread works on its own element matrix. ---*/
+
+  SU2_OMP_PARALLEL {
+    auto** StiffMatrix_Elem = new su2double*[StiffMatrix_nElem];
+    for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+      StiffMatrix_Elem[iVar] = new su2double[StiffMatrix_nElem];
+
+    for (auto color : ElemColoring) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) {
+        const auto iElem = color.indices[k];
+
+        unsigned short nNodes = 0;
+        unsigned long PointCorners[8];
+        su2double CoordCorners[8][3], ElemDistance = 0.0;
+
+        if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
+        if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
+        if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
+        if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+
+        for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
+          PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+          }
+        }
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+        /*--- Extract Element volume and distance to compute the stiffness ---*/
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
-      }
-    }
+        const su2double ElemVolume = geometry->elem[iElem]->GetVolume();
 
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
+        if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
+          for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++)
+            ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
+          ElemDistance = ElemDistance / (su2double)nNodes;
+        }
 
-    ElemVolume = geometry->elem[iElem]->GetVolume();
+        if (nDim == 2)
+          SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
+                               ElemDistance);
+        if (nDim == 3)
+          SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
+                               ElemDistance);
 
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
-      ElemDistance = ElemDistance / (su2double)nNodes;
+        AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+      }
+      END_SU2_OMP_FOR
     }
 
-    if (nDim == 2)
-      SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
-                           ElemDistance);
-    if (nDim == 3)
-      SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
-                           ElemDistance);
+    /*--- Deallocate memory and exit ---*/
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+    for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++) delete[] StiffMatrix_Elem[iVar];
+    delete[] StiffMatrix_Elem;
   }
-
-  /*--- Deallocate memory and exit ---*/
-
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++) delete[] StiffMatrix_Elem[iVar];
-  delete[] StiffMatrix_Elem;
+  END_SU2_OMP_PARALLEL
 
   return MinVolume;
 }
@@ -1614,17 +1717,19 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
 
   unsigned short nVar = geometry->GetnDim();
 
-  su2double** StiffMatrix_Node;
-  StiffMatrix_Node = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++) StiffMatrix_Node[iVar] = new su2double[nVar];
+  /*--- Small fixed-size block, this is called for every element by every thread. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) StiffMatrix_Node[iVar][jVar] = 0.0;
+  su2double StiffMatrix_Block[3][3] = {{0.0}};
+  su2double* StiffMatrix_Node[3] = {StiffMatrix_Block[0], StiffMatrix_Block[1], StiffMatrix_Block[2]};
 
   /*--- Transform the stiffness matrix for the hexahedral element into the
    contributions for the individual nodes relative to each other. ---*/
 
   for (iVar = 0; iVar < nNodes; iVar++) {
+    /*--- Only the rows of iVar are modified, guard them if the coloring is not used. ---*/
+
+    if (LockStrategy) omp_set_lock(&UpdateLocks[PointCorners[iVar]]);
+
     for (jVar = 0; jVar < nNodes; jVar++) {
       for (iDim = 0; iDim < nVar; iDim++) {
         for (jDim = 0; jDim < nVar; jDim++) {
@@ -1634,18 +1739,14 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
 
       StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
     }
-  }
-
-  /*--- Deallocate memory and exit ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++) delete[] StiffMatrix_Node[iVar];
-  delete[] StiffMatrix_Node;
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[PointCorners[iVar]]);
+  }
 }
 
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig* config) {
-  unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
-  unsigned long iPoint, total_index, iVertex;
-  su2double *VarCoord, MeanCoord[3] = {0.0, 0.0, 0.0}, VarIncrement = 1.0;
+  const unsigned short nDim = geometry->GetnDim();
+  unsigned short axis = 0;
 
   /*--- Get the SU2 module. SU2_CFD will use this routine for dynamically
    deforming meshes (MARKER_MOVING), while SU2_DEF will use it for deforming
@@ -1657,120 +1758,138 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig*
    increments and solve the grid deformation equations iteratively with
    successive small deformations. ---*/
 
-  VarIncrement = 1.0 / ((su2double)config->GetGridDef_Nonlinear_Iter());
-
-  /*--- As initialization, set to zero displacements of all the surfaces except the symmetry
-   plane (which is treated specially, see below), internal and the send-receive boundaries ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
-         (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
-         (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY))) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint * nDim + iDim;
-          LinSysRes[total_index] = 0.0;
-          LinSysSol[total_index] = 0.0;
-          StiffMatrix.DeleteValsRowi(total_index);
+  const su2double VarIncrement = 1.0 / ((su2double)config->GetGridDef_Nonlinear_Iter());
+
+  /*--- The vertices of one marker are distinct points, hence each marker loop is
+   thread-parallel, the implicit barriers keep the order between markers. ---*/
+
+  SU2_OMP_PARALLEL {
+    /*--- As initialization, set to zero displacements of all the surfaces except the symmetry
+     plane (which is treated specially, see below), internal and the send-receive boundaries ---*/
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
+           (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
+           (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY))) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const auto total_index = iPoint * nDim + iDim;
+            LinSysRes[total_index] = 0.0;
+            LinSysSol[total_index] = 0.0;
+            StiffMatrix.DeleteValsRowi(total_index);
+          }
         }
+        END_SU2_OMP_FOR
       }
     }
-  }
 
-  /*--- Set the known displacements, note that some points of the moving surfaces
-   could be on on the symmetry plane, we should specify DeleteValsRowi again (just in case) ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) ||
-        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_DEF)) ||
-        ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD) &&
-         (config->GetMarker_All_DV(iMarker) == YES)) ||
-        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_DOT))) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint * nDim + iDim;
-          LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
+    /*--- Set the known displacements, note that some points of the moving surfaces
+     could be on on the symmetry plane, we should specify DeleteValsRowi again (just in case) ---*/
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) ||
+          ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_DEF)) ||
+          ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD) &&
+           (config->GetMarker_All_DV(iMarker) == YES)) ||
+          ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_DOT))) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          const su2double* VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const auto total_index = iPoint * nDim + iDim;
+            LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+            LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+            StiffMatrix.DeleteValsRowi(total_index);
+          }
         }
+        END_SU2_OMP_FOR
       }
     }
-  }
-
-  /*--- Set to zero displacements of the normal component for the symmetry plane condition ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE)) {
-      su2double* Coord_0 = nullptr;
+    /*--- Set to zero displacements of the normal component for the symmetry plane condition ---*/
 
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE)) {
+        /*--- Identify the axis, this is cheap so it is done by one thread. ---*/
 
-      /*--- Store the coord of the first point to help identify the axis. ---*/
+        BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+          su2double MeanCoord[3] = {0.0, 0.0, 0.0};
 
-      iPoint = geometry->vertex[iMarker][0]->GetNode();
-      Coord_0 = geometry->nodes->GetCoord(iPoint);
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->nodes->GetCoord(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          MeanCoord[iDim] += (VarCoord[iDim] - Coord_0[iDim]) * (VarCoord[iDim] - Coord_0[iDim]);
-      }
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
-      if (nDim == 3) {
-        if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
-        if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
-      } else {
-        if ((MeanCoord[0] <= MeanCoord[1])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0])) axis = 1;
-      }
+          /*--- Store the coord of the first point to help identify the axis. ---*/
 
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        total_index = iPoint * nDim + axis;
-        LinSysRes[total_index] = 0.0;
-        LinSysSol[total_index] = 0.0;
-        StiffMatrix.DeleteValsRowi(total_index);
-      }
-    }
-  }
+          const su2double* Coord_0 = geometry->nodes->GetCoord(geometry->vertex[iMarker][0]->GetNode());
 
-  /*--- Don't move the nearfield plane ---*/
+          for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+            const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            const su2double* Coord = geometry->nodes->GetCoord(iPoint);
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+              MeanCoord[iDim] += (Coord[iDim] - Coord_0[iDim]) * (Coord[iDim] - Coord_0[iDim]);
+          }
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+          if (nDim == 3) {
+            if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+            if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+            if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+          } else {
+            if ((MeanCoord[0] <= MeanCoord[1])) axis = 0;
+            if ((MeanCoord[1] <= MeanCoord[0])) axis = 1;
+          }
+        }
+        END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint * nDim + iDim;
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          const auto total_index = iPoint * nDim + axis;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
           StiffMatrix.DeleteValsRowi(total_index);
         }
+        END_SU2_OMP_FOR
       }
     }
-  }
 
-  /*--- Move the FSI interfaces ---*/
+    /*--- Don't move the nearfield plane ---*/
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const auto total_index = iPoint * nDim + iDim;
+            LinSysRes[total_index] = 0.0;
+            LinSysSol[total_index] = 0.0;
+            StiffMatrix.DeleteValsRowi(total_index);
+          }
+        }
+        END_SU2_OMP_FOR
+      }
+    }
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint * nDim + iDim;
-          LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
-          StiffMatrix.DeleteValsRowi(total_index);
+    /*--- Move the FSI interfaces ---*/
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          const su2double* VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const auto total_index = iPoint * nDim + iDim;
+            LinSysRes[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+            LinSysSol[total_index] = SU2_TYPE::GetValue(VarCoord[iDim] * VarIncrement);
+            StiffMatrix.DeleteValsRowi(total_index);
+          }
         }
+        END_SU2_OMP_FOR
       }
     }
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CVolumetricMovement::SetBoundaryDerivatives(CGeometry* geometry, CConfig* config,
@@ -1878,8 +1997,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry* geometry, CConf
 }
 
 void CVolumetricMovement::SetDomainDisplacements(CGeometry* geometry, CConfig* config) {
-  unsigned short iDim, nDim = geometry->GetnDim();
-  unsigned long iPoint, total_index;
+  const unsigned short nDim = geometry->GetnDim();
 
   if (config->GetHold_GridFixed()) {
     auto MinCoordValues = config->GetHold_GridFixed_Coord();
@@ -1888,33 +2006,37 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry* geometry, CConfig* c
     /*--- Set to zero displacements of all the points that are not going to be moved
      except the surfaces ---*/
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    SU2_OMP_PARALLEL_(for schedule(static, OMP_MIN_SIZE))
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
       auto Coord = geometry->nodes->GetCoord(iPoint);
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         if ((Coord[iDim] < MinCoordValues[iDim]) || (Coord[iDim] > MaxCoordValues[iDim])) {
-          total_index = iPoint * nDim + iDim;
+          const auto total_index = iPoint * nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
           StiffMatrix.DeleteValsRowi(total_index);
         }
       }
     }
+    END_SU2_OMP_PARALLEL
   }
 
   /*--- Don't move the volume grid outside the limits based
    on the distance to the solid surface ---*/
 
   if (config->GetDeform_Limit() < 1E6) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    SU2_OMP_PARALLEL_(for schedule(static, OMP_MIN_SIZE))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
       if (geometry->nodes->GetWall_Distance(iPoint) >= config->GetDeform_Limit()) {
-        for (iDim = 0; iDim < nDim; iDim++) {
-          total_index = iPoint * nDim + iDim;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          const auto total_index = iPoint * nDim + iDim;
           LinSysRes[total_index] = 0.0;
           LinSysSol[total_index] = 0.0;
           StiffMatrix.DeleteValsRowi(total_index);
         }
       }
     }
+    END_SU2_OMP_PARALLEL
   }
 }
 
@@ -0,0 +1,1182 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Setup and application of the coarse levels of the smoothed-aggregation AMG preconditioner.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/linear_algebra/CGraphPartitioning.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/CConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+/*--- Marker of points that do not belong to an aggregate yet. ---*/
+constexpr auto NO_AGGREGATE = std::numeric_limits<unsigned long>::max();
+
+/*--- Marker of points that join the aggregate of a halo, i.e. of another rank. ---*/
+constexpr auto REMOTE_AGGREGATE = NO_AGGREGATE - 1;
+
+/*--- Tag of the point-to-point messages of the hierarchy. ---*/
+constexpr int AMG_TAG = 101;
+
+/*--- MPI type of the entries of the matrices and vectors. ---*/
+template <class T>
+SU2_MPI::Datatype ScalarMPIType() {
+  return (sizeof(T) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+}
+
+/*--- Sends one message to each rank in "send", and returns the messages received from other ranks. The sources are
+ *    found with an all-to-all of the message sizes, this is only used while building the hierarchy. ---*/
+template <class T>
+std::map<int, vector<T>> SparseExchange(const std::map<int, vector<T>>& send, SU2_MPI::Datatype type) {
+  using MPIWrapper = typename SelectMPIWrapper<T>::W;
+  const int size = SU2_MPI::GetSize();
+
+  vector<int> sendCount(size, 0), recvCount(size, 0);
+  for (const auto& msg : send) sendCount[msg.first] = msg.second.size();
+  SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  std::map<int, vector<T>> recv;
+  vector<typename MPIWrapper::Request> requests;
+  requests.reserve(send.size() + size);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (recvCount[iRank] == 0) continue;
+    auto& msg = recv[iRank];
+    msg.resize(recvCount[iRank]);
+    requests.emplace_back();
+    MPIWrapper::Irecv(msg.data(), msg.size(), type, iRank, AMG_TAG, SU2_MPI::GetComm(), &requests.back());
+  }
+  for (const auto& msg : send) {
+    if (msg.second.empty()) continue;
+    requests.emplace_back();
+    MPIWrapper::Isend(msg.second.data(), msg.second.size(), type, msg.first, AMG_TAG, SU2_MPI::GetComm(),
+                      &requests.back());
+  }
+  MPIWrapper::Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+
+  return recv;
+}
+
+/*--- Sends data of the rows in the send lists of some halo comms, and reads that of the halos. "pack(iRow, msg)"
+ *    appends the data of a row to a message, "unpack(iHalo, msg, pos)" reads that of a halo and returns the
+ *    position of the next one. ---*/
+template <class T, class Comms, class Pack, class Unpack>
+void ForwardExchange(const Comms& comms, SU2_MPI::Datatype type, const Pack& pack, const Unpack& unpack) {
+  std::map<int, vector<T>> send;
+  for (auto k = 0ul; k < comms.sendRank.size(); ++k) {
+    auto& msg = send[comms.sendRank[k]];
+    for (auto i = comms.sendPtr[k]; i < comms.sendPtr[k + 1]; ++i) pack(comms.sendInd[i], msg);
+  }
+  const auto recv = SparseExchange(send, type);
+
+  for (auto k = 0ul; k < comms.recvRank.size(); ++k) {
+    const auto msg = recv.find(comms.recvRank[k]);
+    if (msg == recv.end()) continue;
+    unsigned long pos = 0;
+    for (auto i = comms.recvPtr[k]; i < comms.recvPtr[k + 1]; ++i) pos = unpack(comms.recvInd[i], msg->second, pos);
+  }
+}
+}  // namespace
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetMatrix(unsigned long nvar, unsigned long nPointDomain, unsigned long nPoint,
+                                                const unsigned long* rowPtr, const unsigned long* colInd,
+                                                const unsigned long* diaPtr, const ScalarType* values) {
+  if (nvar > MAXNVAR) SU2_MPI::Error("nVar larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  nVar = nvar;
+  fine.nRow = nPointDomain;
+  fine.nCol = nPoint;
+  fine.rowPtr = rowPtr;
+  fine.colInd = colInd;
+  fine.diaPtr = diaPtr;
+  fine.values = values;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(const CGeometry* geometry, const CConfig* config) {
+  SU2_OMP_MASTER {
+    kindSmoother = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_AMG_Smoother());
+    maxLevels = std::max<unsigned short>(config->GetLinear_Solver_AMG_Levels(), 1);
+    strength = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+    smoothProlongation = config->GetLinear_Solver_AMG_Smooth_Prolongation();
+
+    omp_chunk_size = computeStaticChunkSize(fine.nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+    /*--- Views of coarse operators are kept while building the next level, the levels must not be reallocated. ---*/
+    unsigned short nLevel = 1;
+    levels.reserve(maxLevels);
+    levels.resize(std::max<size_t>(levels.size(), 1));
+
+    /*--- The halos of the finest level are those of the point-to-point comms of the geometry. ---*/
+    auto& comms = levels[0].comms;
+    comms = CHaloComms();
+    comms.sendPtr.push_back(0);
+    for (int iSend = 0; iSend < geometry->nP2PSend; ++iSend) {
+      comms.sendRank.push_back(geometry->Neighbors_P2PSend[iSend]);
+      for (auto k = geometry->nPoint_P2PSend[iSend]; k < geometry->nPoint_P2PSend[iSend + 1]; ++k)
+        comms.sendInd.push_back(geometry->Local_Point_P2PSend[k]);
+      comms.sendPtr.push_back(comms.sendInd.size());
+    }
+    comms.recvPtr.push_back(0);
+    for (int iRecv = 0; iRecv < geometry->nP2PRecv; ++iRecv) {
+      comms.recvRank.push_back(geometry->Neighbors_P2PRecv[iRecv]);
+      for (auto k = geometry->nPoint_P2PRecv[iRecv]; k < geometry->nPoint_P2PRecv[iRecv + 1]; ++k)
+        comms.recvInd.push_back(geometry->Local_Point_P2PRecv[k]);
+      comms.recvPtr.push_back(comms.recvInd.size());
+    }
+
+    /*--- The criteria to stop coarsening are global, all ranks must have the same number of levels. ---*/
+    unsigned long nRowGlobal = 0;
+    SU2_MPI::Allreduce(&fine.nRow, &nRowGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    vector<unsigned long> aggregate, offsets;
+    auto A = fine;
+
+    while (nLevel < maxLevels && nRowGlobal > COARSEST_SIZE) {
+      const auto nAggregate = Aggregate(A, levels[nLevel - 1].comms, aggregate, offsets);
+      const auto nAggregateGlobal = offsets.back();
+
+      /*--- Stop if the coarsening stagnates (e.g. no strong connections left). ---*/
+      if (nAggregateGlobal == 0 || 10 * nAggregateGlobal > 9 * nRowGlobal) break;
+
+      if (levels.size() <= nLevel) levels.emplace_back();
+      Coarsen(A, aggregate, nAggregate, offsets, levels[nLevel - 1], levels[nLevel]);
+
+      A = levels[nLevel].A.View();
+      nRowGlobal = nAggregateGlobal;
+      ++nLevel;
+    }
+    levels.resize(nLevel);
+
+    for (auto iLevel = 1ul; iLevel < levels.size(); ++iLevel) {
+      SetUpLevel(levels[iLevel], iLevel + 1 == levels.size());
+    }
+
+    /*--- Solver of the coarsest level. ---*/
+    if (nLevel > 1) BuildCoarsestSolver(levels.back());
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Smoothers of the intermediate levels. ---*/
+  for (auto iLevel = 1ul; iLevel < levels.size(); ++iLevel) BuildSmoother(levels[iLevel]);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetUpLevel(CLevel& level, bool coarsest) const {
+  const auto& A = level.A;
+  const auto nThreads = omp_get_max_threads();
+
+  level.ompChunk = computeStaticChunkSize(A.nRow, nThreads, OMP_MAX_SIZE);
+
+  /*--- The halos of x are exchanged for the residual, those of b receive the restriction of other ranks. ---*/
+  level.x.resize(A.nCol * nVar);
+  level.b.resize(A.nCol * nVar);
+  level.r.resize(A.nRow * nVar);
+  level.dx.resize(coarsest ? A.nRow * nVar : 0);
+  level.invDiag.resize(A.nRow * nVar * nVar);
+  level.factors.resize(kindSmoother == ILU ? A.values.size() : 0);
+
+  if (kindSmoother == JACOBI) return;
+
+  /*--- Narrow levels are not worth a barrier, they are grouped and processed by one thread. ---*/
+  for (auto* levelSets : {&level.lower, &level.upper}) {
+    const bool upper = (levelSets == &level.upper);
+    levelSets->minWidth = nThreads * OMP_MIN_SIZE;
+    CLevelScheduling<unsigned long> levelSchedule(A.nRow);
+    levelSchedule.Partition(A.rowPtr.data(), A.diaPtr.data(), A.colInd.data(), upper, levelSets->rows,
+                            levelSets->offsets, levelSets->chains, levelSets->minWidth);
+  }
+}
+
+template <class ScalarType>
+template <class RowKernel>
+void CAlgebraicMultigrid<ScalarType>::LevelScheduledSweep(const CLevelSets& levelSets,
+                                                          const RowKernel& rowKernel) const {
+  for (auto iChain = 0ul; iChain + 1 < levelSets.chains.size(); ++iChain) {
+    const auto firstLevel = levelSets.chains[iChain];
+    const auto lastLevel = levelSets.chains[iChain + 1];
+    if (firstLevel == lastLevel) continue;
+
+    const auto begin = levelSets.offsets[firstLevel];
+    const auto end = levelSets.offsets[lastLevel];
+
+    if (lastLevel - firstLevel == 1 && end - begin >= levelSets.minWidth) {
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto k = begin; k < end; ++k) rowKernel(levelSets.rows[k]);
+      END_SU2_OMP_FOR
+    } else {
+      SU2_OMP_MASTER
+      for (auto k = begin; k < end; ++k) rowKernel(levelSets.rows[k]);
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+  }
+}
+
+template <class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(const CBlockCSRView& A, const CHaloComms& comms,
+                                                         vector<unsigned long>& aggregate,
+                                                         vector<unsigned long>& offsets) const {
+  const auto blkSize = nVar * nVar;
+  const auto nHalo = A.nCol - A.nRow;
+
+  auto blockNorm = [&](unsigned long idx) {
+    passivedouble norm = 0.0;
+    for (auto k = 0ul; k < blkSize; ++k) norm += pow(SU2_TYPE::GetValue(A.values[idx * blkSize + k]), 2);
+    return sqrt(norm);
+  };
+
+  /*--- Owner of each halo, the halos that are not received (e.g. periodic) are not coupled. ---*/
+  vector<int> owner(nHalo, -1);
+  for (auto k = 0ul; k < comms.recvRank.size(); ++k)
+    for (auto i = comms.recvPtr[k]; i < comms.recvPtr[k + 1]; ++i) owner[comms.recvInd[i] - A.nRow] = comms.recvRank[k];
+
+  vector<passivedouble> diagNorm(A.nCol, 0.0);
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) diagNorm[iRow] = blockNorm(A.diaPtr[iRow]);
+
+  ForwardExchange<ScalarType>(
+      comms, ScalarMPIType<ScalarType>(),
+      [&](unsigned long iRow, vector<ScalarType>& msg) { msg.push_back(diagNorm[iRow]); },
+      [&](unsigned long iHalo, const vector<ScalarType>& msg, unsigned long pos) {
+        diagNorm[iHalo] = SU2_TYPE::GetValue(msg[pos]);
+        return pos + 1;
+      });
+
+  /*--- Strong connections, |A_ij| >= theta * sqrt(|A_ii| |A_jj|), with norm of the blocks. ---*/
+
+  vector<unsigned long> strongPtr(A.nRow + 1, 0), strongInd;
+  vector<passivedouble> strongVal;
+  strongInd.reserve(A.rowPtr[A.nRow] - A.rowPtr[0]);
+  strongVal.reserve(strongInd.capacity());
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    for (auto idx = A.rowPtr[iRow]; idx < A.rowPtr[iRow + 1]; ++idx) {
+      const auto jRow = A.colInd[idx];
+      if (jRow == iRow || jRow >= A.nCol || (jRow >= A.nRow && owner[jRow - A.nRow] < 0)) continue;
+      const auto norm = blockNorm(idx);
+      if (norm > 0.0 && norm >= strength * sqrt(diagNorm[iRow] * diagNorm[jRow])) {
+        strongInd.push_back(jRow);
+        strongVal.push_back(norm);
+      }
+    }
+    strongPtr[iRow + 1] = strongInd.size();
+  }
+
+  aggregate.assign(A.nCol, NO_AGGREGATE);
+  unsigned long nAggregate = 0;
+
+  /*--- Phase 1: Points whose (local) strong neighborhood is free seed a new aggregate with it. ---*/
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (aggregate[iRow] != NO_AGGREGATE) continue;
+
+    bool seed = false, free = true;
+    for (auto k = strongPtr[iRow]; k < strongPtr[iRow + 1] && free; ++k) {
+      if (strongInd[k] >= A.nRow) continue;
+      seed = true;
+      free = (aggregate[strongInd[k]] == NO_AGGREGATE);
+    }
+    if (!seed || !free) continue;
+
+    aggregate[iRow] = nAggregate;
+    for (auto k = strongPtr[iRow]; k < strongPtr[iRow + 1]; ++k)
+      if (strongInd[k] < A.nRow) aggregate[strongInd[k]] = nAggregate;
+    ++nAggregate;
+  }
+
+  /*--- Phase 2: Remaining points join the aggregate of their strongest neighbor from phase 1, which may be a halo
+   *    (the aggregate of a halo is local to its owner). ---*/
+
+  auto phase1 = aggregate;
+
+  ForwardExchange<unsigned long>(
+      comms, MPI_UNSIGNED_LONG, [&](unsigned long iRow, vector<unsigned long>& msg) { msg.push_back(aggregate[iRow]); },
+      [&](unsigned long iHalo, const vector<unsigned long>& msg, unsigned long pos) {
+        phase1[iHalo] = msg[pos];
+        return pos + 1;
+      });
+
+  vector<unsigned long> remoteHalo(A.nRow);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (aggregate[iRow] != NO_AGGREGATE) continue;
+
+    passivedouble maxVal = 0.0;
+    for (auto k = strongPtr[iRow]; k < strongPtr[iRow + 1]; ++k) {
+      const auto jRow = strongInd[k];
+      if (phase1[jRow] != NO_AGGREGATE && strongVal[k] > maxVal) {
+        maxVal = strongVal[k];
+        aggregate[iRow] = (jRow < A.nRow) ? phase1[jRow] : REMOTE_AGGREGATE;
+        remoteHalo[iRow] = jRow;
+      }
+    }
+  }
+
+  /*--- Phase 3: Leftovers (e.g. isolated points) form aggregates with their free strong neighbors. ---*/
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (aggregate[iRow] != NO_AGGREGATE) continue;
+
+    aggregate[iRow] = nAggregate;
+    for (auto k = strongPtr[iRow]; k < strongPtr[iRow + 1]; ++k)
+      if (strongInd[k] < A.nRow && aggregate[strongInd[k]] == NO_AGGREGATE) aggregate[strongInd[k]] = nAggregate;
+    ++nAggregate;
+  }
+
+  /*--- Global numbering, the aggregates of each rank are contiguous. ---*/
+
+  offsets.assign(SU2_MPI::GetSize() + 1, 0);
+  SU2_MPI::Allgather(&nAggregate, 1, MPI_UNSIGNED_LONG, &offsets[1], 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  const auto first = offsets[SU2_MPI::GetRank()];
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (aggregate[iRow] == REMOTE_AGGREGATE) {
+      const auto jRow = remoteHalo[iRow];
+      aggregate[iRow] = offsets[owner[jRow - A.nRow]] + phase1[jRow];
+    } else {
+      aggregate[iRow] += first;
+    }
+  }
+
+  ForwardExchange<unsigned long>(
+      comms, MPI_UNSIGNED_LONG, [&](unsigned long iRow, vector<unsigned long>& msg) { msg.push_back(aggregate[iRow]); },
+      [&](unsigned long iHalo, const vector<unsigned long>& msg, unsigned long pos) {
+        aggregate[iHalo] = msg[pos];
+        return pos + 1;
+      });
+
+  return nAggregate;
+}
+
+template <class ScalarType>
+passivedouble CAlgebraicMultigrid<ScalarType>::SpectralRadius(const CBlockCSRView& A, const CHaloComms& comms,
+                                                              const vector<ScalarType>& invDiag) const {
+  constexpr unsigned long nIter = 10;
+
+  const auto n = A.nRow * nVar;
+  vector<ScalarType> v(A.nCol * nVar, 0.0), Av(A.nCol * nVar, 0.0);
+  for (auto i = 0ul; i < n; ++i) v[i] = 1.0 + 0.1 * (i % 10);
+
+  auto norm = [n](const vector<ScalarType>& x) {
+    passivedouble sum = 0.0;
+    for (auto i = 0ul; i < n; ++i) sum += pow(SU2_TYPE::GetValue(x[i]), 2);
+#ifdef HAVE_MPI
+    const auto localSum = sum;
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&localSum, &sum, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+#endif
+    return sqrt(sum);
+  };
+
+  passivedouble rho = 0.0;
+  passivedouble normV = norm(v);
+
+  for (auto iter = 0ul; iter < nIter && normV > 0.0; ++iter) {
+    for (auto i = 0ul; i < n; ++i) v[i] /= normV;
+    HaloExchange(comms, v.data(), false);
+
+    /*--- Av = D^{-1} A v ---*/
+    for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+      ScalarType tmp[MAXNVAR];
+      RowProduct(A, iRow, v.data(), tmp);
+      BlockVectorProduct(&invDiag[iRow * nVar * nVar], tmp, &Av[iRow * nVar]);
+    }
+    std::swap(v, Av);
+    rho = normV = norm(v);
+  }
+  return rho;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Prolongation(const CBlockCSRView& A, const CHaloComms& comms,
+                                                   const vector<unsigned long>& aggregate, unsigned long nCol,
+                                                   CBlockCSR& P) const {
+  const auto blkSize = nVar * nVar;
+
+  P.nRow = A.nRow;
+  P.nCol = nCol;
+  P.diaPtr.clear();
+
+  if (!smoothProlongation) {
+    /*--- Tentative prolongation, identity block at the aggregate of each point. ---*/
+    P.rowPtr.resize(A.nRow + 1);
+    P.colInd.assign(aggregate.begin(), aggregate.begin() + A.nRow);
+    P.values.assign(A.nRow * blkSize, 0.0);
+    for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+      P.rowPtr[iRow] = iRow;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) P.values[iRow * blkSize + iVar * (nVar + 1)] = 1.0;
+    }
+    P.rowPtr[A.nRow] = A.nRow;
+    return;
+  }
+
+  /*--- Smoothed prolongation, P = (I - omega D^{-1} A) P_tentative, with omega = 4 / (3 rho(D^{-1} A)).
+   *    The couplings to halos (whose aggregate is known) are included. ---*/
+
+  vector<ScalarType> invDiag(A.nRow * blkSize);
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+    BlockInverse(&A.values[A.diaPtr[iRow] * blkSize], &invDiag[iRow * blkSize]);
+
+  const auto rho = SpectralRadius(A, comms, invDiag);
+  const ScalarType omega = (rho > 0.0) ? 4.0 / (3.0 * rho) : 0.0;
+
+  auto coupled = [&](unsigned long jRow) { return jRow < A.nCol && aggregate[jRow] != NO_AGGREGATE; };
+
+  P.rowPtr.assign(A.nRow + 1, 0);
+  P.colInd.clear();
+  P.values.clear();
+
+  /*--- Position of each aggregate in the current row of P. ---*/
+  vector<unsigned long> position(nCol, NO_AGGREGATE);
+  vector<unsigned long> rowCols;
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    rowCols.clear();
+    rowCols.push_back(aggregate[iRow]);
+    for (auto idx = A.rowPtr[iRow]; idx < A.rowPtr[iRow + 1]; ++idx) {
+      const auto jRow = A.colInd[idx];
+      if (coupled(jRow)) rowCols.push_back(aggregate[jRow]);
+    }
+    std::sort(rowCols.begin(), rowCols.end());
+    rowCols.erase(std::unique(rowCols.begin(), rowCols.end()), rowCols.end());
+
+    const auto offset = P.colInd.size();
+    for (auto k = 0ul; k < rowCols.size(); ++k) position[rowCols[k]] = offset + k;
+    P.colInd.insert(P.colInd.end(), rowCols.begin(), rowCols.end());
+    P.values.resize(P.colInd.size() * blkSize, 0.0);
+
+    auto Pii = &P.values[position[aggregate[iRow]] * blkSize];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) Pii[iVar * (nVar + 1)] = 1.0;
+
+    for (auto idx = A.rowPtr[iRow]; idx < A.rowPtr[iRow + 1]; ++idx) {
+      const auto jRow = A.colInd[idx];
+      if (!coupled(jRow)) continue;
+      BlockProductAdd(&invDiag[iRow * blkSize], &A.values[idx * blkSize],
+                      &P.values[position[aggregate[jRow]] * blkSize], -omega);
+    }
+    P.rowPtr[iRow + 1] = P.colInd.size();
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Coarsen(const CBlockCSRView& A, const vector<unsigned long>& aggregate,
+                                              unsigned long nAggregate, const vector<unsigned long>& offsets,
+                                              CLevel& level, CLevel& coarse) const {
+  const auto blkSize = nVar * nVar;
+  const auto nHalo = A.nCol - A.nRow;
+  const auto first = offsets[SU2_MPI::GetRank()];
+  const auto& comms = level.comms;
+  auto& P = level.P;
+
+  /*--- Local numbering of the coarse points, the local aggregates followed by those of other ranks. ---*/
+
+  std::unordered_map<unsigned long, unsigned long> remoteIndex;
+  vector<unsigned long> remoteGlobal;
+
+  auto toLocal = [&](unsigned long global) {
+    if (global >= first && global < first + nAggregate) return global - first;
+    const auto it = remoteIndex.emplace(global, nAggregate + remoteGlobal.size());
+    if (it.second) remoteGlobal.push_back(global);
+    return it.first->second;
+  };
+  auto toGlobal = [&](unsigned long iCol) {
+    return (iCol < nAggregate) ? first + iCol : remoteGlobal[iCol - nAggregate];
+  };
+  auto ownerOf = [&](unsigned long global) {
+    return static_cast<int>(std::upper_bound(offsets.begin(), offsets.end(), global) - offsets.begin()) - 1;
+  };
+
+  vector<unsigned long> column(A.nCol, NO_AGGREGATE);
+  for (auto iRow = 0ul; iRow < A.nCol; ++iRow)
+    if (aggregate[iRow] != NO_AGGREGATE) column[iRow] = toLocal(aggregate[iRow]);
+
+  Prolongation(A, comms, column, nAggregate + remoteGlobal.size(), P);
+
+  /*--- The rows of P of the halos are needed for A P, they are sent by their owners with global columns. ---*/
+
+  vector<vector<unsigned long>> haloCols(nHalo);
+  vector<vector<ScalarType>> haloValues(nHalo);
+
+  ForwardExchange<unsigned long>(
+      comms, MPI_UNSIGNED_LONG,
+      [&](unsigned long iRow, vector<unsigned long>& msg) {
+        msg.push_back(P.rowPtr[iRow + 1] - P.rowPtr[iRow]);
+        for (auto idx = P.rowPtr[iRow]; idx < P.rowPtr[iRow + 1]; ++idx) msg.push_back(toGlobal(P.colInd[idx]));
+      },
+      [&](unsigned long iHalo, const vector<unsigned long>& msg, unsigned long pos) {
+        for (auto k = 0ul; k < msg[pos]; ++k) haloCols[iHalo - A.nRow].push_back(toLocal(msg[pos + 1 + k]));
+        return pos + 1 + msg[pos];
+      });
+
+  ForwardExchange<ScalarType>(
+      comms, ScalarMPIType<ScalarType>(),
+      [&](unsigned long iRow, vector<ScalarType>& msg) {
+        msg.insert(msg.end(), P.values.begin() + P.rowPtr[iRow] * blkSize,
+                   P.values.begin() + P.rowPtr[iRow + 1] * blkSize);
+      },
+      [&](unsigned long iHalo, const vector<ScalarType>& msg, unsigned long pos) {
+        const auto n = haloCols[iHalo - A.nRow].size() * blkSize;
+        haloValues[iHalo - A.nRow].assign(msg.begin() + pos, msg.begin() + pos + n);
+        return pos + n;
+      });
+
+  CBlockCSR Pext = P;
+  Pext.nRow = A.nCol;
+  Pext.nCol = P.nCol = nAggregate + remoteGlobal.size();
+  for (auto iHalo = 0ul; iHalo < nHalo; ++iHalo) {
+    Pext.colInd.insert(Pext.colInd.end(), haloCols[iHalo].begin(), haloCols[iHalo].end());
+    Pext.values.insert(Pext.values.end(), haloValues[iHalo].begin(), haloValues[iHalo].end());
+    Pext.rowPtr.push_back(Pext.colInd.size());
+  }
+
+  /*--- Galerkin product of this rank, R A P, its rows for aggregates of other ranks are sent to their owners. ---*/
+
+  CBlockCSR AP, RAP;
+  Multiply(A, Pext.View(), AP);
+  Transpose(P, level.R);
+  Multiply(level.R.View(), AP.View(), RAP);
+
+  std::map<int, vector<unsigned long>> sendCols;
+  std::map<int, vector<ScalarType>> sendValues;
+
+  for (auto iRow = nAggregate; iRow < RAP.nRow; ++iRow) {
+    const auto begin = RAP.rowPtr[iRow];
+    const auto end = RAP.rowPtr[iRow + 1];
+    if (begin == end) continue;
+
+    const auto global = remoteGlobal[iRow - nAggregate];
+    const auto dest = ownerOf(global);
+    auto& cols = sendCols[dest];
+    cols.push_back(global - offsets[dest]);
+    cols.push_back(end - begin);
+    for (auto idx = begin; idx < end; ++idx) cols.push_back(toGlobal(RAP.colInd[idx]));
+
+    auto& values = sendValues[dest];
+    values.insert(values.end(), RAP.values.begin() + begin * blkSize, RAP.values.begin() + end * blkSize);
+  }
+
+  const auto recvCols = SparseExchange(sendCols, MPI_UNSIGNED_LONG);
+  const auto recvValues = SparseExchange(sendValues, ScalarMPIType<ScalarType>());
+
+  /*--- Received entries, row, column, and block. ---*/
+  vector<unsigned long> entryRow, entryCol;
+  vector<const ScalarType*> entryBlock;
+
+  for (const auto& msg : recvCols) {
+    const auto& cols = msg.second;
+    const auto* block = recvValues.at(msg.first).data();
+    for (auto pos = 0ul; pos < cols.size();) {
+      const auto iRow = cols[pos];
+      const auto nnz = cols[pos + 1];
+      pos += 2;
+      for (auto k = 0ul; k < nnz; ++k, ++pos, block += blkSize) {
+        entryRow.push_back(iRow);
+        entryCol.push_back(toLocal(cols[pos]));
+        entryBlock.push_back(block);
+      }
+    }
+  }
+  const auto nCol = nAggregate + remoteGlobal.size();
+
+  vector<unsigned long> entryPtr(nAggregate + 1, 0), entryOrder(entryRow.size());
+  for (const auto iRow : entryRow) ++entryPtr[iRow + 1];
+  std::partial_sum(entryPtr.begin(), entryPtr.end(), entryPtr.begin());
+  {
+    auto next = entryPtr;
+    for (auto k = 0ul; k < entryRow.size(); ++k) entryOrder[next[entryRow[k]]++] = k;
+  }
+
+  /*--- Coarse operator, sum of the local rows of R A P and of the rows received. ---*/
+
+  auto& Ac = coarse.A;
+  Ac.nRow = nAggregate;
+  Ac.rowPtr.assign(nAggregate + 1, 0);
+  Ac.colInd.clear();
+  Ac.values.clear();
+
+  vector<unsigned long> position(nCol, NO_AGGREGATE), rowCols;
+
+  auto addBlock = [&](const ScalarType* block, unsigned long iCol) {
+    auto* target = &Ac.values[position[iCol] * blkSize];
+    for (auto k = 0ul; k < blkSize; ++k) target[k] += block[k];
+  };
+
+  for (auto iRow = 0ul; iRow < nAggregate; ++iRow) {
+    rowCols.assign(RAP.colInd.begin() + RAP.rowPtr[iRow], RAP.colInd.begin() + RAP.rowPtr[iRow + 1]);
+    for (auto k = entryPtr[iRow]; k < entryPtr[iRow + 1]; ++k) rowCols.push_back(entryCol[entryOrder[k]]);
+    std::sort(rowCols.begin(), rowCols.end());
+    rowCols.erase(std::unique(rowCols.begin(), rowCols.end()), rowCols.end());
+
+    const auto offset = Ac.colInd.size();
+    for (auto k = 0ul; k < rowCols.size(); ++k) position[rowCols[k]] = offset + k;
+    Ac.colInd.insert(Ac.colInd.end(), rowCols.begin(), rowCols.end());
+    Ac.values.resize(Ac.colInd.size() * blkSize, 0.0);
+
+    for (auto idx = RAP.rowPtr[iRow]; idx < RAP.rowPtr[iRow + 1]; ++idx)
+      addBlock(&RAP.values[idx * blkSize], RAP.colInd[idx]);
+    for (auto k = entryPtr[iRow]; k < entryPtr[iRow + 1]; ++k)
+      addBlock(entryBlock[entryOrder[k]], entryCol[entryOrder[k]]);
+
+    Ac.rowPtr[iRow + 1] = Ac.colInd.size();
+  }
+
+  /*--- The halos of the coarse level are the aggregates of other ranks coupled to local aggregates (Ac) or to
+   *    local points (P), they keep their relative order so that the columns remain sorted. ---*/
+
+  vector<unsigned long> renumber(nCol, NO_AGGREGATE);
+  for (const auto iCol : Ac.colInd) renumber[iCol] = 0;
+  for (const auto iCol : P.colInd) renumber[iCol] = 0;
+
+  coarse.haloGlobal.clear();
+  for (auto iCol = 0ul; iCol < nCol; ++iCol) {
+    if (iCol < nAggregate) {
+      renumber[iCol] = iCol;
+    } else if (renumber[iCol] != NO_AGGREGATE) {
+      renumber[iCol] = nAggregate + coarse.haloGlobal.size();
+      coarse.haloGlobal.push_back(remoteGlobal[iCol - nAggregate]);
+    }
+  }
+  for (auto& iCol : Ac.colInd) iCol = renumber[iCol];
+  for (auto& iCol : P.colInd) iCol = renumber[iCol];
+  Ac.nCol = P.nCol = nAggregate + coarse.haloGlobal.size();
+
+  Transpose(P, level.R);
+
+  Ac.diaPtr.resize(Ac.nRow);
+  for (auto iRow = 0ul; iRow < Ac.nRow; ++iRow) {
+    const auto begin = Ac.colInd.begin() + Ac.rowPtr[iRow];
+    const auto end = Ac.colInd.begin() + Ac.rowPtr[iRow + 1];
+    Ac.diaPtr[iRow] = std::lower_bound(begin, end, iRow) - Ac.colInd.begin();
+  }
+
+  /*--- Comms of the coarse level, each rank requests the halos it needs from their owners. ---*/
+
+  std::map<int, vector<unsigned long>> requests, halos;
+  for (auto iHalo = 0ul; iHalo < coarse.haloGlobal.size(); ++iHalo) {
+    const auto global = coarse.haloGlobal[iHalo];
+    const auto owner = ownerOf(global);
+    requests[owner].push_back(global - offsets[owner]);
+    halos[owner].push_back(nAggregate + iHalo);
+  }
+  const auto sendLists = SparseExchange(requests, MPI_UNSIGNED_LONG);
+
+  auto& coarseComms = coarse.comms;
+  coarseComms = CHaloComms();
+  coarseComms.recvPtr.push_back(0);
+  for (const auto& halo : halos) {
+    coarseComms.recvRank.push_back(halo.first);
+    coarseComms.recvInd.insert(coarseComms.recvInd.end(), halo.second.begin(), halo.second.end());
+    coarseComms.recvPtr.push_back(coarseComms.recvInd.size());
+  }
+  coarseComms.sendPtr.push_back(0);
+  for (const auto& list : sendLists) {
+    coarseComms.sendRank.push_back(list.first);
+    coarseComms.sendInd.insert(coarseComms.sendInd.end(), list.second.begin(), list.second.end());
+    coarseComms.sendPtr.push_back(coarseComms.sendInd.size());
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::HaloExchange(const CHaloComms& comms, ScalarType* x, bool reverse) const {
+  using MPIWrapper = typename SelectMPIWrapper<ScalarType>::W;
+  const auto type = ScalarMPIType<ScalarType>();
+
+  /*--- In reverse the halos are sent to their owners, the roles of the lists are swapped. ---*/
+  const auto& sendRank = reverse ? comms.recvRank : comms.sendRank;
+  const auto& sendPtr = reverse ? comms.recvPtr : comms.sendPtr;
+  const auto& sendInd = reverse ? comms.recvInd : comms.sendInd;
+  const auto& recvRank = reverse ? comms.sendRank : comms.recvRank;
+  const auto& recvPtr = reverse ? comms.sendPtr : comms.recvPtr;
+  const auto& recvInd = reverse ? comms.sendInd : comms.recvInd;
+
+  auto& sendBuf = comms.sendBuf;
+  auto& recvBuf = comms.recvBuf;
+  auto& requests = comms.requests;
+  sendBuf.resize(sendInd.size() * nVar);
+  recvBuf.resize(recvInd.size() * nVar);
+  requests.resize(sendRank.size() + recvRank.size());
+
+  for (auto k = 0ul; k < recvRank.size(); ++k) {
+    MPIWrapper::Irecv(&recvBuf[recvPtr[k] * nVar], (recvPtr[k + 1] - recvPtr[k]) * nVar, type, recvRank[k], AMG_TAG,
+                      SU2_MPI::GetComm(), &requests[k]);
+  }
+  for (auto k = 0ul; k < sendRank.size(); ++k) {
+    for (auto i = sendPtr[k]; i < sendPtr[k + 1]; ++i)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sendBuf[i * nVar + iVar] = x[sendInd[i] * nVar + iVar];
+    MPIWrapper::Isend(&sendBuf[sendPtr[k] * nVar], (sendPtr[k + 1] - sendPtr[k]) * nVar, type, sendRank[k], AMG_TAG,
+                      SU2_MPI::GetComm(), &requests[recvRank.size() + k]);
+  }
+  MPIWrapper::Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+
+  for (auto i = 0ul; i < recvInd.size(); ++i) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      if (reverse)
+        x[recvInd[i] * nVar + iVar] += recvBuf[i * nVar + iVar];
+      else
+        x[recvInd[i] * nVar + iVar] = recvBuf[i * nVar + iVar];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Multiply(const CBlockCSRView& X, const CBlockCSRView& Y, CBlockCSR& Z) const {
+  const auto blkSize = nVar * nVar;
+
+  Z.nRow = X.nRow;
+  Z.nCol = Y.nCol;
+  Z.rowPtr.assign(X.nRow + 1, 0);
+  Z.colInd.clear();
+  Z.diaPtr.clear();
+
+  /*--- Symbolic product, the marker stores the last row where a column was seen. ---*/
+
+  vector<unsigned long> marker(Y.nCol, NO_AGGREGATE);
+  vector<unsigned long> rowCols;
+
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow) {
+    rowCols.clear();
+    for (auto idx = X.rowPtr[iRow]; idx < X.rowPtr[iRow + 1]; ++idx) {
+      const auto k = X.colInd[idx];
+      if (k >= X.nCol) continue;
+      for (auto jdx = Y.rowPtr[k]; jdx < Y.rowPtr[k + 1]; ++jdx) {
+        const auto jCol = Y.colInd[jdx];
+        if (jCol >= Y.nCol || marker[jCol] == iRow) continue;
+        marker[jCol] = iRow;
+        rowCols.push_back(jCol);
+      }
+    }
+    std::sort(rowCols.begin(), rowCols.end());
+    Z.colInd.insert(Z.colInd.end(), rowCols.begin(), rowCols.end());
+    Z.rowPtr[iRow + 1] = Z.colInd.size();
+  }
+
+  /*--- Numeric product, the marker stores the position of a column in the current row. ---*/
+
+  Z.values.assign(Z.colInd.size() * blkSize, 0.0);
+
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow) {
+    for (auto idx = Z.rowPtr[iRow]; idx < Z.rowPtr[iRow + 1]; ++idx) marker[Z.colInd[idx]] = idx;
+
+    for (auto idx = X.rowPtr[iRow]; idx < X.rowPtr[iRow + 1]; ++idx) {
+      const auto k = X.colInd[idx];
+      if (k >= X.nCol) continue;
+      for (auto jdx = Y.rowPtr[k]; jdx < Y.rowPtr[k + 1]; ++jdx) {
+        const auto jCol = Y.colInd[jdx];
+        if (jCol >= Y.nCol) continue;
+        BlockProductAdd(&X.values[idx * blkSize], &Y.values[jdx * blkSize], &Z.values[marker[jCol] * blkSize]);
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Transpose(const CBlockCSR& X, CBlockCSR& XT) const {
+  const auto blkSize = nVar * nVar;
+
+  XT.nRow = X.nCol;
+  XT.nCol = X.nRow;
+  XT.diaPtr.clear();
+  XT.rowPtr.assign(X.nCol + 1, 0);
+  XT.colInd.resize(X.colInd.size());
+  XT.values.resize(X.values.size());
+
+  for (const auto jCol : X.colInd) ++XT.rowPtr[jCol + 1];
+  for (auto jCol = 0ul; jCol < X.nCol; ++jCol) XT.rowPtr[jCol + 1] += XT.rowPtr[jCol];
+
+  /*--- Rows of X are visited in order, hence the columns of XT are sorted. ---*/
+  vector<unsigned long> next(XT.rowPtr.begin(), XT.rowPtr.end() - 1);
+
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow) {
+    for (auto idx = X.rowPtr[iRow]; idx < X.rowPtr[iRow + 1]; ++idx) {
+      const auto pos = next[X.colInd[idx]]++;
+      XT.colInd[pos] = iRow;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          XT.values[pos * blkSize + jVar * nVar + iVar] = X.values[idx * blkSize + iVar * nVar + jVar];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BlockInverse(const ScalarType* A, ScalarType* invA) const {
+  ScalarType work[MAXNVAR * MAXNVAR];
+
+  for (auto k = 0ul; k < nVar * nVar; ++k) {
+    work[k] = A[k];
+    invA[k] = 0.0;
+  }
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) invA[iVar * (nVar + 1)] = 1.0;
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    /*--- Partial pivoting. ---*/
+    auto pivot = iVar;
+    for (auto jVar = iVar + 1; jVar < nVar; ++jVar)
+      if (fabs(SU2_TYPE::GetValue(work[jVar * nVar + iVar])) > fabs(SU2_TYPE::GetValue(work[pivot * nVar + iVar])))
+        pivot = jVar;
+    if (pivot != iVar) {
+      for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+        std::swap(work[iVar * nVar + jVar], work[pivot * nVar + jVar]);
+        std::swap(invA[iVar * nVar + jVar], invA[pivot * nVar + jVar]);
+      }
+    }
+
+    const ScalarType inv = 1.0 / work[iVar * (nVar + 1)];
+    for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+      work[iVar * nVar + jVar] *= inv;
+      invA[iVar * nVar + jVar] *= inv;
+    }
+
+    for (auto kVar = 0ul; kVar < nVar; ++kVar) {
+      if (kVar == iVar) continue;
+      const ScalarType factor = work[kVar * nVar + iVar];
+      for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+        work[kVar * nVar + jVar] -= factor * work[iVar * nVar + jVar];
+        invA[kVar * nVar + jVar] -= factor * invA[iVar * nVar + jVar];
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BuildSmoother(CLevel& level) const {
+  const auto& A = level.A;
+  const auto blkSize = nVar * nVar;
+
+  if (kindSmoother != ILU) {
+    SU2_OMP_FOR_STAT(level.ompChunk)
+    for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+      BlockInverse(&A.values[A.diaPtr[iRow] * blkSize], &level.invDiag[iRow * blkSize]);
+    END_SU2_OMP_FOR
+    return;
+  }
+
+  /*--- ILU(0), same algorithm as CSysMatrix::BuildILUPreconditioner without fill-in. The rows of
+   *    each level of the lower part only depend on rows of previous levels. ---*/
+
+  auto& LU = level.factors;
+
+  SU2_OMP_FOR_STAT(level.ompChunk)
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+    for (auto idx = A.rowPtr[iRow] * blkSize; idx < A.rowPtr[iRow + 1] * blkSize; ++idx) LU[idx] = A.values[idx];
+  END_SU2_OMP_FOR
+
+  auto factorizeRow = [&](unsigned long iRow) {
+    const auto rowBegin = A.colInd.begin() + A.rowPtr[iRow];
+    const auto rowEnd = A.colInd.begin() + A.rowPtr[iRow + 1];
+    ScalarType Lik[MAXNVAR * MAXNVAR];
+
+    for (auto idx_ik = A.rowPtr[iRow]; idx_ik < A.diaPtr[iRow]; ++idx_ik) {
+      const auto k = A.colInd[idx_ik];
+
+      /*--- L_ik = A_ik * U_kk^{-1} ---*/
+      for (auto m = 0ul; m < blkSize; ++m) Lik[m] = 0.0;
+      BlockProductAdd(&LU[idx_ik * blkSize], &level.invDiag[k * blkSize], Lik);
+      for (auto m = 0ul; m < blkSize; ++m) LU[idx_ik * blkSize + m] = Lik[m];
+
+      /*--- A_ij -= L_ik * U_kj, for j > k in the pattern of row i (the columns are sorted, halos are last). ---*/
+      auto it = rowBegin;
+      for (auto idx_kj = A.diaPtr[k] + 1; idx_kj < A.rowPtr[k + 1] && A.colInd[idx_kj] < A.nRow; ++idx_kj) {
+        it = std::lower_bound(it, rowEnd, A.colInd[idx_kj]);
+        if (it == rowEnd) break;
+        if (*it != A.colInd[idx_kj]) continue;
+        const auto idx_ij = it - A.colInd.begin();
+        BlockProductAdd(Lik, &LU[idx_kj * blkSize], &LU[idx_ij * blkSize], -1.0);
+      }
+    }
+    BlockInverse(&LU[A.diaPtr[iRow] * blkSize], &level.invDiag[iRow * blkSize]);
+  };
+
+  LevelScheduledSweep(level.lower, factorizeRow);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BuildCoarsestSolver(const CLevel& level) {
+  const auto& A = level.A;
+  const int size = SU2_MPI::GetSize();
+  const int nLocal = A.nRow * nVar;
+
+  /*--- Layout of the global system, the rows of each rank are contiguous (same numbering as the aggregates). ---*/
+  denseCounts.resize(size);
+  denseDispls.assign(size + 1, 0);
+  SU2_MPI::Allgather(&nLocal, 1, MPI_INT, denseCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) denseDispls[iRank + 1] = denseDispls[iRank] + denseCounts[iRank];
+
+  const unsigned long n = denseDispls[size];
+
+  if (n > MAX_DENSE_SIZE) {
+    denseLU.clear();
+    densePivots.clear();
+    denseRhs.clear();
+    return;
+  }
+
+  /*--- Dense LU factorization with partial pivoting, of the operator gathered on all ranks. ---*/
+
+  const auto first = denseDispls[SU2_MPI::GetRank()] / nVar;
+  auto globalCol = [&](unsigned long j) { return (j < A.nRow) ? first + j : level.haloGlobal[j - A.nRow]; };
+
+  vector<ScalarType> localRows(n * n, 0.0);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    for (auto idx = A.rowPtr[iRow]; idx < A.rowPtr[iRow + 1]; ++idx) {
+      const auto jRow = globalCol(A.colInd[idx]);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          localRows[((first + iRow) * nVar + iVar) * n + jRow * nVar + jVar] =
+              A.values[(idx * nVar + iVar) * nVar + jVar];
+    }
+  }
+
+  denseLU.resize(n * n);
+  densePivots.resize(n);
+  denseRhs.resize(n);
+
+#ifdef HAVE_MPI
+  SelectMPIWrapper<ScalarType>::W::Allreduce(localRows.data(), denseLU.data(), n * n, ScalarMPIType<ScalarType>(),
+                                             MPI_SUM, SU2_MPI::GetComm());
+#else
+  denseLU = localRows;
+#endif
+
+  for (auto k = 0ul; k < n; ++k) {
+    auto pivot = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(SU2_TYPE::GetValue(denseLU[i * n + k])) > fabs(SU2_TYPE::GetValue(denseLU[pivot * n + k]))) pivot = i;
+    densePivots[k] = pivot;
+    if (pivot != k)
+      for (auto j = 0ul; j < n; ++j) std::swap(denseLU[k * n + j], denseLU[pivot * n + j]);
+
+    if (denseLU[k * n + k] == 0.0) SU2_MPI::Error("Singular coarsest AMG operator.", CURRENT_FUNCTION);
+
+    for (auto i = k + 1; i < n; ++i) {
+      const ScalarType factor = denseLU[i * n + k] / denseLU[k * n + k];
+      denseLU[i * n + k] = factor;
+      for (auto j = k + 1; j < n; ++j) denseLU[i * n + j] -= factor * denseLU[k * n + j];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CLevel& level, const ScalarType* b, ScalarType* x) const {
+  const auto& A = level.A;
+  const auto blkSize = nVar * nVar;
+
+  switch (kindSmoother) {
+    case JACOBI:
+      SU2_OMP_FOR_STAT(level.ompChunk)
+      for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+        BlockVectorProduct(&level.invDiag[iRow * blkSize], &b[iRow * nVar], &x[iRow * nVar]);
+      END_SU2_OMP_FOR
+      break;
+
+    case LU_SGS:
+      /*--- (D+L) x* = b, the couplings to halos (last columns) are not included. ---*/
+      LevelScheduledSweep(level.lower, [&](unsigned long iRow) {
+        ScalarType tmp[MAXNVAR];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = b[iRow * nVar + iVar];
+        for (auto idx = A.rowPtr[iRow]; idx < A.diaPtr[iRow]; ++idx) {
+          const auto j = A.colInd[idx];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              tmp[iVar] -= A.values[idx * blkSize + iVar * nVar + jVar] * x[j * nVar + jVar];
+        }
+        BlockVectorProduct(&level.invDiag[iRow * blkSize], tmp, &x[iRow * nVar]);
+      });
+      /*--- (D+U) x = D x* ---*/
+      LevelScheduledSweep(level.upper, [&](unsigned long iRow) {
+        ScalarType tmp[MAXNVAR], upper[MAXNVAR] = {0.0};
+        for (auto idx = A.diaPtr[iRow] + 1; idx < A.rowPtr[iRow + 1] && A.colInd[idx] < A.nRow; ++idx)
+          BlockVectorAdd(&A.values[idx * blkSize], &x[A.colInd[idx] * nVar], upper);
+        BlockVectorProduct(&level.invDiag[iRow * blkSize], upper, tmp);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iRow * nVar + iVar] -= tmp[iVar];
+      });
+      break;
+
+    default:
+      /*--- ILU(0), forward substitution with unit lower factor, then backward with upper. ---*/
+      LevelScheduledSweep(level.lower, [&](unsigned long iRow) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iRow * nVar + iVar] = b[iRow * nVar + iVar];
+        for (auto idx = A.rowPtr[iRow]; idx < A.diaPtr[iRow]; ++idx) {
+          const auto j = A.colInd[idx];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              x[iRow * nVar + iVar] -= level.factors[idx * blkSize + iVar * nVar + jVar] * x[j * nVar + jVar];
+        }
+      });
+      LevelScheduledSweep(level.upper, [&](unsigned long iRow) {
+        ScalarType tmp[MAXNVAR];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = x[iRow * nVar + iVar];
+        for (auto idx = A.diaPtr[iRow] + 1; idx < A.rowPtr[iRow + 1] && A.colInd[idx] < A.nRow; ++idx) {
+          const auto j = A.colInd[idx];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              tmp[iVar] -= level.factors[idx * blkSize + iVar * nVar + jVar] * x[j * nVar + jVar];
+        }
+        BlockVectorProduct(&level.invDiag[iRow * blkSize], tmp, &x[iRow * nVar]);
+      });
+      break;
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(const CLevel& level) const {
+  const auto A = level.A.View();
+
+  SyncHalos(level.comms, level.x.data(), false);
+
+  SU2_OMP_FOR_STAT(level.ompChunk)
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    ScalarType tmp[MAXNVAR];
+    RowProduct(A, iRow, level.x.data(), tmp);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      level.r[iRow * nVar + iVar] = level.b[iRow * nVar + iVar] - tmp[iVar];
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::VCycle(unsigned short iLevel) const {
+  const auto& level = levels[iLevel];
+  const auto nRow = level.A.nRow;
+
+  if (iLevel + 1ul == levels.size()) {
+    if (!denseLU.empty()) {
+      /*--- Direct solution of the global system, gather the right hand side, permute, then forward and
+       *    backward substitutions. ---*/
+      SU2_OMP_MASTER {
+        const auto n = densePivots.size();
+        const auto nLocal = nRow * nVar;
+        auto& x = denseRhs;
+#ifdef HAVE_MPI
+        const auto type = ScalarMPIType<ScalarType>();
+        SelectMPIWrapper<ScalarType>::W::Allgatherv(level.b.data(), nLocal, type, x.data(), denseCounts.data(),
+                                                    denseDispls.data(), type, SU2_MPI::GetComm());
+#else
+        std::copy_n(level.b.begin(), nLocal, x.begin());
+#endif
+        for (auto k = 0ul; k < n; ++k) std::swap(x[k], x[densePivots[k]]);
+        for (auto i = 0ul; i < n; ++i)
+          for (auto j = 0ul; j < i; ++j) x[i] -= denseLU[i * n + j] * x[j];
+        for (auto i = n; i-- > 0;) {
+          for (auto j = i + 1; j < n; ++j) x[i] -= denseLU[i * n + j] * x[j];
+          x[i] /= denseLU[i * n + i];
+        }
+        std::copy_n(x.begin() + denseDispls[SU2_MPI::GetRank()], nLocal, level.x.begin());
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+      return;
+    }
+
+    /*--- Too large to factorize, use a few smoothing iterations. ---*/
+    Smooth(level, level.b.data(), level.x.data());
+    for (auto iter = 1ul; iter < COARSE_SMOOTHING_ITER; ++iter) {
+      Residual(level);
+      Smooth(level, level.r.data(), level.dx.data());
+
+      SU2_OMP_FOR_STAT(level.ompChunk)
+      for (auto i = 0ul; i < nRow * nVar; ++i) level.x[i] += level.dx[i];
+      END_SU2_OMP_FOR
+    }
+    return;
+  }
+
+  const auto& coarse = levels[iLevel + 1];
+  const auto R = level.R.View();
+  const auto P = level.P.View();
+
+  /*--- Pre-smoothing with zero initial guess. ---*/
+  Smooth(level, level.b.data(), level.x.data());
+
+  /*--- Restriction of the residual and coarse correction, the halo rows of the restriction are added to
+   *    their owners, and the halos of the correction are updated before the prolongation. ---*/
+  Residual(level);
+
+  SU2_OMP_FOR_STAT(coarse.ompChunk)
+  for (auto iRow = 0ul; iRow < R.nRow; ++iRow) RowProduct(R, iRow, level.r.data(), &coarse.b[iRow * nVar]);
+  END_SU2_OMP_FOR
+  SyncHalos(coarse.comms, coarse.b.data(), true);
+
+  VCycle(iLevel + 1);
+  SyncHalos(coarse.comms, coarse.x.data(), false);
+
+  SU2_OMP_FOR_STAT(level.ompChunk)
+  for (auto iRow = 0ul; iRow < P.nRow; ++iRow) {
+    ScalarType tmp[MAXNVAR];
+    RowProduct(P, iRow, coarse.x.data(), tmp);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) level.x[iRow * nVar + iVar] += tmp[iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing, x += M^{-1} (b - A x), the coarse "b" is free to hold the update. ---*/
+  Residual(level);
+  Smooth(level, level.r.data(), level.b.data());
+
+  SU2_OMP_FOR_STAT(level.ompChunk)
+  for (auto i = 0ul; i < nRow * nVar; ++i) level.x[i] += level.b[i];
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::CoarseGridCorrection(const CSysVector<ScalarType>& res,
+                                                           CSysVector<ScalarType>& corr) const {
+  const auto R = levels[0].R.View();
+  const auto P = levels[0].P.View();
+  const auto& coarse = levels[1];
+
+  /*--- Restriction of the fine residual, the coarse rows are independent, those of halos are added to their
+   *    owners. The restriction only uses the local rows of the residual. ---*/
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iRow = 0ul; iRow < R.nRow; ++iRow) RowProduct(R, iRow, &res[0], &coarse.b[iRow * nVar]);
+  END_SU2_OMP_FOR
+  SyncHalos(coarse.comms, coarse.b.data(), true);
+
+  VCycle(1);
+  SyncHalos(coarse.comms, coarse.x.data(), false);
+
+  /*--- Prolongation of the coarse correction. ---*/
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iRow = 0ul; iRow < P.nRow; ++iRow) RowProduct(P, iRow, coarse.x.data(), &corr[iRow * nVar]);
+  END_SU2_OMP_FOR
+}
+
+/*--- Explicit instantiations, same types as CSysMatrix. ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
@@ -0,0 +1,84 @@
+/*!
+ * \file CLinearSystemFile.cpp
+ * \brief Binary storage of distributed linear systems for offline replay (SU2_LINBENCH).
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CLinearSystemFile.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <cstring>
+#include <fstream>
+
+void CLinearSystemFile::Write(const std::string& fileName) const {
+  std::ofstream file(fileName, std::ios::binary);
+  if (!file.is_open()) {
+    SU2_MPI::Error("Could not open " + fileName + " to write the linear system.", CURRENT_FUNCTION);
+  }
+
+  auto write = [&file](const auto& vec) {
+    file.write(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(vec[0]));
+  };
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  write(globalRow);
+  write(rowPtr);
+  write(globalCol);
+  write(values);
+  write(rhs);
+
+  if (!file.good()) {
+    SU2_MPI::Error("Failed to write the linear system to " + fileName + ".", CURRENT_FUNCTION);
+  }
+}
+
+void CLinearSystemFile::Read(const std::string& fileName, bool headerOnly) {
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file.is_open()) {
+    SU2_MPI::Error("Could not open the linear system file " + fileName + ".", CURRENT_FUNCTION);
+  }
+
+  file.read(reinterpret_cast<char*>(&header), sizeof(Header));
+  if (!file.good() || std::memcmp(header.magic, Header().magic, sizeof(header.magic)) != 0) {
+    SU2_MPI::Error(fileName + " is not a linear system file.", CURRENT_FUNCTION);
+  }
+  if (header.version != VERSION) {
+    SU2_MPI::Error(fileName + " was written with an incompatible version of SU2.", CURRENT_FUNCTION);
+  }
+  if (headerOnly) return;
+
+  const auto blockSize = header.nVar * header.nEqn;
+
+  auto read = [&file](auto& vec, uint64_t size) {
+    vec.resize(size);
+    file.read(reinterpret_cast<char*>(vec.data()), size * sizeof(vec[0]));
+  };
+  read(globalRow, header.nPointDomain);
+  read(rowPtr, header.nPointDomain + 1);
+  read(globalCol, header.nNonZero);
+  read(values, header.nNonZero * blockSize);
+  read(rhs, header.nPointDomain * header.nVar);
+
+  if (!file.good()) {
+    SU2_MPI::Error(fileName + " is truncated.", CURRENT_FUNCTION);
+  }
+}
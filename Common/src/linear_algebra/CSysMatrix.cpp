@@ -28,6 +28,9 @@
 #include "../../include/linear_algebra/CSysMatrix.inl"
 
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/linear_algebra/CGraphPartitioning.hpp"
+#include "../../include/linear_algebra/CLinearSystemFile.hpp"
+#include "../../include/linear_algebra/blas_structure.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
 
 #include <cmath>
@@ -39,6 +42,15 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
   ilu_fill_in = 0;
 
   omp_partitions = nullptr;
+  omp_level_sched = false;
+
+  schwarzOverlap = 0;
+  nPointPrec = 0;
+
+  cheb_degree = 0;
+  cheb_lower = cheb_upper = 0.0;
+
+  fixedBlockSize = 0;
 
   matrix = nullptr;
   row_ptr = nullptr;
@@ -53,6 +65,12 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
 
   invM = nullptr;
 
+  floatStorage = false;
+  floatStale = true;
+  matrix_flt = nullptr;
+  ILU_matrix_flt = nullptr;
+  invM_flt = nullptr;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter = nullptr;
   MatrixVectorProductJitterBetaOne = nullptr;
@@ -67,6 +85,9 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(matrix_flt);
+  MemoryAllocation::aligned_free(ILU_matrix_flt);
+  MemoryAllocation::aligned_free(invM_flt);
 
   if (useCuda) {
     GPUMemoryAllocation::gpu_free(d_matrix);
@@ -119,8 +140,18 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     prec = config->GetKind_Grad_Linear_Solver_Prec();
   }
 
-  const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  /*--- The finest level of the AMG preconditioner is smoothed by one of the other preconditioners. ---*/
+  const auto smoother = (prec == AMG) ? config->GetKind_Linear_Solver_AMG_Smoother() : prec;
+
+  const bool ilu_needed = (smoother == ILU);
+  const bool diag_needed = ilu_needed || (smoother == JACOBI) || (prec == LINELET) || (prec == CHEBYSHEV);
+
+  if (floatStorage && !(ilu_needed || smoother == JACOBI || smoother == LU_SGS || prec == CHEBYSHEV)) {
+    SU2_MPI::Error(
+        "Single precision storage of the linear system requires the ILU, LU_SGS, JACOBI, AMG, or CHEBYSHEV "
+        "preconditioner.",
+        CURRENT_FUNCTION);
+  }
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -128,6 +159,10 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- With overlap the halo rows are included in the ILU and LU_SGS preconditioners. ---*/
+  schwarzOverlap = (size > 1 && (prec == ILU || prec == LU_SGS)) ? config->GetLinear_Solver_Schwarz_Overlap() : 0;
+  nPointPrec = (schwarzOverlap > 0) ? nPoint : nPointDomain;
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -142,6 +177,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   auto allocAndInit = [](ScalarType*& ptr, unsigned long num) {
     ptr = MemoryAllocation::aligned_alloc<ScalarType, true>(64, num * sizeof(ScalarType));
   };
+  auto allocAndInitFloat = [](FloatType*& ptr, unsigned long num) {
+    ptr = MemoryAllocation::aligned_alloc<FloatType, true>(64, num * sizeof(FloatType));
+  };
 
   allocAndInit(matrix, nnz * nVar * nEqn);
 
@@ -190,9 +228,43 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   /*--- Preconditioners. ---*/
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+  /*--- With single precision storage the factors are only stored in single precision. ---*/
 
-  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+  if (floatStorage) {
+    allocAndInitFloat(matrix_flt, nnz * nVar * nEqn);
+    if (ilu_needed) allocAndInitFloat(ILU_matrix_flt, nnz_ilu * nVar * nEqn);
+    if (diag_needed) allocAndInitFloat(invM_flt, nPointPrec * nVar * nEqn);
+  } else {
+    if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+    if (diag_needed) allocAndInit(invM, nPointPrec * nVar * nEqn);
+  }
+
+  if (schwarzOverlap > 0) {
+    /*--- The subdomain is extended with the halo points received from other ranks, with one layer
+     *    of overlap only those adjacent to domain points, with two layers the entire halo layer. ---*/
+    vector<bool> inOverlap(nPoint, false);
+    const auto nRecv = (geometry->nP2PRecv > 0) ? geometry->nPoint_P2PRecv[geometry->nP2PRecv] : 0;
+    for (auto iRecv = 0; iRecv < nRecv; ++iRecv) inOverlap[geometry->Local_Point_P2PRecv[iRecv]] = true;
+
+    for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint) {
+      /*--- The columns are sorted, the first one tells if the point is adjacent to the domain. ---*/
+      if (schwarzOverlap == 1 && col_ind[row_ptr[iPoint]] >= nPointDomain) inOverlap[iPoint] = false;
+      if (!inOverlap[iPoint]) schwarzExcluded.push_back(iPoint);
+    }
+
+    schwarzDiag.Initialize(nPoint, nPointDomain, nVar * nEqn, 0.0);
+    schwarzVec.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
+  if (prec == AMG) {
+    amg_residual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    amg_correction.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
+  if (prec == CHEBYSHEV) {
+    cheb_degree = config->GetLinear_Solver_Chebyshev_Degree();
+    for (auto& vec : cheb_vec) vec.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
 
   /*--- Thread parallel initialization. ---*/
 
@@ -208,30 +280,59 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   /*--- This is akin to the row_ptr. ---*/
   omp_partitions = new unsigned long[omp_num_parts + 1];
-  for (unsigned long i = 0; i <= omp_num_parts; ++i) omp_partitions[i] = nPointDomain;
+  for (unsigned long i = 0; i <= omp_num_parts; ++i) omp_partitions[i] = nPointPrec;
 
   /*--- Work estimate based on non-zeros to produce balanced partitions. ---*/
 
   const auto row_ptr_prec = ilu_needed ? row_ptr_ilu : row_ptr;
-  const auto nnz_prec = row_ptr_prec[nPointDomain];
+  const auto nnz_prec = row_ptr_prec[nPointPrec];
 
   const auto nnz_per_part = roundUpDiv(nnz_prec, omp_num_parts);
 
-  for (auto iPoint = 0ul, part = 0ul; iPoint < nPointDomain; ++iPoint) {
+  for (auto iPoint = 0ul, part = 0ul; iPoint < nPointPrec; ++iPoint) {
     if (row_ptr_prec[iPoint] >= part * nnz_per_part) omp_partitions[part++] = iPoint;
   }
 
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) {
-      cout << "WARNING: Redundant thread has been detected. Performance could be impacted due to low number of nodes "
-              "per thread."
-           << endl;
-      break;
+  /*--- Level sets of the preconditioner pattern, these make the thread-parallel
+   *    triangular solves exact (independent of the number of threads). ---*/
+
+  omp_level_sched = config->GetLinear_Solver_Prec_Level_Scheduling() && (ilu_needed || smoother == LU_SGS);
+
+  if (omp_level_sched) {
+    const auto dia_ptr_prec = ilu_needed ? dia_ptr_ilu : dia_ptr;
+    const auto col_ind_prec = ilu_needed ? col_ind_ilu : col_ind;
+
+    /*--- Narrow levels are not worth a barrier, they are grouped and processed by one thread. ---*/
+    const unsigned long minWidth = omp_num_parts * OMP_MIN_SIZE;
+
+    for (auto* levelSets : {&lowerLevels, &upperLevels}) {
+      const bool upper = (levelSets == &upperLevels);
+      CLevelScheduling<unsigned long> levelSchedule(nPointPrec);
+      levelSchedule.Partition(row_ptr_prec, dia_ptr_prec, col_ind_prec, upper, levelSets->rows, levelSets->offsets,
+                              levelSets->chains, minWidth);
+      levelSets->minWidth = minWidth;
+    }
+  } else {
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) {
+        cout << "WARNING: Redundant thread has been detected. Performance could be impacted due to low number of "
+                "nodes per thread."
+             << endl;
+        break;
+      }
     }
   }
 
+  /*--- Select the block kernels specialized at compile-time for common (square) block sizes. ---*/
+
+  fixedBlockSize = 0;
+  if (nVar == nEqn) {
+    fixedBlockSize = DispatchBlockSize(
+        nVar, [](auto N) { return static_cast<unsigned long>(decltype(N)::value); }, []() { return 0ul; });
+  }
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -380,7 +481,6 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
-  int ind;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -389,7 +489,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(geometry->WaitAnyP2PRecv(iMessage, COMM_TYPE_DOUBLE, COUNT_PER_POINT,
+                                                        commType == MPI_QUANTITIES::SOLUTION_MATRIXTRANS, status);)
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -397,12 +498,15 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
     switch (commType) {
       case MPI_QUANTITIES::SOLUTION_MATRIX: {
-        const su2double* bufDRecv = geometry->bufD_P2PRecv;
-
         /*--- We know the offsets based on the source rank. ---*/
 
         const auto jRecv = geometry->P2PRecv2Neighbor[source];
 
+        /*--- Get the start of this message, the data of neighbors on the same
+         node may be read directly from their shared buffer. ---*/
+
+        const su2double* bufDRecv = geometry->GetP2PRecvBuffer(jRecv, COUNT_PER_POINT);
+
         /*--- Get the offset for the start of this message. ---*/
 
         const auto msg_offset = geometry->nPoint_P2PRecv[jRecv];
@@ -417,9 +521,9 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
           const auto iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-          /*--- Compute the offset in the recv buffer for this point. ---*/
+          /*--- Compute the offset in the message for this point. ---*/
 
-          const auto buf_offset = (msg_offset + iRecv) * COUNT_PER_POINT;
+          const auto buf_offset = iRecv * COUNT_PER_POINT;
 
           /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -490,6 +594,9 @@ void CSysMatrix<ScalarType>::SetValZero() {
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size - begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 }
 
@@ -499,6 +606,33 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar * nEqn; ++index) matrix[dia_ptr[iPoint] * nVar * nEqn + index] = 0.0;
   END_SU2_OMP_FOR
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::InvalidateFloatValues() {
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+const typename CSysMatrix<ScalarType>::FloatType* CSysMatrix<ScalarType>::UpdateFloatValues() const {
+  /*--- All threads see the same flag, it is only reset after the implicit barrier of the loop. ---*/
+  if (!floatStale) return matrix_flt;
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix_flt[i] = matrix[i];
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  floatStale = false;
+  END_SU2_OMP_MASTER
+
+  return matrix_flt;
 }
 
 template <class ScalarType>
@@ -511,21 +645,25 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
 #else
 #define A(I, J) matrix[(I)*nVar + (J)]
 
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar, jVar) / A(jVar, jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
+  DispatchBlockSize(
+      fixedBlockSize, [&](auto N) { gauss_fixed<decltype(N)::value>(matrix, vec); },
+      [&]() {
+        /*--- Transform system in Upper Matrix ---*/
+        for (auto iVar = 1ul; iVar < nVar; iVar++) {
+          for (auto jVar = 0ul; jVar < iVar; jVar++) {
+            ScalarType weight = A(iVar, jVar) / A(jVar, jVar);
+            for (auto kVar = jVar; kVar < nVar; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
+            vec[iVar] -= weight * vec[jVar];
+          }
+        }
 
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--;  // unsigned type
-    for (auto jVar = iVar + 1; jVar < nVar; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
-    vec[iVar] /= A(iVar, iVar);
-  }
+        /*--- Backwards substitution ---*/
+        for (auto iVar = nVar; iVar > 0ul;) {
+          iVar--;  // unsigned type
+          for (auto jVar = iVar + 1; jVar < nVar; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
+          vec[iVar] /= A(iVar, iVar);
+        }
+      });
 #undef A
 #endif
 }
@@ -611,11 +749,21 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  if (floatStorage) {
+    const auto* values = UpdateFloatValues();
+
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(values, vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(matrix, vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -623,12 +771,49 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+template <class RowKernel>
+void CSysMatrix<ScalarType>::LevelScheduledSweep(const CLevelSets& levelSets, const RowKernel& rowKernel) const {
+  for (auto iChain = 0ul; iChain + 1 < levelSets.chains.size(); ++iChain) {
+    const auto firstLevel = levelSets.chains[iChain];
+    const auto lastLevel = levelSets.chains[iChain + 1];
+    if (firstLevel == lastLevel) continue;
+
+    const auto begin = levelSets.offsets[firstLevel];
+    const auto end = levelSets.offsets[lastLevel];
+
+    if (lastLevel - firstLevel == 1 && end - begin >= levelSets.minWidth) {
+      /*--- The rows of one level are independent, the implicit barrier
+       *    makes them visible to all threads before the next level. ---*/
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto k = begin; k < end; ++k) rowKernel(levelSets.rows[k]);
+      END_SU2_OMP_FOR
+    } else {
+      /*--- Chain of narrow levels, the rows are processed in order. ---*/
+      SU2_OMP_MASTER
+      for (auto k = begin; k < end; ++k) rowKernel(levelSets.rows[k]);
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+  }
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
+  InvalidateFloatValues();
+
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (floatStorage) {
+      /*--- Invert with full precision and then round. ---*/
+      ScalarType invBlock[MAXNVAR * MAXNVAR];
+      InverseDiagonalBlock(iPoint, invBlock);
+      MatrixCopy(invBlock, &invM_flt[iPoint * nVar * nVar]);
+    } else {
+      InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
+    }
+  }
   END_SU2_OMP_FOR
 }
 
@@ -639,8 +824,12 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (floatStorage)
+      MatrixVectorProduct(&(invM_flt[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+    else
+      MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+  }
   END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
@@ -648,28 +837,95 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSchwarzOverlap(CGeometry* geometry, const CConfig* config) {
+  /*--- Also the first step of building the ILU and LU_SGS preconditioners. ---*/
+  InvalidateFloatValues();
+
+  if (schwarzOverlap == 0) return;
+
+  const auto blkSz = nVar * nEqn;
+
+  /*--- The off-diagonal blocks of the halo rows are the contributions of the edges (or elements)
+   *    of this rank, the diagonal blocks are incomplete and are replaced by those of the owners. ---*/
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto k = 0ul; k < blkSz; ++k) schwarzDiag(iPoint, k) = matrix[dia_ptr[iPoint] * blkSz + k];
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(schwarzDiag, geometry, config);
+  CSysMatrixComms::Complete(schwarzDiag, geometry, config);
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint)
+    for (auto k = 0ul; k < blkSz; ++k) matrix[dia_ptr[iPoint] * blkSz + k] = schwarzDiag(iPoint, k);
+  END_SU2_OMP_FOR
+
+  /*--- Points outside of the overlap are decoupled, their restricted values are 0. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < schwarzExcluded.size(); ++i) {
+    const auto iPoint = schwarzExcluded[i];
+    for (auto k = row_ptr[iPoint] * blkSz; k < row_ptr[iPoint + 1] * blkSz; ++k) matrix[k] = 0.0;
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) matrix[dia_ptr[iPoint] * blkSz + iVar * (nEqn + 1)] = 1.0;
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+const CSysVector<ScalarType>& CSysMatrix<ScalarType>::SchwarzRestriction(const CSysVector<ScalarType>& vec,
+                                                                         CGeometry* geometry,
+                                                                         const CConfig* config) const {
+  if (schwarzOverlap == 0) return vec;
+
+  schwarzVec = vec;
+
+  /*--- Coherent view of the domain values before they are sent. ---*/
+  SU2_OMP_BARRIER
+
+  CSysMatrixComms::Initiate(schwarzVec, geometry, config);
+  CSysMatrixComms::Complete(schwarzVec, geometry, config);
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < schwarzExcluded.size(); ++i)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) schwarzVec(schwarzExcluded[i], iVar) = 0.0;
+  END_SU2_OMP_FOR
+
+  return schwarzVec;
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
+  if (floatStorage)
+    BuildILUPreconditioner(ILU_matrix_flt, invM_flt);
+  else
+    BuildILUPreconditioner(ILU_matrix, invM);
+}
+
+template <class ScalarType>
+template <class T>
+void CSysMatrix<ScalarType>::BuildILUPreconditioner(T* ilu, T* inv) {
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
   if (ilu_fill_in == 0) {
     /*--- ILU0, direct copy. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
-    for (auto iVar = 0ul; iVar < nnz * nVar * nVar; ++iVar) ILU_matrix[iVar] = matrix[iVar];
+    for (auto iVar = 0ul; iVar < nnz * nVar * nVar; ++iVar) ilu[iVar] = matrix[iVar];
     END_SU2_OMP_FOR
   } else {
     /*--- ILUn clear the ILU matrix first. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
-    for (auto iVar = 0ul; iVar < nnz_ilu * nVar * nVar; iVar++) ILU_matrix[iVar] = 0.0;
+    for (auto iVar = 0ul; iVar < nnz_ilu * nVar * nVar; iVar++) ilu[iVar] = 0.0;
     END_SU2_OMP_FOR
 
     /*--- ILUn, traverse matrix to access its blocks
      *    sequentially and set them in the ILU matrix. ---*/
     SU2_OMP_FOR_DYN(omp_heavy_size)
-    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iPoint = 0ul; iPoint < nPointPrec; iPoint++) {
       for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; index++) {
         auto jPoint = col_ind[index];
-        SetBlock_ILUMatrix(iPoint, jPoint, &matrix[index * nVar * nVar]);
+        SetBlock_ILUMatrix(ilu, iPoint, jPoint, &matrix[index * nVar * nVar]);
       }
     }
     END_SU2_OMP_FOR
@@ -677,70 +933,80 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
-  /*--- OpenMP Parallelization, a loop construct is used to ensure
-   *    the preconditioner is computed correctly even if called
-   *    outside of a parallel section. ---*/
+  /*--- Factorization of row iPoint considering only the submatrix defined from
+   *    row/col "begin" to row/col "end-1" (i.e. the range [begin,end[). The rows
+   *    it depends on must have been factorized and their diagonal inverted. ---*/
 
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  auto factorizeRow = [&](unsigned long iPoint, unsigned long begin, unsigned long end) {
+    T weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
 
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
-     *    what the MPI-only implementation does. ---*/
+    /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+      auto jPoint = col_ind_ilu[index];
 
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
+      /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+      if (jPoint < begin) continue;
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+      /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        auto jPoint = col_ind_ilu[index];
+      auto Block_ij = &ilu[index * nVar * nVar];
+      MatrixMatrixProduct(Block_ij, &inv[jPoint * nVar * nVar], weight);
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+      /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-        if (jPoint < begin) continue;
+      for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+        /*--- Get the column index (kPoint > jPoint). ---*/
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+        auto kPoint = col_ind_ilu[index_];
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+        if (kPoint >= end) break;
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+        /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+        auto Block_ik = GetBlock_ILUMatrix(ilu, iPoint, kPoint);
+
+        if (Block_ik != nullptr) {
+          auto Block_jk = &ilu[index_ * nVar * nVar];
+          MatrixMatrixProduct(weight, Block_jk, aux_block);
+          MatrixSubtraction(Block_ik, aux_block, Block_ik);
+        }
+      }
 
-          auto kPoint = col_ind_ilu[index_];
+      /*--- Lastly, store "weight" in the lower triangular part, which
+       will be reused during the forward solve in the precon/smoother. ---*/
 
-          if (kPoint >= end) break;
+      for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+    }
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+    /*--- Invert and store the diagonal block to later compute the weights of other rows. ---*/
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+    InverseDiagonalBlock_ILUMatrix(ilu, iPoint, &inv[iPoint * nVar * nVar]);
+  };
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+  if (omp_level_sched) {
+    /*--- Exact factorization, the rows of each level only depend on previous levels. ---*/
+    LevelScheduledSweep(lowerLevels, [&](unsigned long iPoint) { factorizeRow(iPoint, 0, nPointPrec); });
+    return;
+  }
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+  /*--- OpenMP Parallelization, a loop construct is used to ensure
+   *    the preconditioner is computed correctly even if called
+   *    outside of a parallel section. ---*/
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
-      }
-    }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+  SU2_OMP_FOR_STAT(1)
+  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+    if (begin == end) continue;
+
+    /*--- Each thread will work on the submatrix [begin,end[. Which is
+     *    exactly what the MPI-only implementation does. ---*/
+
+    for (auto iPoint = begin; iPoint < end; iPoint++) factorizeRow(iPoint, begin, end);
   }
   END_SU2_OMP_FOR
 }
@@ -748,123 +1014,232 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                       CGeometry* geometry, const CConfig* config) const {
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
+  const auto& rhs = SchwarzRestriction(vec, geometry, config);
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  if (floatStorage)
+    ComputeILUPreconditioner(ILU_matrix_flt, invM_flt, rhs, prod);
+  else
+    ComputeILUPreconditioner(ILU_matrix, invM, rhs, prod);
 
-    ScalarType aux_vec[MAXNVAR];
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
 
+template <class ScalarType>
+template <class T>
+void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const T* ilu, const T* inv, const CSysVector<ScalarType>& vec,
+                                                      CSysVector<ScalarType>& prod) const {
+  /*--- Forward solve the system using the lower matrix entries that
+   were computed and stored during the ILU preprocessing. Note
+   that we are overwriting the residual vector as we go. ---*/
+
+  auto forwardRow = [&](unsigned long iPoint, unsigned long begin) {
     /*--- Copy vector to then work on prod in place ---*/
+    for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = vec[iPoint * nVar + iVar];
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint < begin) continue;
+      auto Block_ij = &ilu[index * nVar * nVar];
+      MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+    }
+  };
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+  /*--- Backwards substitution. ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
+  auto backwardRow = [&](unsigned long iPoint, unsigned long end) {
+    ScalarType aux_vec[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint >= end) break;
+      auto Block_ij = &ilu[index * nVar * nVar];
+      MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
     }
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    MatrixVectorProduct(&inv[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+  };
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+  if (omp_level_sched) {
+    LevelScheduledSweep(lowerLevels, [&](unsigned long iPoint) { forwardRow(iPoint, 0); });
+    LevelScheduledSweep(upperLevels, [&](unsigned long iPoint) { backwardRow(iPoint, nPointPrec); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      for (auto iPoint = begin; iPoint < end; iPoint++) forwardRow(iPoint, begin);
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      /*--- Starts at the last row. ---*/
+      for (auto iPoint = end; iPoint > begin;) backwardRow(--iPoint, end);
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
+}
 
-  /*--- MPI Parallelization ---*/
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
+                                                         CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                         const CConfig* config) const {
+  const auto& rhs = SchwarzRestriction(vec, geometry, config);
 
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+  if (floatStorage) {
+    /*--- Coherent view of the matrix before updating its copy. ---*/
+    SU2_OMP_BARRIER
+    ComputeLU_SGSPreconditioner(UpdateFloatValues(), rhs, prod, geometry, config);
+  } else {
+    ComputeLU_SGSPreconditioner(matrix, rhs, prod, geometry, config);
+  }
 }
 
 template <class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
+template <class T>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const T* values, const CSysVector<ScalarType>& vec,
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
+  auto forwardRow = [&](unsigned long iPoint, unsigned long begin) {
+    ScalarType low_prod[MAXNVAR];
+    auto idx = iPoint * nVar;
+    LowerProduct(values, prod, iPoint, begin, low_prod);  // Compute L.x*
+    VectorSubtraction(&vec[idx], low_prod, &prod[idx]);   // Compute y = b - L.x*
+    Gauss_Elimination(values, iPoint, &prod[idx]);        // Solve D.x* = y
+  };
+
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+
+  auto backwardRow = [&](unsigned long iPoint, unsigned long row_end) {
+    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+    auto idx = iPoint * nVar;
+    DiagonalProduct(values, prod, iPoint, dia_prod);       // Compute D.x*
+    UpperProduct(values, prod, iPoint, row_end, up_prod);  // Compute U.x_(n+1)
+    VectorSubtraction(dia_prod, up_prod, &prod[idx]);      // Compute y = D.x*-U.x_(n+1)
+    Gauss_Elimination(values, iPoint, &prod[idx]);         // Solve D.x* = y
+  };
+
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  if (omp_level_sched) {
+    /*--- Exact sweeps (equivalent to the MPI implementation) for any number of threads. ---*/
+    LevelScheduledSweep(lowerLevels, [&](unsigned long iPoint) { forwardRow(iPoint, 0); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
+
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1", except the last thread that also considers halos.
+       *    This is NOT exactly equivalent to the MPI implementation on the same
+       *    number of domains, for that we would need to define "thread-halos". ---*/
+
+      for (auto iPoint = begin; iPoint < end; ++iPoint) forwardRow(iPoint, begin);
+    }
+    END_SU2_OMP_FOR
+  }
 
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1", except the last thread that also considers halos.
-     *    This is NOT exactly equivalent to the MPI implementation on the same
-     *    number of domains, for that we would need to define "thread-halos". ---*/
+  /*--- MPI Parallelization, with overlap the halos belong to the local subdomain. ---*/
 
-    ScalarType low_prod[MAXNVAR];
+  if (schwarzOverlap == 0) {
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+  }
 
-    for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint * nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);         // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]);  // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);               // Solve D.x* = y
+  if (omp_level_sched) {
+    LevelScheduledSweep(upperLevels, [&](unsigned long iPoint) { backwardRow(iPoint, nPointPrec); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto row_end = omp_partitions[thread + 1];
+      if (begin == row_end) continue;
+
+      for (auto iPoint = row_end; iPoint > begin;) backwardRow(--iPoint, row_end);
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
+}
 
-  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
-
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto row_end = omp_partitions[thread + 1];
-    if (begin == row_end) continue;
+namespace {
+/*--- Block operations on interleaved batches of blocks (one block per SIMD lane), same algorithms as
+ *    MatrixInverse, Gauss_Elimination, etc. without pivoting, hence the result of each lane is the
+ *    same as with the scalar versions. ---*/
 
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+template <class T>
+FORCEINLINE void BatchedInverse(unsigned long n, T* a, T* inv) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j) inv[i * n + j] = (i == j) ? 1.0 : 0.0;
+
+  for (auto i = 1ul; i < n; ++i) {
+    for (auto j = 0ul; j < i; ++j) {
+      const T weight = a[i * n + j] / a[j * n + j];
+      for (auto k = j; k < n; ++k) a[i * n + k] -= weight * a[j * n + k];
+      for (auto k = 0ul; k <= j; ++k) inv[i * n + k] -= weight * inv[j * n + k];
+    }
+  }
+  for (auto i = n; i > 0;) {
+    --i;
+    for (auto j = i + 1; j < n; ++j)
+      for (auto k = 0ul; k < n; ++k) inv[i * n + k] -= a[i * n + j] * inv[j * n + k];
+    for (auto k = 0ul; k < n; ++k) inv[i * n + k] /= a[i * n + i];
+  }
+}
 
-    for (auto iPoint = row_end; iPoint > begin;) {
-      iPoint--;  // because of unsigned type
-      auto idx = iPoint * nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);           // Compute D.x*
-      UpperProduct(prod, iPoint, row_end, up_prod);      // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]);  // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);             // Solve D.x* = y
+template <class T>
+FORCEINLINE void BatchedGauss(unsigned long n, T* a, T* b) {
+  for (auto i = 1ul; i < n; ++i) {
+    for (auto j = 0ul; j < i; ++j) {
+      const T weight = a[i * n + j] / a[j * n + j];
+      for (auto k = j; k < n; ++k) a[i * n + k] -= weight * a[j * n + k];
+      b[i] -= weight * b[j];
     }
   }
-  END_SU2_OMP_FOR
+  for (auto i = n; i > 0;) {
+    --i;
+    for (auto j = i + 1; j < n; ++j) b[i] -= a[i * n + j] * b[j];
+    b[i] /= a[i * n + i];
+  }
+}
 
-  /*--- MPI Parallelization ---*/
+/*! \brief c = a * b. */
+template <class T>
+FORCEINLINE void BatchedGemm(unsigned long n, const T* a, const T* b, T* c) {
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto j = 0ul; j < n; ++j) c[i * n + j] = 0.0;
+    for (auto k = 0ul; k < n; ++k)
+      for (auto j = 0ul; j < n; ++j) c[i * n + j] += a[i * n + k] * b[k * n + j];
+  }
+}
 
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+/*! \brief c = a * b (overwrite) or c -= a * b. */
+template <bool Overwrite, class T>
+FORCEINLINE void BatchedGemv(unsigned long n, const T* a, const T* b, T* c) {
+  for (auto i = 0ul; i < n; ++i) {
+    T dot = 0.0;
+    for (auto j = 0ul; j < n; ++j) dot += a[i * n + j] * b[j];
+    c[i] = Overwrite ? dot : T(c[i] - dot);
+  }
 }
+}  // namespace
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry* geometry, const CConfig* config) {
@@ -881,6 +1256,14 @@ void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry* geometr
       LineletUpper.resize(nThreads);
       LineletVector.resize(nThreads);
       LineletInvDiag.resize(nThreads);
+      LineletTemp.resize(nThreads);
+
+      /*--- Batching linelets of similar length reduces the work on the padding of the shorter ones. ---*/
+      LineletOrder.resize(li.linelets.size());
+      iota(LineletOrder.begin(), LineletOrder.end(), 0ul);
+      stable_sort(LineletOrder.begin(), LineletOrder.end(), [&li](unsigned long a, unsigned long b) {
+        return li.linelets[a].size() > li.linelets[b].size();
+      });
     }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
@@ -888,9 +1271,10 @@ void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry* geometr
   SU2_OMP_FOR_STAT(1)
   for (int iThread = 0; iThread < nThreads; ++iThread) {
     const auto size = CGeometry::CLineletInfo::MAX_LINELET_POINTS;
-    LineletUpper[iThread].resize(size, nullptr);
+    LineletUpper[iThread].resize(size * nVar * nVar, 0.0);
     LineletVector[iThread].resize(size * nVar, 0.0);
     LineletInvDiag[iThread].resize(size * nVar * nVar, 0.0);
+    LineletTemp[iThread].resize(3 * nVar * nVar + nVar, 0.0);
   }
   END_SU2_OMP_FOR
 }
@@ -912,84 +1296,114 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
       MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
   END_SU2_OMP_FOR
 
-  /*--- Solve the tridiagonal systems for the linelets. ---*/
+  /*--- Solve the tridiagonal systems for batches of linelets, each linelet in a SIMD lane. The lanes of
+   *    the shorter linelets of a batch (and unused lanes) are padded with identity blocks decoupled from
+   *    the rest of the system. The data is gathered into (and scattered from) the interleaved storage. ---*/
+
+  constexpr auto nLane = LineletSIMD::Size;
+  const auto blkSize = nVar * nVar;
+  const auto nBatch = roundUpDiv(LineletOrder.size(), nLane);
 
   SU2_OMP_FOR_DYN(1)
-  for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
+  for (auto iBatch = 0ul; iBatch < nBatch; iBatch++) {
     /*--- Get references to the working vectors allocated for this thread. ---*/
 
     const int thread = omp_get_thread_num();
-    auto& lineletUpper = LineletUpper[thread];
-    auto& lineletInvDiag = LineletInvDiag[thread];
-    auto& lineletVector = LineletVector[thread];
-
-    /*--- Initialize the solution vector with the rhs ---*/
+    auto* upper = LineletUpper[thread].data();
+    auto* invDiag = LineletInvDiag[thread].data();
+    auto* sol = LineletVector[thread].data();
+    auto* aux_block = LineletTemp[thread].data();
+    auto* weight = aux_block + blkSize;
+    auto* lower = weight + blkSize;
+    auto* aux_vector = lower + blkSize;
+
+    /*--- Linelet and its size in each lane, the first is the longest. ---*/
+
+    const vector<unsigned long>* linelet[nLane] = {};
+    unsigned long size[nLane] = {};
+    for (auto iLane = 0ul; iLane < nLane; iLane++) {
+      const auto iLinelet = iBatch * nLane + iLane;
+      if (iLinelet >= LineletOrder.size()) break;
+      linelet[iLane] = &li.linelets[LineletOrder[iLinelet]];
+      size[iLane] = linelet[iLane]->size();
+    }
+    const auto nElem = size[0];
+
+    /*--- Gathers block (iElem+i, iElem+j) of each linelet, i,j = 0 is the diagonal, i,j = -1 is the lower
+     *    block, etc. Out of range lanes get the identity (diagonal) or zero (off-diagonal). ---*/
+    auto gatherBlock = [&](unsigned long iElem, int i, int j, LineletSIMD* block) {
+      for (auto iLane = 0ul; iLane < nLane; iLane++) {
+        const ScalarType* blk = nullptr;
+        if (iElem < size[iLane]) {
+          blk = GetBlock((*linelet[iLane])[iElem + i], (*linelet[iLane])[iElem + j]);
+        }
+        for (auto k = 0ul; k < blkSize; k++) {
+          block[k][iLane] = blk ? blk[k] : ScalarType(i == j && k % (nVar + 1) == 0);
+        }
+      }
+    };
 
-    const auto nElem = li.linelets[iLinelet].size();
+    /*--- Initialize the solution vector with the rhs. ---*/
 
     for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++) lineletVector[iElem * nVar + iVar] = vec[iPoint * nVar + iVar];
+      for (auto iLane = 0ul; iLane < nLane; iLane++) {
+        const bool valid = iElem < size[iLane];
+        const auto iPoint = valid ? (*linelet[iLane])[iElem] : 0ul;
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          sol[iElem * nVar + iVar][iLane] = valid ? vec[iPoint * nVar + iVar] : ScalarType(0);
+      }
     }
 
     /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
 
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR * MAXNVAR], aux_vector[MAXNVAR];
-
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[li.linelets[iLinelet][0]] * nVar * nVar], lineletInvDiag.data());
+    /*--- Copy diagonal block for first point in the linelets. ---*/
+    gatherBlock(0, 0, 0, invDiag);
 
     for (auto iElem = 1ul; iElem < nElem; iElem++) {
-      /*--- Setup pointers to required matrices and vectors ---*/
-      const auto im1Point = li.linelets[iLinelet][iElem - 1];
-      const auto iPoint = li.linelets[iLinelet][iElem];
-
-      const auto* d = &matrix[dia_ptr[iPoint] * nVar * nVar];
-      const auto* l = GetBlock(iPoint, im1Point);
-      const auto* u = GetBlock(im1Point, iPoint);
+      auto* inv_dm1 = &invDiag[(iElem - 1) * blkSize];
+      auto* d_prime = &invDiag[iElem * blkSize];
+      auto* u = &upper[(iElem - 1) * blkSize];
 
-      auto* inv_dm1 = &lineletInvDiag[(iElem - 1) * nVar * nVar];
-      auto* d_prime = &lineletInvDiag[iElem * nVar * nVar];
-      auto* b_prime = &lineletVector[iElem * nVar];
+      /*--- Gather the blocks, the upper block couples the previous point to the current one. ---*/
+      gatherBlock(iElem, 0, 0, d_prime);
+      gatherBlock(iElem, 0, -1, lower);
+      gatherBlock(iElem, -1, 0, u);
 
       /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
+      for (auto k = 0ul; k < blkSize; k++) aux_block[k] = inv_dm1[k];
+      BatchedInverse(nVar, aux_block, inv_dm1);
 
       /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
+      BatchedGemm(nVar, lower, inv_dm1, weight);
 
       /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
+      BatchedGemm(nVar, weight, u, aux_block);
+      for (auto k = 0ul; k < blkSize; k++) d_prime[k] -= aux_block[k];
 
       /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem - 1) * nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
-
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem - 1] = u;
+      BatchedGemv<false>(nVar, weight, &sol[(iElem - 1) * nVar], &sol[iElem * nVar]);
     }
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+    /*--- Backwards substitution, the vector becomes the solution ---*/
 
     /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem - 1) * nVar * nVar], &lineletVector[(nElem - 1) * nVar]);
+    BatchedGauss(nVar, &invDiag[(nElem - 1) * blkSize], &sol[(nElem - 1) * nVar]);
 
     /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
     for (auto iElem = nElem - 1; iElem > 0; --iElem) {
-      const auto* inv_dm1 = &lineletInvDiag[(iElem - 1) * nVar * nVar];
-      MatrixVectorProduct(lineletUpper[iElem - 1], &lineletVector[iElem * nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem - 1) * nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem - 1) * nVar]);
+      auto* b = &sol[(iElem - 1) * nVar];
+      BatchedGemv<false>(nVar, &upper[(iElem - 1) * blkSize], &sol[iElem * nVar], b);
+      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vector[iVar] = b[iVar];
+      BatchedGemv<true>(nVar, &invDiag[(iElem - 1) * blkSize], aux_vector, b);
     }
 
     /*--- Copy results to product vector ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = lineletVector[iElem * nVar + iVar];
+    for (auto iLane = 0ul; iLane < nLane; iLane++) {
+      for (auto iElem = 0ul; iElem < size[iLane]; iElem++) {
+        const auto iPoint = (*linelet[iLane])[iElem];
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = sol[iElem * nVar + iVar][iLane];
+      }
     }
   }
   END_SU2_OMP_FOR
@@ -1000,6 +1414,174 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CGeometry* geometry, const CConfig* config) {
+  InvalidateFloatValues();
+
+  /*--- Smoother of the finest level. ---*/
+  switch (config->GetKind_Linear_Solver_AMG_Smoother()) {
+    case ILU:
+      BuildILUPreconditioner();
+      break;
+    case JACOBI:
+      BuildJacobiPreconditioner();
+      break;
+    default:
+      break;
+  }
+
+  /*--- Coarse levels, the master thread sets the matrix and then builds the hierarchy. ---*/
+  SU2_OMP_MASTER
+  amg_hierarchy.SetMatrix(nVar, nPointDomain, nPoint, row_ptr, col_ind, dia_ptr, matrix);
+  END_SU2_OMP_MASTER
+
+  amg_hierarchy.Build(geometry, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec,
+                                                      CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                      const CConfig* config) const {
+  auto smooth = [&](const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x) {
+    switch (config->GetKind_Linear_Solver_AMG_Smoother()) {
+      case ILU:
+        ComputeILUPreconditioner(b, x, geometry, config);
+        break;
+      case JACOBI:
+        ComputeJacobiPreconditioner(b, x, geometry, config);
+        break;
+      default:
+        ComputeLU_SGSPreconditioner(b, x, geometry, config);
+        break;
+    }
+  };
+
+  /*--- Pre-smoothing with zero initial guess. ---*/
+  smooth(vec, prod);
+
+  if (amg_hierarchy.GetNumLevels() < 2) return;
+
+  /*--- Coarse grid correction of the residual, r = b - A x. ---*/
+  MatrixVectorProduct(prod, amg_residual, geometry, config);
+  amg_residual = vec - amg_residual;
+  SU2_OMP_BARRIER
+
+  amg_hierarchy.CoarseGridCorrection(amg_residual, amg_correction);
+  prod += amg_correction;
+  SU2_OMP_BARRIER
+
+  /*--- The correction of the halos is not computed. ---*/
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Post-smoothing, x += M^{-1} (b - A x). ---*/
+  MatrixVectorProduct(prod, amg_residual, geometry, config);
+  amg_residual = vec - amg_residual;
+  smooth(amg_residual, amg_correction);
+  prod += amg_correction;
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildChebyshevPreconditioner(CGeometry* geometry, const CConfig* config) {
+  BuildJacobiPreconditioner();
+
+  /*--- Lanczos iterations for D^{-1} A, which is self-adjoint in the inner product
+   *    <x,y>_D = x^T D y if A is symmetric. Besides the basis vectors (v) we keep
+   *    u = D v, to compute inner products only with products by A and D^{-1}. ---*/
+
+  auto* vPrev = &cheb_vec[0];
+  auto* v = &cheb_vec[1];
+  auto* uPrev = &cheb_vec[2];
+  auto* u = &cheb_vec[3];
+  auto& z = cheb_vec[4];
+
+  /*--- Arbitrary starting vector, it should not be an eigenvector. ---*/
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto i = 0ul; i < nPointDomain * nVar; ++i) (*u)[i] = 1.0 + 0.5 * sin(0.7 * i);
+  END_SU2_OMP_FOR
+
+  ComputeJacobiPreconditioner(*u, *v, geometry, config);
+  const ScalarType norm = sqrt(fabs(v->dot(*u)));
+  *v *= 1 / norm;
+  *u *= 1 / norm;
+  *vPrev = ScalarType(0.0);
+  *uPrev = ScalarType(0.0);
+
+  ScalarType T[CHEB_LANCZOS_STEPS][CHEB_LANCZOS_STEPS] = {}, beta = 0.0;
+  int nSteps = 0;
+
+  while (nSteps < CHEB_LANCZOS_STEPS) {
+    MatrixVectorProduct(*v, z, geometry, config);
+    const ScalarType alpha = v->dot(z);
+    T[nSteps][nSteps] = alpha;
+    ++nSteps;
+
+    /*--- z = D w, where w is the next (unscaled) basis vector, stored in vPrev. ---*/
+    z -= alpha * (*u) + beta * (*uPrev);
+    ComputeJacobiPreconditioner(z, *vPrev, geometry, config);
+    const ScalarType beta2 = vPrev->dot(z);
+
+    /*--- Invariant subspace, or loss of positivity (not SPD). ---*/
+    if (nSteps == CHEB_LANCZOS_STEPS || beta2 <= 1e-12 * alpha * alpha) break;
+
+    beta = sqrt(beta2);
+    T[nSteps][nSteps - 1] = T[nSteps - 1][nSteps] = beta;
+    *vPrev *= 1 / beta;
+    *uPrev = (1 / beta) * z;
+    std::swap(v, vPrev);
+    std::swap(u, uPrev);
+  }
+
+  /*--- The extreme Ritz values approximate the extreme eigenvalues, the largest from below, thus a
+   *    safety factor is applied. The smallest is approximated from above, but the Chebyshev
+   *    residual polynomial is bounded by 1 below the interval (it is just less effective there). ---*/
+
+  ScalarType eigVec[CHEB_LANCZOS_STEPS][CHEB_LANCZOS_STEPS], eigVal[CHEB_LANCZOS_STEPS], work[CHEB_LANCZOS_STEPS];
+  CBlasStructure::EigenDecomposition(T, eigVec, eigVal, nSteps, work);
+
+  SU2_OMP_MASTER {
+    cheb_upper = 1.1 * eigVal[nSteps - 1];
+    cheb_lower = max(eigVal[0], cheb_upper / CHEB_MAX_EIG_RATIO);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeChebyshevPreconditioner(const CSysVector<ScalarType>& vec,
+                                                            CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                            const CConfig* config) const {
+  /*--- Chebyshev acceleration of Jacobi iterations with zero initial guess (Y. Saad, Iterative
+   *    Methods for Sparse Linear Systems, Alg. 12.1), for eigenvalues in [cheb_lower, cheb_upper]. ---*/
+
+  const ScalarType theta = 0.5 * (cheb_upper + cheb_lower);
+  const ScalarType delta = 0.5 * (cheb_upper - cheb_lower);
+  const ScalarType sigma = theta / delta;
+  ScalarType rho = 1 / sigma;
+
+  auto& residual = cheb_vec[0];
+  auto& direction = cheb_vec[1];
+  auto& aux = cheb_vec[2];
+
+  ComputeJacobiPreconditioner(vec, aux, geometry, config);
+  direction = (1 / theta) * aux;
+  prod = direction;
+  residual = vec;
+
+  for (auto iDeg = 1ul; iDeg < cheb_degree; ++iDeg) {
+    MatrixVectorProduct(direction, aux, geometry, config);
+    residual -= aux;
+    ComputeJacobiPreconditioner(residual, aux, geometry, config);
+
+    const ScalarType rhoNew = 1 / (2 * sigma - rho);
+    direction = (rhoNew * rho) * direction + (2 * rhoNew / delta) * aux;
+    prod += direction;
+    rho = rhoNew;
+  }
+  SU2_OMP_BARRIER
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                                              CSysVector<ScalarType>& res) const {
@@ -1007,7 +1589,7 @@ void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol,
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     ScalarType aux_vec[MAXNVAR];
-    RowProduct(sol, iPoint, aux_vec);
+    RowProduct(matrix, sol, iPoint, aux_vec);
     VectorSubtraction(aux_vec, &f[iPoint * nVar], &res[iPoint * nVar]);
   }
   END_SU2_OMP_FOR
@@ -1126,6 +1708,9 @@ void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
     }
   }
   END_SU2_OMP_FOR
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
 }
 
 template <class ScalarType>
@@ -1196,6 +1781,10 @@ void CSysMatrix<ScalarType>::TransposeInPlace() {
   }
   END_SU2_OMP_FOR
 
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
+
 #ifdef HAVE_PASTIX
   SU2_OMP_MASTER
   pastix_wrapper.SetTransposedSolve();
@@ -1216,6 +1805,35 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
   SU2_OMP_FOR_STAT(omp_light_size)
   for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix[i] += alpha * B.matrix[i];
   END_SU2_OMP_FOR
+  SU2_OMP_MASTER
+  floatStale = true;
+  END_SU2_OMP_MASTER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ExportLinearSystem(CGeometry* geometry, CLinearSystemFile& file) const {
+  auto& header = file.header;
+  header.nVar = nVar;
+  header.nEqn = nEqn;
+  header.nPointDomain = nPointDomain;
+  header.nPointGlobal = geometry->GetGlobal_nPointDomain();
+  header.nNonZero = row_ptr[nPointDomain];
+
+  /*--- The halo columns are identified by the global index of the point they replicate. ---*/
+
+  file.globalRow.resize(nPointDomain);
+  file.rowPtr.assign(row_ptr, row_ptr + nPointDomain + 1);
+  file.globalCol.resize(header.nNonZero);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    file.globalRow[iPoint] = geometry->nodes->GetGlobalIndex(iPoint);
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k) {
+      file.globalCol[k] = geometry->nodes->GetGlobalIndex(col_ind[k]);
+    }
+  }
+
+  file.values.resize(header.nNonZero * nVar * nEqn);
+  for (auto i = 0ul; i < file.values.size(); ++i) file.values[i] = SU2_TYPE::GetValue(matrix[i]);
 }
 
 template <class ScalarType>
@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/linear_algebra/CLinearSystemFile.hpp"
 
 #include <limits>
 
@@ -172,6 +173,48 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg,
+                                                 vector<CSysVector<ScalarType> >& w) const {
+  const auto thread = omp_get_thread_num();
+
+  auto SetHsbg = [&](int row, int col, const ScalarType& value) {
+    if (!shared_hsbg || thread == 0) {
+      Hsbg(row, col) = value;
+    }
+  };
+
+  /*--- Projections on the previous vectors and the squared norm of the new vector, one reduction.
+   * These are private to each thread, multiDot gives all threads the same values. ---*/
+
+  vector<ScalarType> h(i + 2), h2(i + 1);
+  w[i + 1].multiDot(i + 2, w.data(), h.data());
+
+  const ScalarType nrm2 = h[i + 1];
+
+  if ((nrm2 <= 0.0) || (nrm2 != nrm2)) {
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  for (int k = 0; k < i + 1; k++) w[i + 1] -= h[k] * w[k];
+
+  /*--- Second pass to recover the orthogonality lost to round-off, another reduction. ---*/
+
+  w[i + 1].multiDot(i + 1, w.data(), h2.data());
+
+  for (int k = 0; k < i + 1; k++) {
+    w[i + 1] -= h2[k] * w[k];
+    SetHsbg(k, i, h[k] + h2[k]);
+  }
+
+  /*--- Test and scale the resulting vector ---*/
+
+  const ScalarType nrm = w[i + 1].norm();
+  SetHsbg(i + 1, i, nrm);
+
+  w[i + 1] /= nrm;
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -358,6 +401,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   /*--- If we call the solver outside of a parallel region, but the number of threads allows,
    * we still want to parallelize some of the expensive operations. ---*/
   const bool nestedParallel = !omp_in_parallel() && omp_get_max_threads() > 1;
+  const bool classicalGS = (config->GetLinear_Solver_Orthogonalization() == LINEAR_SOLVER_ORTHOGONALIZATION::CGS2);
 
   /*---  Check the subspace size ---*/
 
@@ -465,15 +509,21 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       mat_vec(W[i], W[i + 1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified or classical (fewer reductions) Gram-Schmidt orthogonalization ---*/
 
     if (nestedParallel) {
       /*--- "omp parallel if" does not work well here ---*/
       SU2_OMP_PARALLEL
-      ModGramSchmidt(true, i, H, W);
+      if (classicalGS)
+        ClassicalGramSchmidt(true, i, H, W);
+      else
+        ModGramSchmidt(true, i, H, W);
       END_SU2_OMP_PARALLEL
     } else {
-      ModGramSchmidt(false, i, H, W);
+      if (classicalGS)
+        ClassicalGramSchmidt(false, i, H, W);
+      else
+        ModGramSchmidt(false, i, H, W);
     }
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
@@ -564,6 +614,339 @@ unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarTy
   return 0;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::GCRODR_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                      const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                      const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                      unsigned long MaxIter, ScalarType& residual, bool monitoring,
+                                                      const CConfig* config, bool transposed) {
+  auto& space = transposed ? adjointRecycle : primalRecycle;
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool classicalGS = (config->GetLinear_Solver_Orthogonalization() == LINEAR_SOLVER_ORTHOGONALIZATION::CGS2);
+  const unsigned long m = config->GetLinear_Solver_Restart_Frequency();
+  const unsigned long kMax = config->GetLinear_Solver_Recycle_Size();
+
+  /*--- Check the subspace sizes ---*/
+
+  if (kMax < 1 || kMax >= m) {
+    SU2_MPI::Error("GCRO_DR requires 0 < LINEAR_SOLVER_RECYCLE_SIZE < LINEAR_SOLVER_RESTART_FREQUENCY.",
+                   CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("GCRO_DR subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. The basis is always stored preconditioned (in Z) even if the
+   * preconditioner is the identity, as the recycled vectors U are placed at the start of Z. ---*/
+
+  if (W.size() <= m || Z.size() <= m || space.U.size() != kMax ||
+      space.U.front().GetLocSize() != x.GetLocSize()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      Z.resize(m + 1);
+      for (auto* basis : {&W, &Z})
+        for (auto& w : *basis) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      space.U.resize(kMax);
+      space.C.resize(kMax);
+      for (auto* basis : {&space.U, &space.C})
+        for (auto& u : *basis) u.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      space.size = 0;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Since the last call the matrix has changed, compute the new image of U and then orthonormalize it
+   * (transforming U accordingly). Vectors that became (nearly) linearly dependent are discarded. ---*/
+
+  unsigned long k = 0;
+  for (unsigned long i = 0; i < space.size; ++i) {
+    auto& u = space.U[i];
+    auto& c = space.C[i];
+    mat_vec(u, c);
+    const ScalarType nrm0 = c.norm();
+
+    for (unsigned long j = 0; j < k; ++j) {
+      const ScalarType prod = c.dot(space.C[j]);
+      c -= prod * space.C[j];
+      u -= prod * space.U[j];
+    }
+    const ScalarType nrm = c.norm();
+    if (!(nrm > 1e-8 * nrm0)) continue;
+
+    c /= nrm;
+    u /= nrm;
+    if (k != i) {
+      space.C[k] = c;
+      space.U[k] = u;
+    }
+    ++k;
+  }
+
+  /*--- Define various arrays, see FGMRES_LinSolver. G keeps a copy of H before the Givens rotations. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  su2matrix<ScalarType> H(m + 1, m), G(m + 1, m);
+
+  ScalarType norm0 = b.norm();
+  ScalarType beta = 0.0;
+  unsigned long totalIter = 0;
+
+  for (bool firstCycle = true;; firstCycle = false) {
+    g = ScalarType(0);
+    sn = ScalarType(0);
+    cs = ScalarType(0);
+    H = ScalarType(0);
+    G = ScalarType(0);
+
+    /*--- The first k columns of the relation A * Z = W * G are the (scaled) recycled subspace. ---*/
+
+    for (unsigned long i = 0; i < k; ++i) {
+      const ScalarType nrmU = space.U[i].norm();
+      W[i] = space.C[i];
+      Z[i] = space.U[i];
+      Z[i] /= nrmU;
+      H(i, i) = G(i, i) = 1 / nrmU;
+      GenerateGivens(H(i, i), H(i + 1, i), sn[i], cs[i]);
+    }
+
+    /*--- Residual, its projection on C is the rhs of the first k rows of the reduced system,
+     * the remainder starts the Arnoldi process. ---*/
+
+    auto& r = W[k];
+    if (firstCycle && xIsZero) {
+      r = b;
+    } else {
+      mat_vec(x, r);
+      r = b - r;
+    }
+    if (k > 0) {
+      r.multiDot(k, W.data(), g.data());
+      for (unsigned long i = 0; i < k; ++i) r -= g[i] * W[i];
+    }
+    beta = r.norm();
+
+    if (firstCycle) {
+      ScalarType resNorm = beta * beta;
+      for (unsigned long i = 0; i < k; ++i) resNorm += pow(g[i], 2);
+      resNorm = sqrt(resNorm);
+
+      if (tol_type == LinearToleranceType::RELATIVE) norm0 = resNorm;
+
+      if ((resNorm < tol * norm0) || (resNorm < eps)) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          cout << "CSysSolve::GCRO_DR(): system solved by initial guess." << endl;
+          END_SU2_OMP_MASTER
+        }
+        SU2_OMP_SAFE_GLOBAL_ACCESS(space.size = k;)
+        residual = resNorm;
+        return 0;
+      }
+
+      if ((monitoring) && (masterRank)) {
+        SU2_OMP_MASTER {
+          WriteHeader("GCRO-DR", tol, resNorm);
+          WriteHistory(0, resNorm / norm0);
+        }
+        END_SU2_OMP_MASTER
+      }
+    }
+
+    /*--- The residual is orthogonal to C, therefore the least squares problem can match the first k rows
+     * exactly and its residual at the start of the cycle is beta. ---*/
+
+    if (beta > eps) r /= beta;
+    g[k] = beta;
+
+    unsigned long i = k;
+    for (; i < m; i++) {
+      if ((beta < tol * norm0) || (totalIter == MaxIter)) break;
+
+      precond(W[i], Z[i]);
+      mat_vec(Z[i], W[i + 1]);
+
+      if (classicalGS)
+        ClassicalGramSchmidt(false, i, H, W);
+      else
+        ModGramSchmidt(false, i, H, W);
+
+      for (unsigned long j = 0; j <= i + 1; j++) G(j, i) = H(j, i);
+
+      for (unsigned long j = 0; j < i; j++) ApplyGivens(sn[j], cs[j], H(j, i), H(j + 1, i));
+      GenerateGivens(H(i, i), H(i + 1, i), sn[i], cs[i]);
+      ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+      beta = fabs(g[i + 1]);
+      ++totalIter;
+
+      if ((((monitoring) && (masterRank)) && (totalIter % monitorFreq == 0))) {
+        SU2_OMP_MASTER
+        WriteHistory(totalIter, beta / norm0);
+        END_SU2_OMP_MASTER
+      }
+    }
+
+    /*--- Solve the least-squares system and update the solution, this includes the projection on U. ---*/
+
+    SolveReduced(i, H, g, y);
+
+    for (unsigned long j = 0; j < i; j++) x += y[j] * Z[j];
+
+    /*--- Keep the slowest modes of this cycle for the next, or for the next call. ---*/
+
+    if (i > k) k = UpdateRecycleSpace(i, kMax, G, H, sn, cs, space);
+
+    if ((beta < tol * norm0) || (totalIter == MaxIter)) break;
+  }
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(space.size = k;)
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("GCRO-DR", totalIter, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return totalIter;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::UpdateRecycleSpace(unsigned long n, unsigned long kMax,
+                                                        const su2matrix<ScalarType>& G,
+                                                        const su2matrix<ScalarType>& R,
+                                                        const su2vector<ScalarType>& sn,
+                                                        const su2vector<ScalarType>& cs, CRecycleSpace& space) const {
+  /*--- The small dense computations are repeated by all threads, as in FGMRES_LinSolver. ---*/
+
+  /*--- Orthonormalize the columns of A (rows x cols) by modified Gram-Schmidt, applying the same operations to
+   * the columns of B, columns that are (nearly) linearly dependent are dropped. Returns the new number of cols. ---*/
+  auto orthonormalize = [](unsigned long rows, unsigned long cols, su2matrix<ScalarType>& A,
+                           su2matrix<ScalarType>& B) {
+    unsigned long kept = 0;
+    for (unsigned long j = 0; j < cols; ++j) {
+      ScalarType nrm0 = 0;
+      for (unsigned long r = 0; r < rows; ++r) nrm0 += pow(A(r, j), 2);
+
+      for (unsigned long l = 0; l < kept; ++l) {
+        ScalarType prod = 0;
+        for (unsigned long r = 0; r < rows; ++r) prod += A(r, l) * A(r, j);
+        for (unsigned long r = 0; r < rows; ++r) A(r, j) -= prod * A(r, l);
+        for (unsigned long r = 0; r < B.rows(); ++r) B(r, j) -= prod * B(r, l);
+      }
+      ScalarType nrm = 0;
+      for (unsigned long r = 0; r < rows; ++r) nrm += pow(A(r, j), 2);
+      if (!(nrm > 1e-16 * nrm0)) continue;
+
+      nrm = 1 / sqrt(nrm);
+      for (unsigned long r = 0; r < rows; ++r) A(r, kept) = A(r, j) * nrm;
+      for (unsigned long r = 0; r < B.rows(); ++r) B(r, kept) = B(r, j) * nrm;
+      ++kept;
+    }
+    return kept;
+  };
+
+  /*--- P = W^T * Z, one reduction per column. ---*/
+
+  su2matrix<ScalarType> P(n + 1, n);
+  vector<ScalarType> col(n + 1);
+
+  for (unsigned long j = 0; j < n; ++j) {
+    Z[j].multiDot(n + 1, W.data(), col.data());
+    for (unsigned long i = 0; i <= n; ++i) P(i, j) = col[i];
+  }
+
+  /*--- M = pinv(G) * P = inv(R) * (Q^T * P)[0:n], with the rotations that reduced G to R. ---*/
+
+  su2matrix<ScalarType> M(n, n);
+
+  for (unsigned long j = 0; j < n; ++j) {
+    for (unsigned long i = 0; i < n; ++i) ApplyGivens(sn[i], cs[i], P(i, j), P(i + 1, j));
+    for (unsigned long i = n; i > 0;) {
+      --i;
+      M(i, j) = P(i, j);
+      for (unsigned long l = i + 1; l < n; ++l) M(i, j) -= R(i, l) * M(l, j);
+      M(i, j) /= R(i, i);
+    }
+  }
+
+  /*--- Dominant invariant subspace of M by simultaneous (subspace) iteration, this gives a real basis
+   * of the (possibly complex) harmonic Ritz vectors, Y is n x k. ---*/
+
+  unsigned long k = min(kMax, n);
+  su2matrix<ScalarType> Y(n, k), MY(n, k), dummy(0, k);
+
+  for (unsigned long i = 0; i < n; ++i)
+    for (unsigned long j = 0; j < k; ++j) Y(i, j) = (i == j) + 0.1 * sin(1.0 + i + 3.0 * j);
+  k = orthonormalize(n, k, Y, dummy);
+
+  for (int iter = 0; iter < 200; ++iter) {
+    for (unsigned long i = 0; i < n; ++i) {
+      for (unsigned long j = 0; j < k; ++j) {
+        MY(i, j) = 0;
+        for (unsigned long l = 0; l < n; ++l) MY(i, j) += M(i, l) * Y(l, j);
+      }
+    }
+    k = orthonormalize(n, k, MY, dummy);
+
+    /*--- Distance between consecutive subspaces, |MY - Y * Y^T * MY|. ---*/
+    ScalarType dist = 0;
+    for (unsigned long j = 0; j < k; ++j) {
+      vector<ScalarType> proj(k, 0.0);
+      for (unsigned long l = 0; l < k; ++l)
+        for (unsigned long i = 0; i < n; ++i) proj[l] += Y(i, l) * MY(i, j);
+      for (unsigned long i = 0; i < n; ++i) {
+        ScalarType d = MY(i, j);
+        for (unsigned long l = 0; l < k; ++l) d -= Y(i, l) * proj[l];
+        dist += d * d;
+      }
+    }
+    for (unsigned long i = 0; i < n; ++i)
+      for (unsigned long j = 0; j < k; ++j) Y(i, j) = MY(i, j);
+
+    if (dist < 1e-12) break;
+  }
+
+  /*--- New C = W * orth(G * Y) and U = Z * Y * inv(R2), where G * Y = Q2 * R2, so that A * U = C. ---*/
+
+  su2matrix<ScalarType> GY(n + 1, k);
+  for (unsigned long i = 0; i <= n; ++i) {
+    for (unsigned long j = 0; j < k; ++j) {
+      GY(i, j) = 0;
+      for (unsigned long l = (i > 0 ? i - 1 : 0); l < n; ++l) GY(i, j) += G(i, l) * Y(l, j);
+    }
+  }
+  k = orthonormalize(n + 1, k, GY, Y);
+
+  for (unsigned long j = 0; j < k; ++j) {
+    space.C[j] = GY(0, j) * W[0];
+    for (unsigned long i = 1; i <= n; ++i) space.C[j] += GY(i, j) * W[i];
+
+    space.U[j] = Y(0, j) * Z[0];
+    for (unsigned long i = 1; i < n; ++i) space.U[j] += Y(i, j) * Z[i];
+  }
+  return k;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -862,6 +1245,48 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   return i;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::WriteLinearSystem(const CSysMatrix<ScalarType>& Jacobian,
+                                              const CSysVector<su2double>& LinSysRes, CGeometry* geometry,
+                                              const CConfig* config, unsigned short kindSolver,
+                                              unsigned short kindPrec, unsigned long maxIter, ScalarType tol) {
+  /*--- All threads must have seen the flag before the master thread sets it. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    CLinearSystemFile file;
+    Jacobian.ExportLinearSystem(geometry, file);
+
+    auto& header = file.header;
+    header.rank = SU2_MPI::GetRank();
+    header.size = SU2_MPI::GetSize();
+    header.kindSolver = kindSolver;
+    header.kindPrec = kindPrec;
+    header.iluFill = config->GetLinear_Solver_ILU_n();
+    header.chebyshevDegree = config->GetLinear_Solver_Chebyshev_Degree();
+    header.schwarzOverlap = config->GetLinear_Solver_Schwarz_Overlap();
+    header.maxIter = maxIter;
+    header.restart = config->GetLinear_Solver_Restart_Frequency();
+    header.tolerance = SU2_TYPE::GetValue(tol);
+
+    file.rhs.resize(header.nPointDomain * header.nVar);
+    for (auto i = 0ul; i < file.rhs.size(); ++i) file.rhs[i] = SU2_TYPE::GetValue(LinSysRes[i]);
+
+    /*--- Systems of different solvers and zones may have the same block size. ---*/
+    auto prefix = config->GetLinear_System_Dump_Filename();
+    if (!systemName.empty()) prefix += "_" + systemName;
+    prefix += "_zone" + to_string(config->GetiZone()) + "_nvar" + to_string(header.nVar);
+    file.Write(CLinearSystemFile::FileName(prefix, header.rank));
+
+    if (header.rank == MASTER_NODE) {
+      cout << "Wrote the linear system with " << header.nVar << " variables per point to " << prefix << "_*.dat."
+           << endl;
+    }
+    systemWritten = true;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                            CSysVector<su2double>& LinSysSol, CGeometry* geometry,
@@ -915,6 +1340,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     }
   }
 
+  /*--- Write the system for offline replay, once, at the requested iteration. ---*/
+  if (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD && !systemWritten &&
+      config->GetLinear_System_Dump_Iter() == static_cast<long>(config->GetInnerIter())) {
+    WriteLinearSystem(Jacobian, LinSysRes, geometry, config, KindSolver, KindPrecond, MaxIter, SolverTol);
+  }
+
   /*--- Stop the recording for the linear solver ---*/
   bool TapeActive = NO;
 
@@ -973,6 +1404,10 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case GCRO_DR:
+        IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
@@ -1020,14 +1455,24 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
       switch (KindPrecond) {
         case ILU:
-          if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
+          if (RequiresTranspose) {
+            Jacobian.BuildSchwarzOverlap(geometry, config);
+            Jacobian.BuildILUPreconditioner();
+          }
           break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
           break;
         case LU_SGS:
-          /*--- Nothing to build. ---*/
+          /*--- Nothing to build, except the overlap of the transposed matrix. ---*/
+          if (RequiresTranspose) Jacobian.BuildSchwarzOverlap(geometry, config);
+          break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(geometry, config);
+          break;
+        case CHEBYSHEV:
+          if (RequiresTranspose) Jacobian.BuildChebyshevPreconditioner(geometry, config);
           break;
         case PASTIX_ILU:
         case PASTIX_LU_P:
@@ -1128,6 +1573,10 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case GCRO_DR:
+      IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                    ScreenOutput, config, true);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
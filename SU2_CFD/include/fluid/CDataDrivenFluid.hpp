@@ -30,6 +30,7 @@
 
 #include <vector>
 #include "../../../Common/include/containers/CLookUpTable.hpp"
+#include "../../../Common/include/containers/CBatchedMLP.hpp"
 #if defined(HAVE_MLPCPP)
 #define MLP_CUSTOM_TYPE su2double
 #include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
@@ -105,6 +106,11 @@ class CDataDrivenFluid final : public CFluidModel {
   MLPToolbox::CIOMap* iomap_rhoe;      /*!< \brief Input-output map. */
 #endif
   vector<su2double> MLP_inputs; /*!< \brief Inputs for the multi-layer perceptron look-up operation. */
+  CBatchedMLP* batched_mlp = nullptr; /*!< \brief Batched evaluation of the MLPs (if they are supported). */
+  unsigned short batched_map;         /*!< \brief Input-output map of the batched MLPs. */
+  su2activematrix batch_inputs;       /*!< \brief Inputs of batched MLP evaluations, one row per input. */
+  su2activematrix batch_d_outputs,    /*!< \brief Entropy derivatives of batched MLP evaluations. */
+      batch_d2_outputs;               /*!< \brief Entropy second derivatives of batched MLP evaluations. */
 
   CLookUpTable* lookup_table; /*!< \brief Look-up table regression object. */
   unsigned long LUT_idx_s,
@@ -114,6 +120,7 @@ class CDataDrivenFluid final : public CFluidModel {
                 LUT_idx_d2sdedrho,
                 LUT_idx_d2sdrho2;
   vector<unsigned long> LUT_lookup_indices;
+  su2activematrix batch_outputs; /*!< \brief Outputs of batched data set queries, one row per output. */
   
   unsigned long outside_dataset, /*!< \brief Density-energy combination lies outside data set. */
       nIter_Newton;              /*!< \brief Number of Newton solver iterations. */
@@ -185,6 +192,16 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using density and internal energy.
+   * \note The data set is queried for all the points of the batch (one search per point for the look-up table,
+   *       one matrix-matrix product per layer for the MLPs) before the thermodynamic properties are derived from
+   *       the entropy and its derivatives with a vectorizable loop.
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in,out] state - Batch of thermodynamic states.
+   */
+  void SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature.
    * \param[in] P - first thermodynamic variable (pressure).
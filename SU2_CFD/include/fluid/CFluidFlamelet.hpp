@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../Common/include/containers/CLookUpTable.hpp"
+#include "../../Common/include/containers/CBatchedMLP.hpp"
 #if defined(HAVE_MLPCPP)
 #define MLP_CUSTOM_TYPE su2double
 #include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
@@ -80,6 +81,8 @@ class CFluidFlamelet final : public CFluidModel {
   MLPToolbox::CIOMap* iomap_LookUp;    /*!< \brief Input-output map for passive look-up terms. */
   MLPToolbox::CIOMap* iomap_Current;
 #endif
+  CBatchedMLP* batched_mlp = nullptr; /*!< \brief Batched evaluation of the MLPs (if they are supported). */
+  unsigned short batched_maps[4] = {}; /*!< \brief Input-output maps of the batched MLPs (FLAMELET_LOOKUP_OPS). */
 
   vector<su2double> scalars_vector;
 
@@ -128,6 +131,21 @@ class CFluidFlamelet final : public CFluidModel {
   unsigned long EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
                                        vector<su2double>& output_refs);
 
+  /*!
+   * \brief Evaluate data-set for flamelet simulations, for a batch of points.
+   * \note The MLPs evaluate each layer for all the points with one matrix product, the look-up table is
+   *       queried point by point.
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in] input_scalars - Controlling variables used to interpolate manifold, one row per scalar.
+   * \param[in] lookup_type - Look-up operation to be performed (FLAMELET_LOOKUP_OPS).
+   * \param[out] output_refs - Interpolated results, one row per output variable.
+   * \param[out] extrapolation - Per point, query data is within manifold bounds (0) or out of bounds (1).
+   * \returns Number of queries out of bounds.
+   */
+  unsigned long EvaluateDataSetBatch(unsigned short nPoint, const su2activematrix& input_scalars,
+                                     unsigned short lookup_type, su2activematrix& output_refs,
+                                     unsigned long* extrapolation) override;
+
   /*!
    * \brief Check for out-of-bounds condition for data set interpolation.
    * \return - within bounds (0) or out of bounds (1).
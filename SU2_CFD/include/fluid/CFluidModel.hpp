@@ -91,6 +91,30 @@ class CFluidModel {
   static unique_ptr<CDiffusivityModel> MakeMassDiffusivityModel(const CConfig* config, unsigned short iSpecies);
 
  public:
+  /*!
+   * \brief Maximum number of points in a batch of thermodynamic states.
+   */
+  static constexpr unsigned short BatchSize = 32;
+
+  /*!
+   * \brief Thermodynamic states of a batch of points, used by the "SetTDStateBatch" methods.
+   * \note Depending on the method some arrays are inputs and the others outputs. The batched methods
+   *       do not necessarily update the state returned by the scalar "Get" methods.
+   */
+  struct TDStateBatch {
+    su2double Density[BatchSize];      /*!< \brief Density. */
+    su2double StaticEnergy[BatchSize]; /*!< \brief Internal energy. */
+    su2double Pressure[BatchSize];     /*!< \brief Pressure. */
+    su2double Temperature[BatchSize];  /*!< \brief Temperature. */
+    su2double SoundSpeed2[BatchSize];  /*!< \brief Speed of sound squared. */
+    su2double dPdrho_e[BatchSize];     /*!< \brief DpDd_e. */
+    su2double dPde_rho[BatchSize];     /*!< \brief DpDe_d. */
+    su2double Cp[BatchSize];           /*!< \brief Specific heat at constant pressure. */
+    su2double Cv[BatchSize];           /*!< \brief Specific heat at constant volume. */
+    su2double Entropy[BatchSize];      /*!< \brief Entropy (only set by some models). */
+    unsigned long Extrapolation[BatchSize]; /*!< \brief See GetExtrapolation (only set by some models). */
+  };
+
   virtual ~CFluidModel() {}
 
   /*!
@@ -155,6 +179,19 @@ class CFluidModel {
     return 0;
   }
 
+  /*!
+   * \brief Evaluate data-set for a batch of points (by default point by point with EvaluateDataSet).
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in] input_scalars - Data manifold query data, one row per scalar (at least nPoint columns).
+   * \param[in] lookup_type - Look-up operation to be performed.
+   * \param[out] output_refs - Interpolated results, one row per output variable (at least nPoint columns).
+   * \param[out] extrapolation - Per point, query data is within manifold bounds (0) or out of bounds (1).
+   * \returns Number of queries out of bounds.
+   */
+  virtual unsigned long EvaluateDataSetBatch(unsigned short nPoint, const su2activematrix& input_scalars,
+                                             unsigned short lookup_type, su2activematrix& output_refs,
+                                             unsigned long* extrapolation);
+
   /*!
    * \brief Get fluid dynamic viscosity.
    */
@@ -339,6 +376,31 @@ class CFluidModel {
    */
   virtual void SetTDState_T(su2double val_Temperature, const su2double* val_scalars = nullptr) {}
 
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using density and internal energy.
+   * \note The default implementation calls SetTDState_rhoe for each point, models with closed-form
+   *       equations of state override this with a loop that can be vectorized.
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in,out] state - Inputs Density and StaticEnergy, outputs Pressure, Temperature, SoundSpeed2,
+   *                 dPdrho_e, dPde_rho, Cp, and Cv, plus Entropy and Extrapolation for data-driven models.
+   */
+  virtual void SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state);
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using pressure and temperature.
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in,out] state - Inputs Pressure and Temperature, outputs Density, StaticEnergy, SoundSpeed2,
+   *                 dPdrho_e, dPde_rho, Cp, and Cv.
+   */
+  virtual void SetTDStateBatch_PT(unsigned short nPoint, TDStateBatch& state);
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using temperature (incompressible models).
+   * \param[in] nPoint - Number of points in the batch (at most BatchSize).
+   * \param[in,out] state - Input Temperature, outputs Density, Cp, and Cv.
+   */
+  virtual void SetTDStateBatch_T(unsigned short nPoint, TDStateBatch& state);
+
   /*!
    * \brief Set fluid eddy viscosity provided by a turbulence model needed for computing effective thermal conductivity.
    */
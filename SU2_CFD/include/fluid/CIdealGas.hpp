@@ -106,4 +106,15 @@ class CIdealGas : public CFluidModel {
    *
    */
   void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using density and internal energy.
+   * \note Entropy is not computed.
+   */
+  void SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) override;
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using pressure and temperature.
+   */
+  void SetTDStateBatch_PT(unsigned short nPoint, TDStateBatch& state) override;
 };
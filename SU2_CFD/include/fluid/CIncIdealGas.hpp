@@ -60,6 +60,20 @@ class CIncIdealGas final : public CFluidModel {
     Density = Pressure / (Temperature * Gas_Constant);
   }
 
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using temperature.
+   */
+  void SetTDStateBatch_T(unsigned short nPoint, TDStateBatch& state) override {
+    const su2double P = Pressure, R = Gas_Constant, cp = Cp, cv = Cv;
+
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (unsigned short i = 0; i < nPoint; ++i) {
+      state.Density[i] = P / (state.Temperature[i] * R);
+      state.Cp[i] = cp;
+      state.Cv[i] = cv;
+    }
+  }
+
  private:
   su2double Gas_Constant{0.0}; /*!< \brief Gas Constant. */
   su2double Gamma{0.0};        /*!< \brief Heat Capacity Ratio. */
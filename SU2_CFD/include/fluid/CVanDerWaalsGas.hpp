@@ -105,4 +105,19 @@ class CVanDerWaalsGas final : public CIdealGas {
    *
    */
   void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using density and internal energy.
+   * \note Entropy is not computed.
+   */
+  void SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) override;
+
+  /*!
+   * \brief Set the thermodynamic state of a batch of points using pressure and temperature.
+   * \note The Newton iterations use the compressibility factor of the previous point as initial guess,
+   *       therefore the points are processed sequentially.
+   */
+  void SetTDStateBatch_PT(unsigned short nPoint, TDStateBatch& state) override {
+    CFluidModel::SetTDStateBatch_PT(nPoint, state);
+  }
 };
@@ -27,6 +27,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include <vector>
 #include <algorithm>
 
@@ -37,91 +39,71 @@
 namespace detail {
 
 /*!
- * \brief Compute the gradient of a field using the Green-Gauss theorem.
+ * \brief Green-Gauss gradient of one (non-halo) point, without the contributions of boundary faces.
  * \ingroup FvmAlgos
- * \note Template nDim to allow efficient unrolling of inner loops.
- * \note Gradients can be computed only for a contiguous range of variables, defined
- *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
- *       This can be used, for example, to compute only velocity gradients.
- * \note The function uses an optional solver object to perform communications, if
- *       none (nullptr) is provided the function does not fail (the objective of
- *       this is to improve test-ability).
- * \param[in] solver - Optional, solver associated with the field (used only for MPI).
- * \param[in] kindMpiComm - Type of MPI communication required.
- * \param[in] kindPeriodicComm - Type of periodic communication required.
- * \param[in] geometry - Geometric grid properties.
- * \param[in] config - Configuration of the problem, used to identify types of boundaries.
- * \param[in] field - Generic object implementing operator (iPoint, iVar).
- * \param[in] varBegin - Index of first variable for which to compute the gradient.
- * \param[in] varEnd - Index of last variable for which to compute the gradient.
- * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
- * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \note See "computeGradientsGreenGauss()" for a description of the arguments.
  */
 template <size_t nDim, class FieldType, class GradientType>
-void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
-                                CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
-  const size_t nPointDomain = geometry.GetnPointDomain();
+FORCEINLINE void computeGradientGreenGaussPoint(size_t iPoint, const CGeometry& geometry, const FieldType& field,
+                                                const size_t varBegin, const size_t varEnd, GradientType& gradient) {
+  auto nodes = geometry.nodes;
 
-#ifdef HAVE_OMP
-  constexpr size_t OMP_MAX_CHUNK = 512;
-
-  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
-#endif
-
-  static constexpr size_t MAXNVAR = 20;
-
-  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
-
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
-    auto nodes = geometry.nodes;
-
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(nodes->GetVolume(iPoint));
-    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+  /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+  if (omp_get_num_threads() == 1) AD::StartPreacc();
+  AD::SetPreaccIn(nodes->GetVolume(iPoint));
+  AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) AD::SetPreaccIn(field(iPoint, iVar));
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar) AD::SetPreaccIn(field(iPoint, iVar));
 
-    /*--- Clear the gradient. --*/
+  /*--- Clear the gradient. --*/
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) = 0.0;
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) = 0.0;
 
-    /*--- Handle averaging and division by volume in one constant. ---*/
+  /*--- Handle averaging and division by volume in one constant. ---*/
 
-    su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
+  su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
 
-    /*--- Add a contribution due to each neighbor. ---*/
+  /*--- Add a contribution due to each neighbor. ---*/
 
-    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh) {
-      size_t iEdge = nodes->GetEdge(iPoint, iNeigh);
-      size_t jPoint = nodes->GetPoint(iPoint, iNeigh);
+  for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh) {
+    size_t iEdge = nodes->GetEdge(iPoint, iNeigh);
+    size_t jPoint = nodes->GetPoint(iPoint, iNeigh);
 
-      /*--- Determine if edge points inwards or outwards of iPoint.
-       *    If inwards we need to flip the area vector. ---*/
+    /*--- Determine if edge points inwards or outwards of iPoint.
+     *    If inwards we need to flip the area vector. ---*/
 
-      su2double dir = (iPoint < jPoint) ? 1.0 : -1.0;
-      su2double weight = dir * halfOnVol;
+    su2double dir = (iPoint < jPoint) ? 1.0 : -1.0;
+    su2double weight = dir * halfOnVol;
 
-      const auto area = geometry.edges->GetNormal(iEdge);
-      AD::SetPreaccIn(area, nDim);
+    const auto area = geometry.edges->GetNormal(iEdge);
+    AD::SetPreaccIn(area, nDim);
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
-        AD::SetPreaccIn(field(jPoint, iVar));
-        su2double flux = weight * (field(iPoint, iVar) + field(jPoint, iVar));
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      AD::SetPreaccIn(field(jPoint, iVar));
+      su2double flux = weight * (field(iPoint, iVar) + field(jPoint, iVar));
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) += flux * area[iDim];
-      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) += flux * area[iDim];
     }
+  }
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim) AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim) AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
 
-    AD::EndPreacc();
-  }
-  END_SU2_OMP_FOR
+  AD::EndPreacc();
+}
+
+/*!
+ * \brief Add the contributions of boundary faces to the Green-Gauss gradients,
+ *        and apply the corrections for symmetry planes and Euler walls.
+ * \ingroup FvmAlgos
+ * \note See "computeGradientsGreenGauss()" for a description of the arguments.
+ */
+template <size_t nDim, class FieldType, class GradientType>
+void computeGradientsGreenGaussBoundary(CGeometry& geometry, const CConfig& config, const FieldType& field,
+                                        const size_t varBegin, const size_t varEnd, const int idxVel,
+                                        GradientType& gradient) {
+  static constexpr size_t MAXNVAR = 20;
 
   su2double flux[MAXNVAR] = {0.0};
 
@@ -162,22 +144,84 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
   /*--- Compute the corrections for symmetry planes and Euler walls. ---*/
 
   correctGradientsSymmetry<nDim>(geometry, config, varBegin, varEnd, idxVel, gradient);
+}
 
-  /*--- If no solver was provided we do not communicate ---*/
+/*!
+ * \brief Compute the gradient of a field using the Green-Gauss theorem.
+ * \ingroup FvmAlgos
+ * \note Template nDim to allow efficient unrolling of inner loops.
+ * \note Gradients can be computed only for a contiguous range of variables, defined
+ *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
+ *       This can be used, for example, to compute only velocity gradients.
+ * \note The function uses an optional solver object to perform communications, if
+ *       none (nullptr) is provided the function does not fail (the objective of
+ *       this is to improve test-ability).
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] kindPeriodicComm - Type of periodic communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ */
+template <size_t nDim, class FieldType, class GradientType>
+void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
+                                CGeometry& geometry, const CConfig& config, const FieldType& field,
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
 
-  if (solver == nullptr) return;
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- With overlap of computation and comms, only the points that are sent or that have
+   *    boundary contributions are computed before the comms start (see CGeometry). ---*/
+
+  const bool overlap = geometry.GetCommOverlap();
+  const auto& pointsBeforeComms = geometry.GetPointsBeforeComms();
+  const size_t nPointBeforeComms = overlap ? pointsBeforeComms.size() : nPointDomain;
+
+  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t k = 0; k < nPointBeforeComms; ++k) {
+    const size_t iPoint = overlap ? pointsBeforeComms[k] : k;
+    computeGradientGreenGaussPoint<nDim>(iPoint, geometry, field, varBegin, varEnd, gradient);
+  }
+  END_SU2_OMP_FOR
+
+  computeGradientsGreenGaussBoundary<nDim>(geometry, config, field, varBegin, varEnd, idxVel, gradient);
 
   /*--- Account for periodic contributions. ---*/
 
-  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic() / 2; ++iPeriodic) {
-    solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+  if (solver != nullptr) {
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic() / 2; ++iPeriodic) {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
   }
 
-  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them,
+   *    if no solver was provided we do not communicate. ---*/
+
+  if (solver != nullptr) solver->InitiateComms(&geometry, &config, kindMpiComm);
+
+  if (overlap) {
+    const auto& pointsDuringComms = geometry.GetPointsDuringComms();
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t k = 0; k < pointsDuringComms.size(); ++k) {
+      computeGradientGreenGaussPoint<nDim>(pointsDuringComms[k], geometry, field, varBegin, varEnd, gradient);
+    }
+    END_SU2_OMP_FOR
+  }
 
-  solver->InitiateComms(&geometry, &config, kindMpiComm);
-  solver->CompleteComms(&geometry, &config, kindMpiComm);
+  if (solver != nullptr) solver->CompleteComms(&geometry, &config, kindMpiComm);
 }
 }  // namespace detail
 
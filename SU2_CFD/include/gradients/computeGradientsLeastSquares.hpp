@@ -32,40 +32,6 @@
 
 namespace detail {
 
-/*!
- * \brief Prepare Smatrix for 2D.
- * \ingroup FvmAlgos
- */
-FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
-                                su2double r22, su2double r23, su2double r33,
-                                su2double detR2, su2double Smatrix[][2]) {
-  Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-  Smatrix[0][1] = -r11*r12/detR2;
-  Smatrix[1][1] = r11*r11/detR2;
-}
-
-/*!
- * \brief Prepare Smatrix for 3D.
- * \ingroup FvmAlgos
- */
-FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
-                                su2double r22, su2double r23, su2double r33,
-                                su2double detR2, su2double Smatrix[][3]) {
-  su2double z11 = r22*r33;
-  su2double z12 =-r12*r33;
-  su2double z13 = r12*r23-r13*r22;
-  su2double z22 = r11*r33;
-  su2double z23 =-r11*r23;
-  su2double z33 = r11*r22;
-
-  Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-  Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-  Smatrix[0][2] = (z13*z33)/detR2;
-  Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-  Smatrix[1][2] = (z23*z33)/detR2;
-  Smatrix[2][2] = (z33*z33)/detR2;
-}
-
 /*!
  * \brief Solve the least-squares problem for one point.
  * \ingroup FvmAlgos
@@ -88,48 +54,27 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
     AD::SetPreaccIn(Rmatrix(iPoint,0,0));
     AD::SetPreaccIn(Rmatrix(iPoint,0,1));
     AD::SetPreaccIn(Rmatrix(iPoint,1,1));
-  }
-
-  su2double r11 = Rmatrix(iPoint,0,0);
-  su2double r12 = Rmatrix(iPoint,0,1);
-  su2double r22 = Rmatrix(iPoint,1,1);
-  su2double r13 = 0.0, r23 = 0.0, r33 = 1.0;
-
-  r11 = sqrt(max(r11, eps));
-  r12 /= r11;
-  r22 = sqrt(max(r22 - r12*r12, eps));
-
-  if (nDim == 3) {
-    if (periodic) {
+    if (nDim == 3) {
       AD::SetPreaccIn(Rmatrix(iPoint,0,2));
       AD::SetPreaccIn(Rmatrix(iPoint,1,2));
       AD::SetPreaccIn(Rmatrix(iPoint,2,1));
       AD::SetPreaccIn(Rmatrix(iPoint,2,2));
     }
+  }
 
+  su2double r13 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 1.0;
+  if (nDim == 3) {
     r13 = Rmatrix(iPoint,0,2);
+    r23_a = Rmatrix(iPoint,1,2);
+    r23_b = Rmatrix(iPoint,2,1);
     r33 = Rmatrix(iPoint,2,2);
-    const auto r23_a = Rmatrix(iPoint,1,2);
-    const auto r23_b = Rmatrix(iPoint,2,1);
-
-    r13 /= r11;
-    r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-    r33 = sqrt(max(r33 - r23*r23 - r13*r13, eps));
   }
 
-  /*--- Compute determinant ---*/
-
-  const su2double detR2 = pow(r11*r22*r33, 2);
-
   /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
-  su2double Smatrix[nDim][nDim] = {{0.0}};
-
-  /*--- Detect singular matrix ---*/
-
-  if (detR2 > eps) {
-    computeSmatrix(r11, r12, r13, r22, r23, r33, detR2, Smatrix);
-  }
+  su2double Smatrix[nDim][nDim];
+  GeometryToolbox::LeastSquaresSmatrix<nDim>(Rmatrix(iPoint,0,0), Rmatrix(iPoint,0,1), Rmatrix(iPoint,1,1),
+                                             r13, r23_a, r23_b, r33, eps, Smatrix);
 
   if (periodic) {
     /*--- Stop preacc here as gradient is in/out. ---*/
@@ -162,6 +107,158 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   }
 }
 
+/*!
+ * \brief Compute the least-squares gradient of one point as a weighted sum of differences
+ *        to the neighbors, using the weights stored by the geometry (see CGeometry::SetLeastSquaresWeights).
+ * \ingroup FvmAlgos
+ */
+template<size_t nDim, class FieldType, class GradientType>
+FORCEINLINE void computeGradientStoredWeightsPoint(size_t iPoint,
+                                                   const CGeometry& geometry,
+                                                   const su2activematrix& weights,
+                                                   const FieldType& field,
+                                                   const size_t varBegin,
+                                                   const size_t varEnd,
+                                                   GradientType& gradient)
+{
+  /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+  if (omp_get_num_threads() == 1) AD::StartPreacc();
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    AD::SetPreaccIn(field(iPoint,iVar));
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      gradient(iPoint, iVar, iDim) = 0.0;
+
+  /*--- The weights of iPoint are stored in the same order as its neighbors. ---*/
+
+  auto iNeigh = geometry.nodes->GetPoints().outerPtr()[iPoint];
+
+  for (auto jPoint : geometry.nodes->GetPoints(iPoint))
+  {
+    const su2double* weight_ij = weights[iNeigh++];
+    AD::SetPreaccIn(weight_ij, nDim);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(jPoint,iVar));
+
+      const su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) += weight_ij[iDim] * delta_ij;
+    }
+  }
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+  AD::EndPreacc();
+}
+
+/*!
+ * \brief Assemble and, if there is no periodicity, solve the least-squares problem of one point.
+ * \ingroup FvmAlgos
+ * \note See detail::computeGradientsLeastSquares for a description of the arguments.
+ */
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+FORCEINLINE void computeGradientLeastSquaresPoint(size_t iPoint,
+                                                  bool periodic,
+                                                  const CGeometry& geometry,
+                                                  bool weighted,
+                                                  const FieldType& field,
+                                                  const size_t varBegin,
+                                                  const size_t varEnd,
+                                                  GradientType& gradient,
+                                                  RMatrixType& Rmatrix)
+{
+  auto nodes = geometry.nodes;
+  const auto coord_i = nodes->GetCoord(iPoint);
+
+  /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+  if (omp_get_num_threads() == 1) AD::StartPreacc();
+  AD::SetPreaccIn(coord_i, nDim);
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    AD::SetPreaccIn(field(iPoint,iVar));
+
+  /*--- Clear gradient and Rmatrix. ---*/
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      gradient(iPoint, iVar, iDim) = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      Rmatrix(iPoint, iDim, jDim) = 0.0;
+
+
+  for (auto jPoint : nodes->GetPoints(iPoint))
+  {
+    const auto coord_j = geometry.nodes->GetCoord(jPoint);
+    AD::SetPreaccIn(coord_j, nDim);
+
+
+    /*--- Distance vector from iPoint to jPoint ---*/
+
+    su2double dist_ij[nDim] = {0.0};
+    GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+
+    /*--- Compute inverse weight, default 1 (unweighted). ---*/
+
+    su2double weight = 1.0;
+    if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+    /*--- Summations for entries of upper triangular matrix R. ---*/
+
+    if (weight > 0.0)
+    {
+      weight = 1.0 / weight;
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+      if (nDim == 3)
+        Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+      /*--- Entries of c:= transpose(A)*b ---*/
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        AD::SetPreaccIn(field(jPoint,iVar));
+
+        su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+      }
+    }
+  }
+
+  if (periodic)
+  {
+    /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+
+    AD::EndPreacc();
+  }
+  else {
+    /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
+
+    solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+  }
+}
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -205,96 +302,34 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
-  /*--- First loop over non-halo points of the grid. ---*/
+  /*--- Use the weights stored by the geometry if available, they cannot be used with periodic
+   *    boundaries since the least-squares problem of periodic points needs contributions from
+   *    both sides of the boundary. ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
+  const auto& weights = geometry.nodes->GetLeastSquaresWeights(weighted);
+  const bool storedWeights = !periodic && !weights.empty();
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
+  auto computePoint = [&](size_t iPoint) {
+    if (storedWeights)
+      computeGradientStoredWeightsPoint<nDim>(iPoint, geometry, weights, field, varBegin, varEnd, gradient);
+    else
+      computeGradientLeastSquaresPoint<nDim>(iPoint, periodic, geometry, weighted, field,
+                                             varBegin, varEnd, gradient, Rmatrix);
+  };
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
+  /*--- With overlap of computation and comms (never with periodicity), only the points
+   *    that are sent or that are corrected for symmetry are needed before the comms
+   *    start (see CGeometry). ---*/
 
-    /*--- Clear gradient and Rmatrix. ---*/
-
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        gradient(iPoint, iVar, iDim) = 0.0;
-
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Rmatrix(iPoint, iDim, jDim) = 0.0;
+  const bool overlap = geometry.GetCommOverlap() && !periodic;
+  const auto& pointsBeforeComms = geometry.GetPointsBeforeComms();
+  const size_t nPointBeforeComms = overlap ? pointsBeforeComms.size() : nPointDomain;
 
+  /*--- First loop over non-halo points of the grid. ---*/
 
-    for (auto jPoint : nodes->GetPoints(iPoint))
-    {
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
-
-
-      /*--- Distance vector from iPoint to jPoint ---*/
-
-      su2double dist_ij[nDim] = {0.0};
-      GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
-
-
-      /*--- Compute inverse weight, default 1 (unweighted). ---*/
-
-      su2double weight = 1.0;
-      if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
-
-      /*--- Summations for entries of upper triangular matrix R. ---*/
-
-      if (weight > 0.0)
-      {
-        weight = 1.0 / weight;
-
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = iDim; jDim < nDim; ++jDim)
-            Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
-
-        if (nDim == 3)
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
-
-        /*--- Entries of c:= transpose(A)*b ---*/
-
-        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-        {
-          AD::SetPreaccIn(field(jPoint,iVar));
-
-          su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
-
-          for (size_t iDim = 0; iDim < nDim; ++iDim)
-            gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
-        }
-      }
-    }
-
-    if (periodic)
-    {
-      /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
-
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
-
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
-
-      AD::EndPreacc();
-    }
-    else {
-      /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
-
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
-    }
-  }
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t k = 0; k < nPointBeforeComms; ++k)
+    computePoint(overlap ? pointsBeforeComms[k] : k);
   END_SU2_OMP_FOR
 
   /*--- Correct the gradient values across any periodic boundaries. ---*/
@@ -319,16 +354,23 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   correctGradientsSymmetry<nDim>(geometry, config, varBegin, varEnd, idxVel, gradient);
 
-  /*--- If no solver was provided we do not communicate ---*/
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them,
+   *    if no solver was provided we do not communicate. ---*/
 
-  if (solver != nullptr)
+  if (solver != nullptr) solver->InitiateComms(&geometry, &config, kindMpiComm);
+
+  if (overlap)
   {
-    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+    const auto& pointsDuringComms = geometry.GetPointsDuringComms();
 
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t k = 0; k < pointsDuringComms.size(); ++k)
+      computePoint(pointsDuringComms[k]);
+    END_SU2_OMP_FOR
   }
 
+  if (solver != nullptr) solver->CompleteComms(&geometry, &config, kindMpiComm);
+
 }
 } // end namespace
 
@@ -25,6 +25,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "../gradients/computeGradientsGreenGauss.hpp"
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
 
@@ -120,3 +121,84 @@ if (geometry.GetnDim() == 2) {\
   }
 #undef INSTANTIATE
 }
+
+/*!
+ * \brief A wrapper function for the fused computation of Green-Gauss gradients and limiters,
+ *        see "computeGradientsLimitersGreenGauss_impl" for details.
+ * \ingroup FvmAlgos
+ */
+template<class FieldType, class GradientType>
+void computeGradientsLimitersGreenGauss(LIMITER LimiterKind,
+                                        CSolver* solver,
+                                        MPI_QUANTITIES kindMpiComm,
+                                        CGeometry& geometry,
+                                        const CConfig& config,
+                                        size_t varBegin,
+                                        size_t varEnd,
+                                        int idxVel,
+                                        const FieldType& field,
+                                        GradientType& gradient,
+                                        FieldType& fieldMin,
+                                        FieldType& fieldMax,
+                                        FieldType& limiter)
+{
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
+
+#define INSTANTIATE(KIND)\
+if (geometry.GetnDim() == 2) {\
+  computeGradientsLimitersGreenGauss_impl<2,KIND>(solver, kindMpiComm, geometry, config, varBegin, varEnd,\
+                                                  idxVel, field, gradient, fieldMin, fieldMax, limiter);\
+} else {\
+  computeGradientsLimitersGreenGauss_impl<3,KIND>(solver, kindMpiComm, geometry, config, varBegin, varEnd,\
+                                                  idxVel, field, gradient, fieldMin, fieldMax, limiter);\
+}
+  switch (LimiterKind) {
+    case LIMITER::BARTH_JESPERSEN:
+    {
+      INSTANTIATE(LIMITER::BARTH_JESPERSEN);
+      break;
+    }
+    case LIMITER::VENKATAKRISHNAN:
+    {
+      INSTANTIATE(LIMITER::VENKATAKRISHNAN);
+      break;
+    }
+    case LIMITER::NISHIKAWA_R3:
+    {
+      INSTANTIATE(LIMITER::NISHIKAWA_R3);
+      break;
+    }
+    case LIMITER::NISHIKAWA_R4:
+    {
+      INSTANTIATE(LIMITER::NISHIKAWA_R4);
+      break;
+    }
+    case LIMITER::NISHIKAWA_R5:
+    {
+      INSTANTIATE(LIMITER::NISHIKAWA_R5);
+      break;
+    }
+    case LIMITER::VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(LIMITER::VENKATAKRISHNAN_WANG);
+      break;
+    }
+    case LIMITER::WALL_DISTANCE:
+    {
+      INSTANTIATE(LIMITER::WALL_DISTANCE);
+      break;
+    }
+    case LIMITER::SHARP_EDGES:
+    {
+      INSTANTIATE(LIMITER::SHARP_EDGES);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("Limiter type not supported by the fused gradient and limiter computation.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+}
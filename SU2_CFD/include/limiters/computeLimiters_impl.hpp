@@ -28,6 +28,125 @@
  */
 
 
+namespace detail {
+
+/*!
+ * \brief Maximum number of variables for which limiters can be computed.
+ * \ingroup FvmAlgos
+ */
+constexpr size_t LIMITER_MAXNVAR = 32;
+
+/*!
+ * \brief Limiter computation for one point, see "computeLimiters_impl()".
+ * \ingroup FvmAlgos
+ * \param[in] iPoint - Point for which to compute the limiter.
+ * \param[in] initMinMax - Initialize min/max with the field value of iPoint, otherwise
+ *                         min/max were initialized before (e.g. by periodic comms).
+ */
+template<size_t nDim, class LimiterDetails, class FieldType, class GradientType>
+FORCEINLINE void computeLimiterPoint(size_t iPoint,
+                                     bool initMinMax,
+                                     CGeometry& geometry,
+                                     const LimiterDetails& limiterDetails,
+                                     size_t varBegin,
+                                     size_t varEnd,
+                                     const FieldType& field,
+                                     const GradientType& gradient,
+                                     FieldType& fieldMin,
+                                     FieldType& fieldMax,
+                                     FieldType& limiter)
+{
+  auto nodes = geometry.nodes;
+  const auto coord_i = nodes->GetCoord(iPoint);
+
+  /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+  if (omp_get_num_threads() == 1) AD::StartPreacc();
+  AD::SetPreaccIn(coord_i, nDim);
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  {
+    AD::SetPreaccIn(field(iPoint,iVar));
+
+    if (!initMinMax) {
+      /*--- Started outside loop, so counts as input. ---*/
+      AD::SetPreaccIn(fieldMax(iPoint,iVar));
+      AD::SetPreaccIn(fieldMin(iPoint,iVar));
+    }
+    else {
+      /*--- Initialize min/max now for iPoint. ---*/
+      fieldMax(iPoint,iVar) = field(iPoint,iVar);
+      fieldMin(iPoint,iVar) = field(iPoint,iVar);
+    }
+
+    for(size_t iDim = 0; iDim < nDim; ++iDim)
+      AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+  }
+
+  /*--- Initialize min/max projection out of iPoint. ---*/
+
+  su2double projMax[LIMITER_MAXNVAR], projMin[LIMITER_MAXNVAR];
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    projMax[iVar] = projMin[iVar] = 0.0;
+
+  /*--- Compute max/min projection and values over direct neighbors. ---*/
+
+  for (auto jPoint : nodes->GetPoints(iPoint)) {
+
+    const auto coord_j = nodes->GetCoord(jPoint);
+    AD::SetPreaccIn(coord_j, nDim);
+
+    /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+
+    su2double dist_ij[nDim] = {0.0};
+
+    for(size_t iDim = 0; iDim < nDim; ++iDim)
+      dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+    /*--- Project each variable, update min/max. ---*/
+
+    for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      su2double proj = 0.0;
+
+      for(size_t iDim = 0; iDim < nDim; ++iDim)
+        proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+      projMax[iVar] = max(projMax[iVar], proj);
+      projMin[iVar] = min(projMin[iVar], proj);
+
+      AD::SetPreaccIn(field(jPoint,iVar));
+
+      fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+      fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+    }
+  }
+
+  /*--- Compute the geometric factor. ---*/
+
+  su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+  /*--- Final limiter computation for each variable, get the min limiter
+   *    out of the positive/negative projections and deltas. ---*/
+
+  for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  {
+    su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                       fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+    su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                       fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+    limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+
+    AD::SetPreaccOut(limiter(iPoint,iVar));
+  }
+
+  AD::EndPreacc();
+}
+
+}  // namespace detail
+
 /*!
  * \brief Generic limiter computation for methods based on one limiter
  *        value per point (as opposed to one per edge) and per variable.
@@ -76,10 +195,8 @@ void computeLimiters_impl(CSolver* solver,
                           FieldType& fieldMax,
                           FieldType& limiter)
 {
-  constexpr size_t MAXNVAR = 32;
-
-  if (varEnd > MAXNVAR)
-    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+  if (varEnd > detail::LIMITER_MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase LIMITER_MAXNVAR.", CURRENT_FUNCTION);
 
   const size_t nPointDomain = geometry.GetnPointDomain();
   const size_t nPoint = geometry.GetnPoint();
@@ -125,119 +242,173 @@ void computeLimiters_impl(CSolver* solver,
     }
   }
 
+  /*--- With overlap of computation and comms (never with periodicity), only the
+   *    points that are sent are needed before the comms start (see CGeometry). ---*/
+
+  const bool overlap = geometry.GetCommOverlap() && !periodic;
+  const auto& pointsBeforeComms = geometry.GetPointsBeforeComms();
+  const size_t nPointBeforeComms = overlap ? pointsBeforeComms.size() : nPointDomain;
+
   /*--- Compute limiter for each point. ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
-
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
+  for (size_t k = 0; k < nPointBeforeComms; ++k)
+    detail::computeLimiterPoint<nDim>(overlap ? pointsBeforeComms[k] : k, !periodic, geometry, limiterDetails,
+                                      varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);
+  END_SU2_OMP_FOR
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  /*--- Account for periodic effects, take the minimum limiter on each periodic pair. ---*/
+  if (periodic)
+  {
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
     {
-      AD::SetPreaccIn(field(iPoint,iVar));
-
-      if (periodic) {
-        /*--- Started outside loop, so counts as input. ---*/
-        AD::SetPreaccIn(fieldMax(iPoint,iVar));
-        AD::SetPreaccIn(fieldMin(iPoint,iVar));
-      }
-      else {
-        /*--- Initialize min/max now for iPoint if not periodic. ---*/
-        fieldMax(iPoint,iVar) = field(iPoint,iVar);
-        fieldMin(iPoint,iVar) = field(iPoint,iVar);
-      }
-
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
     }
+  }
 
-    /*--- Initialize min/max projection out of iPoint. ---*/
+  /*--- Obtain the limiters at halo points from the MPI ranks that own them.
+   *    If no solver was provided we do not communicate. ---*/
+  if (solver != nullptr)
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
 
-    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+  if (overlap)
+  {
+    const auto& pointsDuringComms = geometry.GetPointsDuringComms();
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      projMax[iVar] = projMin[iVar] = 0.0;
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t k = 0; k < pointsDuringComms.size(); ++k)
+      detail::computeLimiterPoint<nDim>(pointsDuringComms[k], true, geometry, limiterDetails, varBegin, varEnd,
+                                        field, gradient, fieldMin, fieldMax, limiter);
+    END_SU2_OMP_FOR
+  }
 
-    /*--- Compute max/min projection and values over direct neighbors. ---*/
+  if (solver != nullptr)
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
 
-    for (auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+  AD::EndPassive(wasActive);
 
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
+}
 
-      /*--- Distance vector from iPoint to face (middle of the edge). ---*/
 
-      su2double dist_ij[nDim] = {0.0};
+/*!
+ * \brief Fused computation of Green-Gauss gradients and of a point-based limiter.
+ * \ingroup FvmAlgos
+ * \note The result is the same as "computeGradientsGreenGauss()" followed by
+ *       "computeLimiters_impl()", but the limiter of interior points is computed
+ *       in the same loop as their gradients (the gradients of points that are not
+ *       on any marker are final after the loop over edges). Boundary points are
+ *       finalized after the boundary contributions are added. Gradients and
+ *       limiters are then communicated together.
+ * \note Periodic boundaries are not supported, they require separate periodic
+ *       communications of gradients and limiters.
+ *
+ * Arguments:
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication, must include gradients and limiters.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] varBegin - First variable index for which to compute gradients and limiters.
+ * \param[in] varEnd - End of computation range (nVar = end-begin).
+ * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
+ * \param[in] field - Variable field.
+ * \param[out] gradient - Gradient of the field.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field.
+ */
+template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType>
+void computeGradientsLimitersGreenGauss_impl(CSolver* solver,
+                                             MPI_QUANTITIES kindMpiComm,
+                                             CGeometry& geometry,
+                                             const CConfig& config,
+                                             size_t varBegin,
+                                             size_t varEnd,
+                                             int idxVel,
+                                             const FieldType& field,
+                                             GradientType& gradient,
+                                             FieldType& fieldMin,
+                                             FieldType& fieldMax,
+                                             FieldType& limiter)
+{
+  if (varEnd > detail::LIMITER_MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase LIMITER_MAXNVAR.", CURRENT_FUNCTION);
 
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+  if (solver != nullptr && config.GetnMarker_Periodic() > 0)
+    SU2_MPI::Error("Fused gradients and limiters are not available with periodic boundaries.", CURRENT_FUNCTION);
 
-      /*--- Project each variable, update min/max. ---*/
+  const size_t nPointDomain = geometry.GetnPointDomain();
 
-      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      {
-        su2double proj = 0.0;
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
 
-        for(size_t iDim = 0; iDim < nDim; ++iDim)
-          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
 
-        projMax[iVar] = max(projMax[iVar], proj);
-        projMin[iVar] = min(projMin[iVar], proj);
+  CLimiterDetails<LimiterKind> limiterDetails;
 
-        AD::SetPreaccIn(field(jPoint,iVar));
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
 
-        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
-        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
-      }
-    }
+  /*--- With overlap of computation and comms, the points that are sent or that have boundary
+   *    contributions are finalized first, and the remaining (interior) points are computed
+   *    while the comms are in flight (see CGeometry). ---*/
 
-    /*--- Compute the geometric factor. ---*/
+  const bool overlap = geometry.GetCommOverlap();
+  const auto& pointsBeforeComms = geometry.GetPointsBeforeComms();
+  const size_t nPointBeforeComms = overlap ? pointsBeforeComms.size() : nPointDomain;
 
-    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+  /*--- Gradients of all points, and limiters of interior points. ---*/
 
-    /*--- Final limiter computation for each variable, get the min limiter
-     *    out of the positive/negative projections and deltas. ---*/
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t k = 0; k < nPointBeforeComms; ++k)
+  {
+    const size_t iPoint = overlap ? pointsBeforeComms[k] : k;
 
-    for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-    {
-      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
-                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
+    detail::computeGradientGreenGaussPoint<nDim>(iPoint, geometry, field, varBegin, varEnd, gradient);
 
-      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
-                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
+    if (!overlap && !geometry.nodes->GetBoundary(iPoint))
+      detail::computeLimiterPoint<nDim>(iPoint, true, geometry, limiterDetails, varBegin, varEnd,
+                                        field, gradient, fieldMin, fieldMax, limiter);
+  }
+  END_SU2_OMP_FOR
 
-      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+  detail::computeGradientsGreenGaussBoundary<nDim>(geometry, config, field, varBegin, varEnd, idxVel, gradient);
 
-      AD::SetPreaccOut(limiter(iPoint,iVar));
-    }
+  /*--- Limiters of boundary points, now that their gradients are final. ---*/
 
-    AD::EndPreacc();
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t k = 0; k < nPointBeforeComms; ++k)
+  {
+    const size_t iPoint = overlap ? pointsBeforeComms[k] : k;
+
+    if (overlap || geometry.nodes->GetBoundary(iPoint))
+      detail::computeLimiterPoint<nDim>(iPoint, true, geometry, limiterDetails, varBegin, varEnd,
+                                        field, gradient, fieldMin, fieldMax, limiter);
   }
   END_SU2_OMP_FOR
 
-  /*--- Account for periodic effects, take the minimum limiter on each periodic pair. ---*/
-  if (periodic)
+  /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them.
+   *    If no solver was provided we do not communicate. ---*/
+  if (solver != nullptr)
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+
+  if (overlap)
   {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+    const auto& pointsDuringComms = geometry.GetPointsDuringComms();
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t k = 0; k < pointsDuringComms.size(); ++k)
     {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
+      const size_t iPoint = pointsDuringComms[k];
+
+      detail::computeGradientGreenGaussPoint<nDim>(iPoint, geometry, field, varBegin, varEnd, gradient);
+
+      detail::computeLimiterPoint<nDim>(iPoint, true, geometry, limiterDetails, varBegin, varEnd,
+                                        field, gradient, fieldMin, fieldMax, limiter);
     }
+    END_SU2_OMP_FOR
   }
 
-  /*--- Obtain the limiters at halo points from the MPI ranks that own them.
-   *    If no solver was provided we do not communicate. ---*/
   if (solver != nullptr)
-  {
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
     solver->CompleteComms(&geometry, &config, kindMpiComm);
-  }
-
-  AD::EndPassive(wasActive);
-
 }
@@ -29,8 +29,13 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/convection.hpp"
+#include "scalar/turb_sources.hpp"
 
 namespace {
 
@@ -44,6 +49,24 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSM:
+      obj = new CAUSMScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -55,7 +78,18 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
  */
 template<class ViscousDecorator>
 CNumericsSIMD* createUpwindGeneralNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
-  return nullptr;
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case UPWIND::ROE:
+      obj = new CGeneralRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::HLLC:
+      obj = new CGeneralHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    default:
+      break;
+  }
+  return obj;
 }
 
 /*!
@@ -83,11 +117,46 @@ CNumericsSIMD* createCenteredNumerics(const CConfig& config, int iMesh, const CV
   return obj;
 }
 
+/*!
+ * \brief Incompressible flow factory implementation.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createIncompressibleNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_UPWIND:
+      if (config.GetKind_Upwind_Flow() == UPWIND::FDS)
+        obj = new CFDSIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case SPACE_CENTERED:
+      switch ((iMesh==MESH_0)? config.GetKind_Centered_Flow() : CENTERED::LAX) {
+        case CENTERED::LAX:
+          obj = new CLaxIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        case CENTERED::JST:
+          obj = new CJSTIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        default:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Generic factory implementation.
  */
 template<int nDim>
 CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetViscous())
+      return createIncompressibleNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+    return createIncompressibleNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+  }
+
   CNumericsSIMD* obj = nullptr;
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
@@ -126,6 +195,134 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Species transport factory implementation, the number of species is a template parameter.
+ */
+template<int nDim, class FlowIndices, size_t nSpecies = 1>
+CNumericsSIMD* createSpeciesNumerics(const CConfig& config, int iMesh, unsigned short flowPrimVarGrad,
+                                     const CVariable* flowVars) {
+  if (config.GetnSpecies() == nSpecies) {
+    return new CUpwScalarScheme<CSpeciesDiffusion<nDim,nSpecies,FlowIndices> >(config, iMesh, flowPrimVarGrad,
+                                                                                flowVars, nullptr);
+  }
+  return createSpeciesNumerics<nDim,FlowIndices,nSpecies+1>(config, iMesh, flowPrimVarGrad, flowVars);
+}
+
+template<>
+CNumericsSIMD* createSpeciesNumerics<2,CEulerVariable::CIndices<size_t>,5>(const CConfig&, int, unsigned short,
+                                                                           const CVariable*) { return nullptr; }
+template<>
+CNumericsSIMD* createSpeciesNumerics<3,CEulerVariable::CIndices<size_t>,5>(const CConfig&, int, unsigned short,
+                                                                           const CVariable*) { return nullptr; }
+template<>
+CNumericsSIMD* createSpeciesNumerics<2,CIncEulerVariable::CIndices<size_t>,5>(const CConfig&, int, unsigned short,
+                                                                              const CVariable*) { return nullptr; }
+template<>
+CNumericsSIMD* createSpeciesNumerics<3,CIncEulerVariable::CIndices<size_t>,5>(const CConfig&, int, unsigned short,
+                                                                              const CVariable*) { return nullptr; }
+
+/*!
+ * \brief Scalar transport factory implementation.
+ */
+template<int nDim, class FlowIndices>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, int iMesh, int iSol, unsigned short flowPrimVarGrad,
+                                    const CVariable* flowVars, const su2double* constants,
+                                    CSysVector<su2double>* edgeFluxesDiff) {
+  if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND && iSol == TURB_SOL) return nullptr;
+  if (config.GetKind_ConvNumScheme_Species() != SPACE_UPWIND && iSol == SPECIES_SOL) return nullptr;
+
+  if (iSol == SPECIES_SOL) {
+    if (config.GetKind_Species_Model() != SPECIES_MODEL::SPECIES_TRANSPORT) return nullptr;
+    return createSpeciesNumerics<nDim,FlowIndices>(config, iMesh, flowPrimVarGrad, flowVars);
+  }
+  if (iSol != TURB_SOL) return nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA:
+      if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+        return new CUpwScalarScheme<CSADiffusion<nDim,FlowIndices,true> >(config, iMesh, flowPrimVarGrad,
+                                                                           flowVars, edgeFluxesDiff);
+      return new CUpwScalarScheme<CSADiffusion<nDim,FlowIndices,false> >(config, iMesh, flowPrimVarGrad,
+                                                                          flowVars, edgeFluxesDiff);
+    case TURB_MODEL::SST:
+      return new CUpwScalarScheme<CSSTDiffusion<nDim,FlowIndices> >(config, iMesh, flowPrimVarGrad, constants,
+                                                                     flowVars, nullptr);
+    default:
+      return nullptr;
+  }
+}
+
+/*!
+ * \brief SA source factory implementation, for one version of the model.
+ */
+template<int nDim, class FlowIndices, SA_OPTIONS VERSION>
+CSourceNumericsSIMD* createSASource(const CConfig& config, const CVariable* flowVars) {
+  const auto options = config.GetSAParsedOptions();
+  if (options.ft2) {
+    if (options.comp) return new CSASource<nDim,FlowIndices,VERSION,true,true>(config, flowVars);
+    return new CSASource<nDim,FlowIndices,VERSION,true,false>(config, flowVars);
+  }
+  if (options.comp) return new CSASource<nDim,FlowIndices,VERSION,false,true>(config, flowVars);
+  return new CSASource<nDim,FlowIndices,VERSION,false,false>(config, flowVars);
+}
+
+/*!
+ * \brief SST source factory implementation, for one version of the model.
+ */
+template<int nDim, class FlowIndices, SST_OPTIONS VERSION>
+CSourceNumericsSIMD* createSSTSource(const CConfig& config, const CVariable* flowVars, const su2double* constants,
+                                     su2double kineInf, su2double omegaInf) {
+  switch (config.GetSSTParsedOptions().production) {
+    case SST_OPTIONS::NONE:
+      return new CSSTSource<nDim,FlowIndices,VERSION,SST_OPTIONS::NONE>(config, flowVars, constants,
+                                                                         kineInf, omegaInf);
+    case SST_OPTIONS::V:
+      return new CSSTSource<nDim,FlowIndices,VERSION,SST_OPTIONS::V>(config, flowVars, constants,
+                                                                      kineInf, omegaInf);
+    case SST_OPTIONS::KL:
+      return new CSSTSource<nDim,FlowIndices,VERSION,SST_OPTIONS::KL>(config, flowVars, constants,
+                                                                       kineInf, omegaInf);
+    case SST_OPTIONS::COMP_Wilcox:
+      return new CSSTSource<nDim,FlowIndices,VERSION,SST_OPTIONS::COMP_Wilcox>(config, flowVars, constants,
+                                                                                kineInf, omegaInf);
+    case SST_OPTIONS::COMP_Sarkar:
+      return new CSSTSource<nDim,FlowIndices,VERSION,SST_OPTIONS::COMP_Sarkar>(config, flowVars, constants,
+                                                                                kineInf, omegaInf);
+    default:
+      /*--- The perturbed Reynolds stresses of UQ are not vectorized. ---*/
+      return nullptr;
+  }
+}
+
+/*!
+ * \brief Turbulence source factory implementation.
+ */
+template<int nDim, class FlowIndices>
+CSourceNumericsSIMD* createTurbSourceNumerics(const CConfig& config, const CVariable* flowVars,
+                                              const su2double* constants, su2double kineInf, su2double omegaInf) {
+  /*--- Transition, hybrid RANS/LES, and axisymmetric terms are only in the scalar implementation. ---*/
+  if (config.GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE ||
+      config.GetKind_HybridRANSLES() != NO_HYBRIDRANSLES || config.GetAxisymmetric()) return nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA: {
+      if (config.GetSAParsedOptions().bc) return nullptr;
+      switch (config.GetSAParsedOptions().version) {
+        case SA_OPTIONS::NONE: return createSASource<nDim,FlowIndices,SA_OPTIONS::NONE>(config, flowVars);
+        case SA_OPTIONS::NEG: return createSASource<nDim,FlowIndices,SA_OPTIONS::NEG>(config, flowVars);
+        case SA_OPTIONS::EDW: return createSASource<nDim,FlowIndices,SA_OPTIONS::EDW>(config, flowVars);
+        default: return nullptr;
+      }
+    }
+    case TURB_MODEL::SST:
+      if (config.GetSSTParsedOptions().version == SST_OPTIONS::V1994)
+        return createSSTSource<nDim,FlowIndices,SST_OPTIONS::V1994>(config, flowVars, constants, kineInf, omegaInf);
+      return createSSTSource<nDim,FlowIndices,SST_OPTIONS::V2003>(config, flowVars, constants, kineInf, omegaInf);
+    default:
+      return nullptr;
+  }
+}
+
 } // namespace
 
 /*!
@@ -145,3 +342,41 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, int iMesh, int iSol,
+                                                   unsigned short flowPrimVarGrad, const CVariable* flowVars,
+                                                   const su2double* constants,
+                                                   CSysVector<su2double>* edgeFluxesDiff) {
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    using FlowIndices = CIncEulerVariable::CIndices<size_t>;
+    if (nDim == 2) return createScalarNumerics<2,FlowIndices>(config, iMesh, iSol, flowPrimVarGrad, flowVars,
+                                                              constants, edgeFluxesDiff);
+    if (nDim == 3) return createScalarNumerics<3,FlowIndices>(config, iMesh, iSol, flowPrimVarGrad, flowVars,
+                                                              constants, edgeFluxesDiff);
+  }
+  else if (config.GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE && !config.GetNEMOProblem()) {
+    using FlowIndices = CEulerVariable::CIndices<size_t>;
+    if (nDim == 2) return createScalarNumerics<2,FlowIndices>(config, iMesh, iSol, flowPrimVarGrad, flowVars,
+                                                              constants, edgeFluxesDiff);
+    if (nDim == 3) return createScalarNumerics<3,FlowIndices>(config, iMesh, iSol, flowPrimVarGrad, flowVars,
+                                                              constants, edgeFluxesDiff);
+  }
+  return nullptr;
+}
+
+CSourceNumericsSIMD* CSourceNumericsSIMD::CreateTurbSourceNumerics(const CConfig& config, int nDim,
+                                                                   const CVariable* flowVars,
+                                                                   const su2double* constants,
+                                                                   su2double kineInf, su2double omegaInf) {
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    using FlowIndices = CIncEulerVariable::CIndices<size_t>;
+    if (nDim == 2) return createTurbSourceNumerics<2,FlowIndices>(config, flowVars, constants, kineInf, omegaInf);
+    if (nDim == 3) return createTurbSourceNumerics<3,FlowIndices>(config, flowVars, constants, kineInf, omegaInf);
+  }
+  else if (config.GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE && !config.GetNEMOProblem()) {
+    using FlowIndices = CEulerVariable::CIndices<size_t>;
+    if (nDim == 2) return createTurbSourceNumerics<2,FlowIndices>(config, flowVars, constants, kineInf, omegaInf);
+    if (nDim == 3) return createTurbSourceNumerics<3,FlowIndices>(config, flowVars, constants, kineInf, omegaInf);
+  }
+  return nullptr;
+}
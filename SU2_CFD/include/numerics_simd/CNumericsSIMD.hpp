@@ -97,4 +97,65 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the convective and diffusive fluxes of scalar transport solvers.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] iSol - Position of the scalar solver in the solver container (TURB_SOL or SPECIES_SOL).
+   * \param[in] flowPrimVarGrad - Number of flow primitives with reconstruction gradients.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Model constants (SST).
+   * \param[in] edgeFluxesDiff - Storage for the non-conservative part of the fluxes (SA, reducer strategy).
+   * \return Nullptr if the model is not vectorized.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, int iMesh, int iSol,
+                                             unsigned short flowPrimVarGrad, const CVariable* flowVars,
+                                             const su2double* constants = nullptr,
+                                             CSysVector<su2double>* edgeFluxesDiff = nullptr);
+
+};
+
+/*!
+ * \class CSourceNumericsSIMD
+ * \ingroup SourceDiscr
+ * \brief Base class to define the interface of vectorized source terms (point loops).
+ */
+class CSourceNumericsSIMD {
+public:
+  /*!
+   * \brief Interface for source term computation.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the residuals, the source term is subtracted.
+   * \param[in,out] matrix - Target for the Jacobians, subtracted from the diagonal blocks.
+   * \note The update mask is used to handle "remainder" points (nPoint mod simdSize).
+   */
+  virtual void ComputeResidual(Int iPoint,
+                               const CConfig& config,
+                               const CGeometry& geometry,
+                               const CVariable& solution,
+                               Double updateMask,
+                               CSysVector<su2double>& vector,
+                               SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CSourceNumericsSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the source terms of turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Model constants (SST).
+   * \param[in] kineInf - Freestream k, for SST with sustaining terms.
+   * \param[in] omegaInf - Freestream omega, for SST with sustaining terms.
+   * \return Nullptr if the model (or one of its options) is not vectorized.
+   */
+  static CSourceNumericsSIMD* CreateTurbSourceNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                                       const su2double* constants = nullptr,
+                                                       su2double kineInf = 0.0, su2double omegaInf = 0.0);
 };
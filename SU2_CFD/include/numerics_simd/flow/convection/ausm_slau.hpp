@@ -0,0 +1,564 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM-family (AUSM, AUSM+up, AUSM+up2, SLAU, SLAU2) of convective schemes.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMBase
+ * \ingroup ConvDiscr
+ * \brief Base class for schemes that fit the general form of AUSM+up and SLAU,
+ * F = ||A|| ( 0.5 * mdot * (psi_i+psi_j) - 0.5 * |mdot| * (psi_i-psi_j) + N * pf ),
+ * with psi = (1, u, v, w, H), see CUpwAUSMPLUS_SLAU_Base_Flow.
+ * Derived classes implement the face mass flux (mdot) and pressure (pf) in a const
+ * "massAndPressureFluxes" method, as functions of the velocities, pressures, densities,
+ * and enthalpies at nodes i/j. They also define the static constexpr booleans
+ * "LowDissipation" (the pressure flux uses the Roe low-dissipation coefficient) and
+ * "AccurateJacobian" (the Jacobians can be obtained by differentiating mdot and pf),
+ * if the latter is false, or not requested, the Jacobians of the Roe scheme are used.
+ * \note See CRoeBase for the role of Base.
+ */
+template<class Derived, class Base>
+class CAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+  static constexpr passivedouble finDiffStep = 1e-4;
+
+  using PrimVarType = CCompressiblePrimitives<nDim,nPrimVarGrad>;
+
+  const su2double gamma;
+  const su2double gasConst;
+  const bool finestGrid;
+  const bool muscl;
+  const bool useAccurateJacobian;
+  const LIMITER typeLimiter;
+  const ENUM_ROELOWDISS typeDissip;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    gasConst(config.GetGas_ConstantND()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    useAccurateJacobian(Derived::AccurateJacobian && config.GetUse_Accurate_Jacobians()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    typeDissip(Derived::LowDissipation ? static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss()) : NO_ROELOWDISS) {
+  }
+
+  /*!
+   * \brief Approximate the Jacobians with those of the Roe scheme.
+   */
+  FORCEINLINE void approximateJacobians(const CPair<PrimVarType>& V,
+                                        const VectorDbl<nDim>& normal,
+                                        const VectorDbl<nDim>& unitNormal,
+                                        Double area,
+                                        MatrixDbl<nVar>& jac_i,
+                                        MatrixDbl<nVar>& jac_j) const {
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    /*--- Jacobians of the inviscid flux, scale = 0.5 because flux ~ 0.5*(fc_i+fc_j)*Normal ---*/
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), V.i.enthalpy() - V.i.pressure() / V.i.density(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), V.j.enthalpy() - V.j.pressure() / V.j.density(), normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        /*--- Compute |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+        jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+      }
+    }
+  }
+
+  /*!
+   * \brief Chain rule from derivatives w.r.t. velocity, pressure, density, and enthalpy (stored
+   * with the layout of the primitives), to derivatives w.r.t. the conservatives (ideal gas).
+   */
+  FORCEINLINE VectorDbl<nVar> conservativeDerivatives(const PrimVarType& V, const VectorDbl<nPrimVarGrad>& df_dV) const {
+    const su2double gm1 = gamma - 1;
+    const Double oneOnRho = 1 / V.density();
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+    const Double dH_drho = 0.5*(gamma-2)*sqVel - gamma*V.pressure()/(gm1*V.density());
+
+    VectorDbl<nVar> df_dU;
+    df_dU(0) = df_dV(nDim+1)*0.5*gm1*sqVel + df_dV(nDim+2) + df_dV(nDim+3)*dH_drho*oneOnRho;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      df_dU(0) -= df_dV(iDim+1)*V.velocity(iDim)*oneOnRho;
+      df_dU(iDim+1) = (df_dV(iDim+1) - gm1*V.velocity(iDim)*(df_dV(nDim+1)*V.density() + df_dV(nDim+3))) * oneOnRho;
+    }
+    df_dU(nDim+1) = df_dV(nDim+1)*gm1 + df_dV(nDim+3)*gamma*oneOnRho;
+    return df_dU;
+  }
+
+  /*!
+   * \brief Jacobians obtained by differentiating the mass and pressure fluxes w.r.t.
+   * the primitives (1st order finite differences), assuming phi = |mdot|.
+   */
+  FORCEINLINE void accurateJacobians(const CPair<PrimVarType>& V,
+                                     const VectorDbl<nDim>& normal,
+                                     const VectorDbl<nDim>& unitNormal,
+                                     Double area,
+                                     Double dissipation,
+                                     Double mdot,
+                                     Double pressure,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+
+    /*--- Perturb velocity, pressure, density, and enthalpy, i.e. all but the temperature. ---*/
+
+    CPair<VectorDbl<nPrimVarGrad> > dmdot_dV, dpres_dV;
+    auto Vp = V;
+    for (size_t iVar = 1; iVar < nPrimVarGrad; ++iVar) {
+      Double mdot_p, pressure_p;
+
+      const Double eps_i = finDiffStep * fmax(1.0, abs(V.i.all(iVar)));
+      Vp.i.all(iVar) += eps_i;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dV.i(iVar) = (mdot_p - mdot) / eps_i;
+      dpres_dV.i(iVar) = (pressure_p - pressure) / eps_i;
+      Vp.i.all(iVar) = V.i.all(iVar);
+
+      const Double eps_j = finDiffStep * fmax(1.0, abs(V.j.all(iVar)));
+      Vp.j.all(iVar) += eps_j;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dV.j(iVar) = (mdot_p - mdot) / eps_j;
+      dpres_dV.j(iVar) = (pressure_p - pressure) / eps_j;
+      Vp.j.all(iVar) = V.j.all(iVar);
+    }
+
+    const auto dmdot_dUi = conservativeDerivatives(V.i, dmdot_dV.i);
+    const auto dmdot_dUj = conservativeDerivatives(V.j, dmdot_dV.j);
+    const auto dpres_dUi = conservativeDerivatives(V.i, dpres_dV.i);
+    const auto dpres_dUj = conservativeDerivatives(V.j, dpres_dV.j);
+
+    /*--- Contribution from the mass flux derivatives, psi of the upwind side. ---*/
+
+    const Double upwind_i = mdot > 0.0;
+    const Double upwind_j = 1 - upwind_i;
+
+    VectorDbl<nVar> psi;
+    psi(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psi(iDim+1) = area * (upwind_i*V.i.velocity(iDim) + upwind_j*V.j.velocity(iDim));
+    }
+    psi(nDim+1) = area * (upwind_i*V.i.enthalpy() + upwind_j*V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psi(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psi(iVar) * dmdot_dUj(jVar);
+      }
+    }
+
+    /*--- Contribution from the pressure derivatives. ---*/
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dUj(jVar);
+      }
+    }
+
+    /*--- Contributions from the derivatives of psi w.r.t. the conservatives of the upwind side. ---*/
+
+    auto psiDerivatives = [&](const PrimVarType& V, Double weight, MatrixDbl<nVar>& jac) {
+      const Double mdotHat = weight * area * mdot / V.density();
+      const Double sqVel = squaredNorm<nDim>(V.velocity());
+      const Double dH_drho = 0.5*(gamma-2)*sqVel - gamma*V.pressure()/((gamma-1)*V.density());
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(iDim+1,0) -= mdotHat * V.velocity(iDim);
+        jac(iDim+1,iDim+1) += mdotHat;
+        jac(nDim+1,iDim+1) -= mdotHat * (gamma-1) * V.velocity(iDim);
+      }
+      jac(nDim+1,0) += mdotHat * dH_drho;
+      jac(nDim+1,nDim+1) += mdotHat * gamma;
+    };
+    psiDerivatives(V.i, upwind_i, jac_i);
+    psiDerivatives(V.j, upwind_j, jac_j);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the general AUSM-type flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<PrimVarType>(
+        iEdge, iPoint, jPoint, gamma, gasConst, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes defined by the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                             0.5*absMdot*(V.i.velocity(iDim) - V.j.velocity(iDim)) + unitNormal(iDim)*pressure);
+    }
+    flux(nDim+1) = area * (0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) +
+                           0.5*absMdot*(V.i.enthalpy() - V.j.enthalpy()));
+
+    /*--- Jacobians, either accurate or approximate (Roe). ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (useAccurateJacobian)
+        accurateJacobians(V, normal, unitNormal, area, dissipation, mdot, pressure, jac_i, jac_j);
+      else
+        approximateJacobians(V, normal, unitNormal, area, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMScheme
+ * \ingroup ConvDiscr
+ * \brief Original AUSM scheme, see CUpwAUSM_Flow.
+ */
+template<class Decorator>
+class CAUSMScheme : public CAUSMBase<CAUSMScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  static constexpr bool LowDissipation = false;
+  static constexpr bool AccurateJacobian = false;
+
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CAUSMScheme(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Mass flux and pressure based on the speed of sound of each side.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot<nDim>(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot<nDim>(V.j.velocity(), unitNormal);
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double speedSound_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*squaredNorm<nDim>(V.i.velocity()))));
+    const Double speedSound_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*squaredNorm<nDim>(V.j.velocity()))));
+
+    const Double mL = projVel_i / speedSound_i;
+    const Double mR = projVel_j / speedSound_j;
+
+    /*--- Subsonic (1) or supersonic (0) splittings. ---*/
+    const Double subL = abs(mL) <= 1.0;
+    const Double subR = abs(mR) <= 1.0;
+
+    const Double mLP = subL*0.25*pow(mL+1, 2) + (1-subL)*0.5*(mL+abs(mL));
+    const Double mRM = -subR*0.25*pow(mR-1, 2) + (1-subR)*0.5*(mR-abs(mR));
+    const Double mF = mLP + mRM;
+
+    const Double pLP = subL*0.25*pow(mL+1, 2)*(2-mL) + (1-subL)*(mL > 0.0);
+    const Double pRM = subR*0.25*pow(mR-1, 2)*(2+mR) + (1-subR)*(mR < 0.0);
+
+    const Double upwind_i = mF > 0.0;
+    mdot = mF * (upwind_i*V.i.density()*speedSound_i + (1-upwind_i)*V.j.density()*speedSound_j);
+    pressure = pLP*V.i.pressure() + pRM*V.j.pressure();
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up and AUSM+up2 schemes, see CUpwAUSMPLUSUP_Flow and CUpwAUSMPLUSUP2_Flow.
+ * \note The two differ only in the pressure flux, selected by the template parameter "UP2".
+ */
+template<class Decorator, bool UP2>
+class CAUSMPLUSUPScheme : public CAUSMBase<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+  const su2double Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+public:
+  static constexpr bool LowDissipation = false;
+  static constexpr bool AccurateJacobian = true;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+  }
+
+  /*!
+   * \brief Mass flux with pressure diffusion and pressure with velocity diffusion,
+   * based on the interface speed of sound and a reference Mach number.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot<nDim>(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot<nDim>(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / fmax(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / fmax(astarR,-projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4 + 5*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    const Double subL = abs(mL) <= 1.0;
+    const Double subR = abs(mR) <= 1.0;
+
+    Double p1 = 0.25*pow(mL+1, 2);
+    Double p2 = pow(mL*mL-1, 2);
+    const Double mLP = subL*(p1 + beta*p2) + (1-subL)*0.5*(mL+abs(mL));
+    const Double pLP = subL*(p1*(2-mL) + alpha*mL*p2) + (1-subL)*(mL > 0.0);
+
+    p1 = 0.25*pow(mR-1, 2);
+    p2 = pow(mR*mR-1, 2);
+    const Double mRM = subR*(-p1 - beta*p2) + (1-subR)*0.5*(mR-abs(mR));
+    const Double pRM = subR*(p1*(2+mR) - alpha*mR*p2) + (1-subR)*(mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa)*fmax(1-sigma*MFsq, 0.0)*(V.j.pressure()-V.i.pressure())/(rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+
+    /*--- Pressure flux with velocity diffusion term. ---*/
+
+    if (!UP2) {
+      const Double Pu = -Ku*fa*pLP*pRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = pLP*V.i.pressure() + pRM*V.j.pressure() + Pu;
+    }
+    else {
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(pLP-pRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(pLP+pRM-1)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU and SLAU2 schemes, see CUpwSLAU_Flow and CUpwSLAU2_Flow.
+ * \note The two differ only in the pressure flux, selected by the template parameter "SLAU2".
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  static constexpr bool LowDissipation = true;
+  static constexpr bool AccurateJacobian = true;
+
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Mass flux with density-weighted normal velocity, and pressure flux
+   * with (optionally reduced) dissipation.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot<nDim>(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot<nDim>(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double speedSound_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double speedSound_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach numbers. ---*/
+
+    const Double aF = 0.5*(speedSound_i + speedSound_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double velMag = sqrt(0.5*(sqVel_i + sqVel_j));
+    const Double machTilde = fmin(1.0, velMag / aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double absVel_i = abs(projVel_i);
+    const Double absVel_j = abs(projVel_j);
+    const Double vnMag = (V.i.density()*absVel_i + V.j.density()*absVel_j) / (V.i.density() + V.j.density());
+    const Double vnMagL = (1-fRho)*vnMag + fRho*absVel_i;
+    const Double vnMagR = (1-fRho)*vnMag + fRho*absVel_j;
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5*(V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double subR = abs(mR) < 1.0;
+    const Double betaL = subL*0.25*(2-mL)*pow(mL+1, 2) + (1-subL)*(mL >= 0.0);
+    const Double betaR = subR*0.25*(2+mR)*pow(mR-1, 2) + (1-subR)*(mR < 0.0);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    } else {
+      pressure += dissipation*velMag*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    }
+  }
+};
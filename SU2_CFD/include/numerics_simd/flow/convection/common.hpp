@@ -93,6 +93,56 @@ FORCEINLINE void musclEdgeLimited(Int iPoint,
   }
 }
 
+/*!
+ * \brief MUSCL reconstruction of the first nVarGrad variables of a pair, with the selected limiter.
+ */
+template<size_t nVarGrad, size_t nDim, class VarType, class Gradient_t, class Limiter_t>
+FORCEINLINE void musclReconstruction(Int iPoint, Int jPoint,
+                                     LIMITER limiterType,
+                                     const VectorDbl<nDim>& vector_ij,
+                                     const Gradient_t& gradients,
+                                     const Limiter_t& limiters,
+                                     CPair<VarType>& V) {
+  switch (limiterType) {
+  case LIMITER::NONE:
+    musclUnlimited<nVarGrad>(iPoint, vector_ij, 0.5, gradients, V.i.all);
+    musclUnlimited<nVarGrad>(jPoint, vector_ij,-0.5, gradients, V.j.all);
+    break;
+  case LIMITER::VAN_ALBADA_EDGE:
+    musclEdgeLimited<nVarGrad>(iPoint, jPoint, vector_ij, gradients, V);
+    break;
+  default:
+    musclPointLimited<nVarGrad>(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
+    musclPointLimited<nVarGrad>(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
+    break;
+  }
+}
+
+/*!
+ * \brief Revert to first order the SIMD lanes where the reconstruction is non-physical.
+ * \param[in] iEdge - Edges, to update the non-physical edge counter of the solution.
+ * \param[in] nonPhysical - Mask, 1 where the reconstructed state is non-physical.
+ * \param[in] V1st - Pair of first order primitive variables.
+ * \param[in,out] V - Pair of reconstructed primitive variables.
+ * \param[in] solution - Entire solution container (a derived CVariable).
+ */
+template<class ReconVarType, class PrimVarType, class VariableType>
+FORCEINLINE void revertNonPhysical(Int iEdge,
+                                   Double nonPhysical,
+                                   const CPair<PrimVarType>& V1st,
+                                   CPair<ReconVarType>& V,
+                                   const VariableType& solution) {
+  Double bad_recon = nonPhysical;
+  /*--- Handle SIMD dimensions 1 by 1. ---*/
+  for (size_t k = 0; k < Double::Size; ++k) {
+    bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
+  }
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * V.i.all(iVar);
+    V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * V.j.all(iVar);
+  }
+}
+
 /*!
  * \brief Retrieve primitive variables for points i/j, reconstructing them if needed.
  * \note Density and enthalpy are recomputed from ideal gas EOS.
@@ -116,9 +166,6 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
                                                       const VariableType& solution) {
   static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
 
-  const auto& gradients = solution.GetGradient_Reconstruction();
-  const auto& limiters = solution.GetLimiter_Primitive();
-
   CPair<ReconVarType> V;
 
   for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
@@ -130,19 +177,9 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
     /*--- Recompute density and enthalpy instead of reconstructing. ---*/
     constexpr auto nVarGrad = ReconVarType::nVar - 2;
 
-    switch (limiterType) {
-    case LIMITER::NONE:
-      musclUnlimited<nVarGrad>(iPoint, vector_ij, 0.5, gradients, V.i.all);
-      musclUnlimited<nVarGrad>(jPoint, vector_ij,-0.5, gradients, V.j.all);
-      break;
-    case LIMITER::VAN_ALBADA_EDGE:
-      musclEdgeLimited<nVarGrad>(iPoint, jPoint, vector_ij, gradients, V);
-      break;
-    default:
-      musclPointLimited<nVarGrad>(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
-      musclPointLimited<nVarGrad>(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
-      break;
-    }
+    musclReconstruction<nVarGrad>(iPoint, jPoint, limiterType, vector_ij,
+                                  solution.GetGradient_Reconstruction(), solution.GetLimiter_Primitive(), V);
+
     V.i.density() = V.i.pressure() / (gasConst * V.i.temperature());
     V.j.density() = V.j.pressure() / (gasConst * V.j.temperature());
 
@@ -166,15 +203,65 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
     const Double neg_sound_speed = enthalpy * (R+1) < 0.5 * v_squared;
 
     /*--- Revert to first order if the state is non-physical. ---*/
-    Double bad_recon = fmax(neg_p_or_rho, neg_sound_speed);
-    /*--- Handle SIMD dimensions 1 by 1. ---*/
-    for (size_t k = 0; k < Double::Size; ++k) {
-      bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
-    }
-    for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
-      V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * V.i.all(iVar);
-      V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * V.j.all(iVar);
-    }
+    revertNonPhysical(iEdge, fmax(neg_p_or_rho, neg_sound_speed), V1st, V, solution);
+  }
+  return V;
+}
+
+/*!
+ * \brief Retrieve primitive variables for points i/j, reconstructing them if needed (general gas).
+ * \note Temperature, velocity, pressure, and density are reconstructed, the enthalpy is then
+ * recomputed with the equation of state linearized about the nodal state, i.e. using the
+ * nodal secondary variables, so that the fluid model is not evaluated in the edge loop.
+ * The secondary variables themselves are not reconstructed.
+ * \param[in] iEdge, iPoint, jPoint - Edge and its nodes.
+ * \param[in] muscl - If true, reconstruct, else simply fetch.
+ * \param[in] limiterType - Type of flux limiter.
+ * \param[in] V1st - Pair of compressible flow primitives for nodes i,j.
+ * \param[in] S - Pair of secondary variables for nodes i,j.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] solution - Entire solution container (a derived CVariable).
+ * \return Pair of primitive variables.
+ */
+template<class ReconVarType, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<ReconVarType> reconstructGeneralPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                             bool muscl, LIMITER limiterType,
+                                                             const CPair<PrimVarType>& V1st,
+                                                             const CPair<CCompressibleSecondary>& S,
+                                                             const VectorDbl<nDim>& vector_ij,
+                                                             const VariableType& solution) {
+  static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
+
+  CPair<ReconVarType> V;
+
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = V1st.i.all(iVar);
+    V.j.all(iVar) = V1st.j.all(iVar);
+  }
+
+  if (muscl) {
+    /*--- Recompute the enthalpy instead of reconstructing. ---*/
+    constexpr auto nVarGrad = ReconVarType::nVar - 1;
+
+    musclReconstruction<nVarGrad>(iPoint, jPoint, limiterType, vector_ij,
+                                  solution.GetGradient_Reconstruction(), solution.GetLimiter_Primitive(), V);
+
+    auto linearizedEnthalpy = [](const PrimVarType& V0, const CCompressibleSecondary& S0, ReconVarType& V) {
+      const Double e0 = V0.enthalpy() - V0.pressure() / V0.density() - 0.5 * squaredNorm<nDim>(V0.velocity());
+      const Double e = e0 + (V.pressure() - V0.pressure() - S0.dPdrho_e() * (V.density() - V0.density())) / S0.dPde_rho();
+      V.enthalpy() = e + V.pressure() / V.density() + 0.5 * squaredNorm<nDim>(V.velocity());
+    };
+    linearizedEnthalpy(V1st.i, S.i, V.i);
+    linearizedEnthalpy(V1st.j, S.j, V.j);
+
+    /*--- Detect a non-physical reconstruction based on negative pressure or density. ---*/
+    const Double neg_p_or_rho = fmax(fmin(V.i.pressure(), V.j.pressure()) < 0.0,
+                                     fmin(V.i.density(), V.j.density()) < 0.0);
+    /*--- Test the sign of the squared speed of sound, c^2 = dP/drho_e + dP/de_rho * P / rho^2. ---*/
+    const Double neg_sound_speed = fmin(S.i.speedSound2(V.i), S.j.speedSound2(V.j)) < 0.0;
+
+    /*--- Revert to first order if the state is non-physical. ---*/
+    revertNonPhysical(iEdge, fmax(neg_p_or_rho, neg_sound_speed), V1st, V, solution);
   }
   return V;
 }
@@ -304,6 +391,135 @@ FORCEINLINE MatrixDbl<nDim+2> pMatrixInv(Double gamma, Double density, const Ran
   return pMatInv;
 }
 
+/*!
+ * \brief Compute and return the P tensor (compressible flow, general gas).
+ * \note chi and kappa are the derivatives of pressure w.r.t. density and volumetric internal
+ * energy, for an ideal gas chi = 0 and kappa = gamma-1, which recovers "pMatrix".
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> generalPMatrix(Double chi, Double kappa, Double density,
+                                             const RandomAccessIterator& velocity, Double enthalpy,
+                                             Double projVel, Double speedSound, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> pMat;
+  const Double zeta = 0.5*squaredNorm<nDim>(velocity) - chi/kappa;
+
+  if (nDim == 2) {
+    pMat(0,0) = 1.0;
+    pMat(0,1) = 0.0;
+
+    pMat(1,0) = velocity[0];
+    pMat(1,1) = density*normal(1);
+
+    pMat(2,0) = velocity[1];
+    pMat(2,1) = -density*normal(0);
+
+    pMat(3,0) = zeta;
+    pMat(3,1) = density*(velocity[0]*normal(1) - velocity[1]*normal(0));
+  }
+  else {
+    pMat(0,0) = normal(0);
+    pMat(0,1) = normal(1);
+    pMat(0,2) = normal(2);
+
+    pMat(1,0) = velocity[0]*normal(0);
+    pMat(1,1) = velocity[0]*normal(1) - density*normal(2);
+    pMat(1,2) = velocity[0]*normal(2) + density*normal(1);
+
+    pMat(2,0) = velocity[1]*normal(0) + density*normal(2);
+    pMat(2,1) = velocity[1]*normal(1);
+    pMat(2,2) = velocity[1]*normal(2) - density*normal(0);
+
+    pMat(3,0) = velocity[2]*normal(0) - density*normal(1);
+    pMat(3,1) = velocity[2]*normal(1) + density*normal(0);
+    pMat(3,2) = velocity[2]*normal(2);
+
+    pMat(4,0) = zeta*normal(0) + density*(velocity[1]*normal(2) - velocity[2]*normal(1));
+    pMat(4,1) = zeta*normal(1) - density*(velocity[0]*normal(2) - velocity[2]*normal(0));
+    pMat(4,2) = zeta*normal(2) + density*(velocity[0]*normal(1) - velocity[1]*normal(0));
+  }
+
+  /*--- Last two columns. ---*/
+
+  const Double rhoOn2 = 0.5*density;
+  const Double rhoOnTwoC = rhoOn2 / speedSound;
+  pMat(0,nDim) = rhoOnTwoC;
+  pMat(0,nDim+1) = rhoOnTwoC;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    pMat(iDim+1,nDim) = rhoOnTwoC * velocity[iDim] + rhoOn2 * normal(iDim);
+    pMat(iDim+1,nDim+1) = rhoOnTwoC * velocity[iDim] - rhoOn2 * normal(iDim);
+  }
+
+  pMat(nDim+1,nDim) = rhoOnTwoC * enthalpy + rhoOn2 * projVel;
+  pMat(nDim+1,nDim+1) = rhoOnTwoC * enthalpy - rhoOn2 * projVel;
+
+  return pMat;
+}
+
+/*!
+ * \brief Compute and return the inverse P tensor (compressible flow, general gas).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> generalPMatrixInv(Double chi, Double kappa, Double density,
+                                                const RandomAccessIterator& velocity, Double projVel,
+                                                Double speedSound, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> pMatInv;
+
+  const Double c2 = pow(speedSound,2);
+  const Double dPdrho = chi + 0.5*kappa*squaredNorm<nDim>(velocity);
+  const Double oneOnRho = 1 / density;
+
+  if (nDim == 2) {
+    Double tmp = kappa/c2;
+    pMatInv(0,0) = 1.0 - dPdrho/c2;
+    pMatInv(0,1) = tmp*velocity[0];
+    pMatInv(0,2) = tmp*velocity[1];
+    pMatInv(0,3) = -tmp;
+
+    pMatInv(1,0) = (normal(0)*velocity[1]-normal(1)*velocity[0])*oneOnRho;
+    pMatInv(1,1) = normal(1)*oneOnRho;
+    pMatInv(1,2) = -normal(0)*oneOnRho;
+    pMatInv(1,3) = 0.0;
+  }
+  else {
+    Double tmp = kappa/c2 * normal(0);
+    pMatInv(0,0) = normal(0) - normal(0)*dPdrho/c2 - (normal(2)*velocity[1]-normal(1)*velocity[2])*oneOnRho;
+    pMatInv(0,1) = tmp*velocity[0];
+    pMatInv(0,2) = tmp*velocity[1] + normal(2)*oneOnRho;
+    pMatInv(0,3) = tmp*velocity[2] - normal(1)*oneOnRho;
+    pMatInv(0,4) = -tmp;
+
+    tmp = kappa/c2 * normal(1);
+    pMatInv(1,0) = normal(1) - normal(1)*dPdrho/c2 + (normal(2)*velocity[0]-normal(0)*velocity[2])*oneOnRho;
+    pMatInv(1,1) = tmp*velocity[0] - normal(2)*oneOnRho;
+    pMatInv(1,2) = tmp*velocity[1];
+    pMatInv(1,3) = tmp*velocity[2] + normal(0)*oneOnRho;
+    pMatInv(1,4) = -tmp;
+
+    tmp = kappa/c2 * normal(2);
+    pMatInv(2,0) = normal(2) - normal(2)*dPdrho/c2 - (normal(1)*velocity[0]-normal(0)*velocity[1])*oneOnRho;
+    pMatInv(2,1) = tmp*velocity[0] + normal(1)*oneOnRho;
+    pMatInv(2,2) = tmp*velocity[1] - normal(0)*oneOnRho;
+    pMatInv(2,3) = tmp*velocity[2];
+    pMatInv(2,4) = -tmp;
+  }
+
+  /*--- Last two rows. ---*/
+
+  const Double oneOnRhoTimesC = 1 / (density*speedSound);
+
+  for (size_t iVar = nDim; iVar < nDim+2; ++iVar) {
+    Double sign = (iVar==nDim)? 1 : -1;
+    pMatInv(iVar,0) = -sign*projVel*oneOnRho + dPdrho * oneOnRhoTimesC;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      pMatInv(iVar,iDim+1) = sign*normal(iDim)*oneOnRho - kappa * oneOnRhoTimesC * velocity[iDim];
+    }
+    pMatInv(iVar,nDim+1) = kappa * oneOnRhoTimesC;
+  }
+
+  return pMatInv;
+}
+
 /*!
  * \brief Convective projected (onto normal) flux (compressible flow).
  */
@@ -360,6 +576,42 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Jacobian of the convective flux (compressible flow, general gas).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> generalInviscidProjJac(Double chi, Double kappa,
+                                                     RandomAccessIterator velocity, Double enthalpy,
+                                                     const VectorDbl<nDim>& normal, Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  Double projVel = dot(velocity, normal);
+  Double phi = chi + 0.5*kappa*squaredNorm<nDim>(velocity);
+
+  jac(0,0) = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * normal(iDim);
+  }
+  jac(0,nDim+1) = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim)*phi - velocity[iDim]*projVel);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * (normal(jDim)*velocity[iDim] - kappa*normal(iDim)*velocity[jDim]);
+    }
+    jac(iDim+1,iDim+1) += scale * projVel;
+    jac(iDim+1,nDim+1) = scale * kappa * normal(iDim);
+  }
+
+  jac(nDim+1,0) = scale * projVel * (phi-enthalpy);
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * (normal(iDim)*enthalpy - kappa*velocity[iDim]*projVel);
+  }
+  jac(nDim+1,nDim+1) = scale * (kappa+1) * projVel;
+
+  return jac;
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
@@ -452,3 +704,230 @@ FORCEINLINE void scalarDissipationJacobian(const VariableType& V,
     jac(nVar-1,0) += dissipConst * pow(V.velocity(iDim), 2);
   }
 }
+
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE VectorDbl<nDim+2> incInviscidProjFlux(Double density, const RandomAccessIterator& velocity,
+                                                  Double pressure, Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  const Double mdot = density * dot(velocity, normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*velocity[iDim] + normal(iDim)*pressure;
+  }
+  flux(nDim+1) = mdot*enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux w.r.t. the primitive variables (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> incInviscidProjJac(Double density, const RandomAccessIterator& velocity,
+                                                 Double beta2, Double cp, Double temperature,
+                                                 Double dRhodT, const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  const Double projVel = dot(velocity, normal);
+  const Double enthalpy = cp*temperature;
+
+  jac(0,0) = scale * projVel / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * normal(iDim) * density;
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + velocity[iDim]*projVel/beta2);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * normal(jDim) * density * velocity[iDim];
+    }
+    jac(iDim+1,iDim+1) += scale * density * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * velocity[iDim] * projVel;
+  }
+
+  jac(nDim+1,0) = scale * enthalpy * projVel / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * enthalpy * normal(iDim) * density;
+  }
+  jac(nDim+1,nDim+1) = scale * cp * (temperature*dRhodT + density) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Preconditioning matrix, i.e. Jacobian of the conservative w.r.t. the primitive variables
+ * (incompressible flow with artificial compressibility).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density, const RandomAccessIterator& velocity,
+                                                Double beta2, Double cp, Double temperature,
+                                                Double dRhodT) {
+  MatrixDbl<nDim+2> precon;
+
+  precon(0,0) = 1 / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity[iDim] / beta2;
+  }
+  precon(nDim+1,0) = cp * temperature / beta2;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precon(0,jDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,jDim+1) = (iDim == jDim) ? density : Double(0.0);
+    }
+    precon(nDim+1,jDim+1) = 0.0;
+  }
+
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,nDim+1) = velocity[iDim] * dRhodT;
+  }
+  precon(nDim+1,nDim+1) = cp * (dRhodT*temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Absolute value of the preconditioned projected Jacobian, P |Lambda| P^-1,
+ * where P diagonalizes the preconditioned system (incompressible flow).
+ * \param[in] lambdaConv - Absolute value of the convective eigenvalue.
+ * \param[in] lambdaMinus, lambdaPlus - Absolute values of the acoustic eigenvalues.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density, Double beta2, Double lambdaConv,
+                                                       Double lambdaMinus, Double lambdaPlus,
+                                                       const VectorDbl<nDim>& unitNormal) {
+  MatrixDbl<nDim+2> absJac;
+
+  const Double sqrtBeta2 = sqrt(beta2);
+  const Double lambdaSum = lambdaMinus + lambdaPlus;
+  const Double lambdaDiff = lambdaPlus - lambdaMinus;
+
+  absJac(0,0) = 0.5 * lambdaSum;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    absJac(iDim+1,0) = 0.5 * unitNormal(iDim) * lambdaDiff / (sqrtBeta2 * density);
+  }
+  absJac(nDim+1,0) = 0.0;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    absJac(0,jDim+1) = 0.5 * sqrtBeta2 * unitNormal(jDim) * density * lambdaDiff;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      if (iDim == jDim) {
+        absJac(iDim+1,jDim+1) = 0.5 * lambdaSum * pow(unitNormal(iDim),2);
+        for (size_t kDim = 0; kDim < nDim; ++kDim) {
+          if (kDim != iDim) absJac(iDim+1,jDim+1) += 2 * lambdaConv * pow(unitNormal(kDim),2);
+        }
+      }
+      else {
+        absJac(iDim+1,jDim+1) = 0.5 * unitNormal(iDim) * unitNormal(jDim) * (lambdaSum - 2*lambdaConv);
+      }
+    }
+    absJac(nDim+1,jDim+1) = 0.0;
+  }
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    absJac(iDim+1,nDim+1) = 0.0;
+  }
+  absJac(0,nDim+1) = 0.0;
+  absJac(nDim+1,nDim+1) = lambdaConv;
+
+  return absJac;
+}
+
+/*!
+ * \brief Correct the flux and Jacobians of incompressible schemes for grid motion.
+ * \param[in] projGridVel - Grid velocity projected onto the (area-scaled) normal.
+ */
+template<class PrimVarType, size_t nVar>
+FORCEINLINE void incGridMotionCorrection(Double projGridVel,
+                                         const CPair<PrimVarType>& V,
+                                         bool implicit,
+                                         VectorDbl<nVar>& flux,
+                                         MatrixDbl<nVar>& jac_i,
+                                         MatrixDbl<nVar>& jac_j) {
+  constexpr size_t nDim = PrimVarType::nDim;
+
+  const auto U_i = incompressibleConservatives(V.i);
+  const auto U_j = incompressibleConservatives(V.j);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    flux(iVar) -= projGridVel * 0.5*(U_i(iVar) + U_j(iVar));
+  }
+  if (!implicit) return;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac_i(iDim+1,iDim+1) -= 0.5 * projGridVel * V.i.density();
+    jac_j(iDim+1,iDim+1) -= 0.5 * projGridVel * V.j.density();
+  }
+  jac_i(nDim+1,nDim+1) -= 0.5 * projGridVel * V.i.density() * V.i.cp();
+  jac_j(nDim+1,nDim+1) -= 0.5 * projGridVel * V.j.density() * V.j.cp();
+}
+
+/*!
+ * \brief Remove the energy equation from the flux and Jacobians (incompressible flow without energy).
+ */
+template<size_t nVar>
+FORCEINLINE void incRemoveEnergy(bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) {
+  flux(nVar-1) = 0.0;
+  if (!implicit) return;
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac_i(iVar,nVar-1) = 0.0;
+    jac_j(iVar,nVar-1) = 0.0;
+    jac_i(nVar-1,iVar) = 0.0;
+    jac_j(nVar-1,iVar) = 0.0;
+  }
+}
+
+/*!
+ * \brief Retrieve primitive variables for points i/j, reconstructing them if needed (incompressible flow).
+ * \note Pressure, velocity, temperature, density, and beta^2 are reconstructed, the remaining
+ * variables (transport properties and cp) are those of the nodes.
+ * \param[in] iEdge, iPoint, jPoint - Edge and its nodes.
+ * \param[in] muscl - If true, reconstruct, else simply fetch.
+ * \param[in] energy - If the energy equation is solved (enables the non-physical check).
+ * \param[in] limiterType - Type of flux limiter.
+ * \param[in] V1st - Pair of incompressible flow primitives for nodes i,j.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] solution - Entire solution container (a derived CVariable).
+ * \return Pair of primitive variables.
+ */
+template<class ReconVarType, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<ReconVarType> reconstructIncPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                         bool muscl, bool energy, LIMITER limiterType,
+                                                         const CPair<PrimVarType>& V1st,
+                                                         const VectorDbl<nDim>& vector_ij,
+                                                         const VariableType& solution) {
+  static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
+
+  CPair<ReconVarType> V;
+
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = V1st.i.all(iVar);
+    V.j.all(iVar) = V1st.j.all(iVar);
+  }
+
+  if (muscl) {
+    constexpr size_t nVarGrad = nDim+4;
+
+    musclReconstruction<nVarGrad>(iPoint, jPoint, limiterType, vector_ij,
+                                  solution.GetGradient_Reconstruction(), solution.GetLimiter_Primitive(), V);
+
+    /*--- The pressure is the dynamic pressure (can be negative), hence only temperature
+     *    and density need to be checked, and only if the energy equation is solved. ---*/
+    if (energy) {
+      const Double neg_T_or_rho = fmax(fmin(V.i.temperature(), V.j.temperature()) < 0.0,
+                                       fmin(V.i.density(), V.j.density()) < 0.0);
+      revertNonPhysical(iEdge, neg_T_or_rho, V1st, V, solution);
+    }
+  }
+  return V;
+}
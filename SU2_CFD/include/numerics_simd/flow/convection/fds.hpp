@@ -0,0 +1,218 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting scheme for incompressible flow (artificial compressibility).
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CFDSIncScheme
+ * \ingroup ConvDiscr
+ * \brief Flux difference splitting scheme for incompressible flows, the
+ * dissipation is based on the preconditioned (artificial compressibility) system.
+ * \note See CRoeBase for the role of Decorator.
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool variableDensity;
+  const bool energy;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    variableDensity(config.GetVariable_Density_Model()),
+    energy(config.GetEnergy_Equation()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructIncPrimitives<CIncompressiblePrimitives<nDim,nDim+8> >(
+        iEdge, iPoint, jPoint, muscl, energy, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mean variables. ---*/
+
+    CIncompressiblePrimitives<nDim,nDim+8> avgV;
+    for (size_t iVar = 0; iVar < nDim+8; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double projVel = dot(avgV.velocity(), normal) - projGridVel;
+
+    /*--- Eigenvalues of the preconditioned system, based on the artificial speed of sound. ---*/
+
+    const Double speedSound = sqrt(avgV.beta2()) * area;
+    const Double lambdaConv = abs(projVel);
+    const Double lambdaMinus = abs(projVel - speedSound);
+    const Double lambdaPlus = abs(projVel + speedSound);
+
+    /*--- Derivative of density w.r.t. temperature (ideal gas law). ---*/
+
+    Double dRhodT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      dRhodT = -avgV.density() / avgV.temperature();
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Dissipation matrix, Precon x |A_precon|. ---*/
+
+    const auto precon = incPreconditioner<nDim>(avgV.density(), avgV.velocity(), avgV.beta2(),
+                                                avgV.cp(), avgV.temperature(), dRhodT);
+    const auto absJac = incPreconditionedProjJac(avgV.density(), avgV.beta2(), lambdaConv,
+                                                 lambdaMinus, lambdaPlus, unitNormal);
+    MatrixDbl<nVar> dissMat;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        dissMat(iVar,jVar) = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dissMat(iVar,jVar) += precon(iVar,kVar) * absJac(kVar,jVar);
+        }
+        dissMat(iVar,jVar) *= 0.5;
+      }
+    }
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    const auto flux_i = incInviscidProjFlux(V.i.density(), V.i.velocity(), V.i.pressure(), V.i.enthalpy(), normal);
+    const auto flux_j = incInviscidProjFlux(V.j.density(), V.j.velocity(), V.j.pressure(), V.j.enthalpy(), normal);
+
+    /*--- Difference of (pressure, velocity, temperature), the first nVar primitives. ---*/
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        flux(iVar) -= dissMat(iVar,jVar) * (V.j.all(jVar) - V.i.all(jVar));
+      }
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = incInviscidProjJac(V.i.density(), V.i.velocity(), V.i.beta2(), V.i.cp(),
+                                 V.i.temperature(), dRhodT_i, normal, 0.5);
+      jac_j = incInviscidProjJac(V.j.density(), V.j.velocity(), V.j.beta2(), V.j.cp(),
+                                 V.j.temperature(), dRhodT_j, normal, 0.5);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) += dissMat(iVar,jVar);
+          jac_j(iVar,jVar) -= dissMat(iVar,jVar);
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      incGridMotionCorrection(projGridVel, V, implicit, flux, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) incRemoveEnergy(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
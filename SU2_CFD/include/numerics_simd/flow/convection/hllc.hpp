@@ -0,0 +1,408 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme (ideal and general gas).
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme, vectorized version of CUpwHLLC_Flow (IdealGas = true) and of
+ * CUpwGeneralHLLC_Flow (IdealGas = false).
+ * \note The scalar version branches on the position of the contact surface (sM) and
+ * on the left/right wave speeds. Here the state upwind of the contact surface (k) and the
+ * other state (o) are selected per SIMD lane, which reduces the 4 cases of the scalar
+ * version to 2 (supersonic or star state), these are then blended based on masks.
+ * For general gases the pressure derivatives (chi, kappa) are computed from the secondary
+ * variables of the solution, for ideal gases they are chi = 0 and kappa = gamma-1.
+ */
+template<class Decorator, bool IdealGas = true>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const su2double gasConst;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Derivatives of the contact surface speed w.r.t. the conservative variables of one side.
+   * \param[in] V - Primitives of the side.
+   * \param[in] projVel - Projected velocity of the side.
+   * \param[in] s - Wave speed of the side.
+   * \param[in] sM - Contact surface speed.
+   * \param[in] dPI_dU - Derivatives of the pressure of the side w.r.t. its conservatives.
+   * \param[in] factor - +/- 1 over the denominator of sM.
+   */
+  template<class PrimVarType>
+  FORCEINLINE static VectorDbl<nVar> contactSpeedDerivatives(const PrimVarType& V,
+                                                             Double projVel,
+                                                             Double s,
+                                                             Double sM,
+                                                             const VectorDbl<nDim>& unitNormal,
+                                                             const VectorDbl<nVar>& dPI_dU,
+                                                             Double factor) {
+    VectorDbl<nVar> dSm_dU;
+    dSm_dU(0) = (sM*s - projVel*projVel + dPI_dU(0)) * factor;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dSm_dU(iDim+1) = (unitNormal(iDim)*(2*projVel - s - sM) + dPI_dU(iDim+1)) * factor;
+    }
+    dSm_dU(nDim+1) = dPI_dU(nDim+1) * factor;
+    return dSm_dU;
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    gasConst(config.GetGas_ConstantND()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives, for general gases the secondary variables are first order. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    CPair<CCompressibleSecondary> S;
+    CPair<CCompressiblePrimitives<nDim,nPrimVarGrad> > V;
+    if (IdealGas) {
+      V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+          iEdge, iPoint, jPoint, gamma, gasConst, muscl, typeLimiter, V1st, vector_ij, solution);
+    } else {
+      S.i.all = gatherVariables<CCompressibleSecondary::nVar>(iPoint, solution.GetSecondary());
+      S.j.all = gatherVariables<CCompressibleSecondary::nVar>(jPoint, solution.GetSecondary());
+      V = reconstructGeneralPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+          iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, S, vector_ij, solution);
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Speed of sound and projected velocity, corrected for grid motion. ---*/
+
+    CPair<Double> chi, kappa;
+    if (IdealGas) {
+      chi.i = chi.j = 0.0;
+      kappa.i = kappa.j = gamma - 1;
+    } else {
+      chi.i = S.i.chi(V.i);  kappa.i = S.i.kappa(V.i);
+      chi.j = S.j.chi(V.j);  kappa.j = S.j.kappa(V.j);
+    }
+
+    CPair<Double> sqVel, speedSound, projVel;
+    sqVel.i = squaredNorm<nDim>(V.i.velocity());
+    sqVel.j = squaredNorm<nDim>(V.j.velocity());
+    speedSound.i = sqrt(chi.i + kappa.i * (V.i.enthalpy() - 0.5*sqVel.i)) - projGridVel;
+    speedSound.j = sqrt(chi.j + kappa.j * (V.j.enthalpy() - 0.5*sqVel.j)) + projGridVel;
+    projVel.i = dot<nDim>(V.i.velocity(), unitNormal) - projGridVel;
+    projVel.j = dot<nDim>(V.j.velocity(), unitNormal) - projGridVel;
+
+    /*--- Roe-averaged variables. ---*/
+
+    const Double sqrtRho_i = sqrt(V.i.density());
+    const Double sqrtRho_j = sqrt(V.j.density());
+    const Double D = 1 / (sqrtRho_i + sqrtRho_j);
+
+    VectorDbl<nDim> roeVelocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      roeVelocity(iDim) = (sqrtRho_i*V.i.velocity(iDim) + sqrtRho_j*V.j.velocity(iDim)) * D;
+    }
+    const Double roeProjVel = dot(roeVelocity, unitNormal) - projGridVel;
+    const Double roeEnthalpy = (sqrtRho_i*V.i.enthalpy() + sqrtRho_j*V.j.enthalpy()) * D;
+    Double roeChi = 0.5 * (chi.i + chi.j);
+    Double roeKappa = 0.5 * (kappa.i + kappa.j);
+
+    if (!IdealGas) {
+      /*--- Vinokur-Montagne correction of the averaged pressure derivatives, such that
+       *    the averaged state satisfies the pressure jump, applied if the jumps are significant. ---*/
+      const Double deltaRho = V.j.density() - V.i.density();
+      const Double deltaP = V.j.pressure() - V.i.pressure();
+      const Double staticEnthalpy_i = V.i.enthalpy() - 0.5*sqVel.i;
+      const Double staticEnthalpy_j = V.j.enthalpy() - 0.5*sqVel.j;
+      const Double sc = roeChi + 0.5 * (staticEnthalpy_i*kappa.i + staticEnthalpy_j*kappa.j);
+      const Double D2 = pow(sc*deltaRho, 2) + pow(deltaP, 2);
+      const Double deltaRhoStaticEnergy = V.j.density()*staticEnthalpy_j - V.j.pressure() -
+                                          V.i.density()*staticEnthalpy_i + V.i.pressure();
+      const Double errP = deltaP - roeChi*deltaRho - roeKappa*deltaRhoStaticEnergy;
+      const Double denom = D2 - deltaP*errP;
+
+      const Double oneOnRho = 1 / V.i.density();
+      const Double correct = (abs(denom*oneOnRho) > 1e-3) * (abs(deltaRho*oneOnRho) > 1e-3) * (sc*oneOnRho > 1e-3);
+      const Double factor = correct / (correct*denom + (1-correct));
+
+      roeKappa = factor*D2*roeKappa + (1-correct)*roeKappa;
+      roeChi = factor*(D2*roeChi + pow(sc,2)*deltaRho*errP) + (1-correct)*roeChi;
+    }
+    const Double roeSpeedSound = sqrt(roeChi + roeKappa*(roeEnthalpy - 0.5*squaredNorm(roeVelocity))) - projGridVel;
+
+    /*--- Left and right wave speeds, speed of the contact surface, and pressure in the star region. ---*/
+
+    const Double sL = fmin(roeProjVel - roeSpeedSound, projVel.i - speedSound.i);
+    const Double sR = fmax(roeProjVel + roeSpeedSound, projVel.j + speedSound.j);
+
+    const Double rhoSum = V.j.density()*(sR - projVel.j) - V.i.density()*(sL - projVel.i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel.i*(sL - projVel.i) +
+                       V.j.density()*projVel.j*(sR - projVel.j)) / rhoSum;
+
+    const Double pStar = V.j.density()*(projVel.j - sR)*(projVel.j - sM) + V.j.pressure();
+
+    /*--- Select the upwind (k) and other (o) states, "left" is 1 if k = i. ---*/
+
+    const Double left = sM > 0.0;
+    const Double right = 1 - left;
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVarGrad> > W;
+    for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+      W.i.all(iVar) = left*V.i.all(iVar) + right*V.j.all(iVar);
+      W.j.all(iVar) = left*V.j.all(iVar) + right*V.i.all(iVar);
+    }
+    CPair<Double> chi_W, kappa_W, sqVel_W, projVel_W, s_W;
+    chi_W.i = left*chi.i + right*chi.j;
+    chi_W.j = left*chi.j + right*chi.i;
+    kappa_W.i = left*kappa.i + right*kappa.j;
+    kappa_W.j = left*kappa.j + right*kappa.i;
+    sqVel_W.i = left*sqVel.i + right*sqVel.j;
+    sqVel_W.j = left*sqVel.j + right*sqVel.i;
+    projVel_W.i = left*projVel.i + right*projVel.j;
+    projVel_W.j = left*projVel.j + right*projVel.i;
+    s_W.i = left*sL + right*sR;
+    s_W.j = left*sR + right*sL;
+
+    const Double energy_k = W.i.enthalpy() - W.i.pressure() / W.i.density();
+
+    /*--- The flux is that of the upwind state if the wave speed of that side has the same sign as sM. ---*/
+
+    const Double supersonic = left*(sL > 0.0) + right*(sR < 0.0);
+
+    /*--- Intermediate (star) state. ---*/
+
+    const Double omega = 1 / (s_W.i - sM);
+    const Double omegaSM = omega * sM;
+    const Double rhoStar = (s_W.i - projVel_W.i) * omega * W.i.density();
+
+    VectorDbl<nVar> starU;
+    starU(0) = rhoStar;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      starU(iDim+1) = rhoStar*W.i.velocity(iDim) + (pStar - W.i.pressure())*unitNormal(iDim)*omega;
+    }
+    starU(nDim+1) = rhoStar*energy_k - (W.i.pressure()*projVel_W.i - pStar*sM)*omega;
+    const Double energyStar = starU(nDim+1);
+
+    /*--- Fluxes. ---*/
+
+    const Double mdot = W.i.density() * projVel_W.i;
+
+    VectorDbl<nVar> flux;
+    flux(0) = supersonic*mdot + (1-supersonic)*sM*starU(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = supersonic*(mdot*W.i.velocity(iDim) + W.i.pressure()*unitNormal(iDim)) +
+                     (1-supersonic)*(sM*starU(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nDim+1) = supersonic*mdot*W.i.enthalpy() +
+                   (1-supersonic)*(sM*(energyStar + pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians w.r.t. the upwind and other states. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+
+    if (implicit) {
+      /*--- Pressure derivatives w.r.t. the conservatives of each state. ---*/
+
+      CPair<VectorDbl<nVar> > dPI_dU;
+      dPI_dU.i(0) = chi_W.i + 0.5*kappa_W.i*sqVel_W.i;
+      dPI_dU.j(0) = chi_W.j + 0.5*kappa_W.j*sqVel_W.j;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dPI_dU.i(iDim+1) = -kappa_W.i*W.i.velocity(iDim);
+        dPI_dU.j(iDim+1) = -kappa_W.j*W.j.velocity(iDim);
+      }
+      dPI_dU.i(nDim+1) = kappa_W.i;
+      dPI_dU.j(nDim+1) = kappa_W.j;
+
+      /*--- Derivatives of the contact speed, the sign changes with the side of the upwind state. ---*/
+
+      const Double factor = (left - right) / rhoSum;
+      const auto dSm_dUk = contactSpeedDerivatives(W.i, projVel_W.i, s_W.i, sM, unitNormal, dPI_dU.i, factor);
+      const auto dSm_dUo = contactSpeedDerivatives(W.j, projVel_W.j, s_W.j, sM, unitNormal, dPI_dU.j, -factor);
+
+      MatrixDbl<nVar> jac_k, jac_o;
+
+      /*--- Upwind state. ---*/
+      {
+        VectorDbl<nVar> dpStar_dU, drhoStar_dU, dEStar_dU;
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          dpStar_dU(iVar) = W.i.density()*(s_W.j - projVel_W.j)*dSm_dUk(iVar);
+          dEStar_dU(iVar) = omega*(sM*dpStar_dU(iVar) + (energyStar + pStar)*dSm_dUk(iVar));
+          drhoStar_dU(iVar) = omega*rhoStar*dSm_dUk(iVar);
+        }
+        drhoStar_dU(0) += omega*s_W.i;
+        dEStar_dU(0) += omega*projVel_W.i*(W.i.enthalpy() - dPI_dU.i(0));
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          drhoStar_dU(iDim+1) -= omega*unitNormal(iDim);
+          dEStar_dU(iDim+1) -= omega*(unitNormal(iDim)*W.i.enthalpy() + projVel_W.i*dPI_dU.i(iDim+1));
+        }
+        dEStar_dU(nDim+1) += omega*(s_W.i - projVel_W.i - projVel_W.i*dPI_dU.i(nDim+1));
+
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_k(0,iVar) = sM*drhoStar_dU(iVar) + rhoStar*dSm_dUk(iVar);
+        }
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          for (size_t iVar = 0; iVar < nVar; ++iVar) {
+            jac_k(jDim+1,iVar) = (omegaSM+1)*(unitNormal(jDim)*dpStar_dU(iVar) + starU(jDim+1)*dSm_dUk(iVar)) -
+                                 omegaSM*dPI_dU.i(iVar)*unitNormal(jDim);
+          }
+          jac_k(jDim+1,0) += omegaSM*W.i.velocity(jDim)*projVel_W.i;
+          jac_k(jDim+1,jDim+1) += omegaSM*(s_W.i - projVel_W.i);
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            jac_k(jDim+1,iDim+1) -= omegaSM*W.i.velocity(jDim)*unitNormal(iDim);
+          }
+        }
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_k(nDim+1,iVar) = sM*(dEStar_dU(iVar) + dpStar_dU(iVar)) + (energyStar + pStar)*dSm_dUk(iVar);
+        }
+      }
+
+      /*--- Other state. ---*/
+      {
+        VectorDbl<nVar> dpStar_dU, dEStar_dU;
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          dpStar_dU(iVar) = W.j.density()*(s_W.i - projVel_W.i)*dSm_dUo(iVar);
+          dEStar_dU(iVar) = omega*(sM*dpStar_dU(iVar) + (energyStar + pStar)*dSm_dUo(iVar));
+        }
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_o(0,iVar) = rhoStar*(omegaSM+1)*dSm_dUo(iVar);
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            jac_o(iDim+1,iVar) = (omegaSM+1)*(starU(iDim+1)*dSm_dUo(iVar) + unitNormal(iDim)*dpStar_dU(iVar));
+          }
+          jac_o(nDim+1,iVar) = sM*(dEStar_dU(iVar) + dpStar_dU(iVar)) + (energyStar + pStar)*dSm_dUo(iVar);
+        }
+      }
+
+      /*--- Supersonic case, only the upwind state contributes. ---*/
+
+      MatrixDbl<nVar> jac_sup;
+      if (IdealGas) {
+        jac_sup = inviscidProjJac(gamma, W.i.velocity(), energy_k, unitNormal, 1.0);
+      } else {
+        jac_sup = generalInviscidProjJac(chi_W.i, kappa_W.i, W.i.velocity(), W.i.enthalpy(), unitNormal, 1.0);
+      }
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_k(iVar,jVar) = area*(supersonic*jac_sup(iVar,jVar) + (1-supersonic)*jac_k(iVar,jVar));
+          jac_o(iVar,jVar) *= area*(1-supersonic);
+
+          jac_i(iVar,jVar) = left*jac_k(iVar,jVar) + right*jac_o(iVar,jVar);
+          jac_j(iVar,jVar) = left*jac_o(iVar,jVar) + right*jac_k(iVar,jVar);
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \brief HLLC scheme for general (non-ideal) gases.
+ */
+template<class Decorator>
+using CGeneralHLLCScheme = CHLLCScheme<Decorator, false>;
@@ -299,3 +299,235 @@ public:
     }
   }
 };
+
+/*!
+ * \class CGeneralRoeScheme
+ * \ingroup ConvDiscr
+ * \brief Roe scheme for general (non-ideal) gases, vectorized version of CUpwGeneralRoe_Flow.
+ * \note The thermodynamic derivatives (chi, kappa) are computed from the secondary variables
+ * stored by the solution, the fluid model is never evaluated in the edge loop.
+ */
+template<class Decorator>
+class CGeneralRoeScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double entropyFix;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CGeneralRoeScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    entropyFix(config.GetEntropyFix_Coeff()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the Roe flux for general gases.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives, the secondary variables are first order. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    CPair<CCompressibleSecondary> S;
+    S.i.all = gatherVariables<CCompressibleSecondary::nVar>(iPoint, solution.GetSecondary());
+    S.j.all = gatherVariables<CCompressibleSecondary::nVar>(jPoint, solution.GetSecondary());
+
+    auto V = reconstructGeneralPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+        iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, S, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Thermodynamic derivatives. ---*/
+
+    CPair<Double> chi, kap;
+    chi.i = S.i.chi(V.i);  kap.i = S.i.kappa(V.i);
+    chi.j = S.j.chi(V.j);  kap.j = S.j.kappa(V.j);
+
+    /*--- Roe averaged variables. ---*/
+
+    const Double R = sqrt(abs(V.j.density() / V.i.density()));
+    const Double D = 1 / (R+1);
+    CRoeVariables<nDim> roeAvg;
+    roeAvg.density = R * V.i.density();
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      roeAvg.velocity(iDim) = (R*V.j.velocity(iDim) + V.i.velocity(iDim)) * D;
+    }
+    roeAvg.enthalpy = (R*V.j.enthalpy() + V.i.enthalpy()) * D;
+    roeAvg.projVel = dot(roeAvg.velocity, unitNormal);
+
+    const Double roeChi = 0.5 * (chi.i + chi.j);
+    const Double roeKappa = 0.5 * (kap.i + kap.j);
+
+    /*--- The flux is zero if the averaged state has no real speed of sound. ---*/
+
+    const Double speedSound2 = roeChi + roeKappa * (roeAvg.enthalpy - 0.5*squaredNorm(roeAvg.velocity));
+    const Double valid = speedSound2 > 0.0;
+    roeAvg.speedSound = sqrt(valid * speedSound2 + (1-valid));
+
+    /*--- P tensor. ---*/
+
+    auto pMat = generalPMatrix(roeChi, roeKappa, roeAvg.density, roeAvg.velocity,
+                               roeAvg.enthalpy, roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0, projVel = roeAvg.projVel;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      projVel -= projGridVel;
+    }
+
+    /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = projVel;
+    }
+    lambda(nDim) = projVel + roeAvg.speedSound;
+    lambda(nDim+1) = projVel - roeAvg.speedSound;
+
+    Double maxLambda = abs(projVel) + roeAvg.speedSound;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambda(iVar) = fmax(abs(lambda(iVar)), entropyFix*maxLambda);
+    }
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidProjFlux(V.i, U.i, normal);
+    auto flux_j = inviscidProjFlux(V.j, U.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = generalInviscidProjJac(chi.i, kap.i, V.i.velocity(), V.i.enthalpy(), normal, kappa);
+      jac_j = generalInviscidProjJac(chi.j, kap.j, V.j.velocity(), V.j.enthalpy(), normal, kappa);
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Double dFdU = projGridVel * area * 0.5;
+        flux(iVar) -= dFdU * (U.i.all(iVar) + U.j.all(iVar));
+
+        if (implicit) {
+          jac_i(iVar,iVar) -= dFdU;
+          jac_j(iVar,iVar) -= dFdU;
+        }
+      }
+    }
+
+    /*--- Dissipation terms, |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+    auto pMatInv = generalPMatrixInv(roeChi, roeKappa, roeAvg.density, roeAvg.velocity,
+                                     roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> deltaU;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      deltaU(iVar) = U.j.all(iVar) - U.i.all(iVar);
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+
+        Double dDdU = projModJacTensor * (1-kappa) * area;
+
+        flux(iVar) -= dDdU * deltaU(jVar);
+
+        if(implicit) {
+          jac_i(iVar,jVar) += dDdU;
+          jac_j(iVar,jVar) -= dDdU;
+        }
+      }
+    }
+
+    /*--- Discard the inviscid contributions where the average state is not valid. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= valid;
+      if (implicit) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) *= valid;
+          jac_j(iVar,jVar) *= valid;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
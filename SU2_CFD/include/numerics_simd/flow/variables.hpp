@@ -63,6 +63,43 @@ struct CCompressiblePrimitives {
   FORCEINLINE const Double& cp() const { return all(nDim+8); }
 };
 
+/*!
+ * \brief Type to store the secondary variables of compressible flow (general gas) that are
+ * needed by convective schemes, i.e. the derivatives of pressure w.r.t. density and energy.
+ */
+struct CCompressibleSecondary {
+  static constexpr size_t nVar = 2;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& dPdrho_e() { return all(0); }
+  FORCEINLINE Double& dPde_rho() { return all(1); }
+  FORCEINLINE const Double& dPdrho_e() const { return all(0); }
+  FORCEINLINE const Double& dPde_rho() const { return all(1); }
+
+  /*!
+   * \brief Derivative of pressure w.r.t. the volumetric internal energy at constant density (kappa).
+   */
+  template<class PrimVarType>
+  FORCEINLINE Double kappa(const PrimVarType& V) const { return dPde_rho() / V.density(); }
+
+  /*!
+   * \brief Derivative of pressure w.r.t. density at constant volumetric internal energy (chi).
+   */
+  template<class PrimVarType>
+  FORCEINLINE Double chi(const PrimVarType& V) const {
+    const Double staticEnergy = V.enthalpy() - V.pressure() / V.density() -
+                                0.5 * squaredNorm<PrimVarType::nDim>(V.velocity());
+    return dPdrho_e() - kappa(V) * staticEnergy;
+  }
+
+  /*!
+   * \brief Square of the speed of sound, chi + kappa * h = dP/drho_e + dP/de_rho * P / rho^2.
+   */
+  template<class PrimVarType>
+  FORCEINLINE Double speedSound2(const PrimVarType& V) const {
+    return dPdrho_e() + dPde_rho() * V.pressure() / pow(V.density(), 2);
+  }
+};
+
 /*!
  * \brief Type to store compressible conservative (i.e. solution) variables.
  */
@@ -97,6 +134,56 @@ FORCEINLINE CCompressibleConservatives<nDim> compressibleConservatives(const CCo
   return U;
 }
 
+/*!
+ * \brief Type to store incompressible primitive variables and access them by name.
+ */
+template<size_t nDim_, size_t nVar_>
+struct CIncompressiblePrimitives {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nVar_;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& pressure() { return all(0); }
+  FORCEINLINE Double& temperature() { return all(nDim+1); }
+  FORCEINLINE Double& density() { return all(nDim+2); }
+  FORCEINLINE Double& beta2() { return all(nDim+3); }
+  FORCEINLINE Double& velocity(size_t iDim) { return all(iDim+1); }
+  FORCEINLINE const Double& pressure() const { return all(0); }
+  FORCEINLINE const Double& temperature() const { return all(nDim+1); }
+  FORCEINLINE const Double& density() const { return all(nDim+2); }
+  FORCEINLINE const Double& beta2() const { return all(nDim+3); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(iDim+1); }
+  FORCEINLINE const Double* velocity() const { return &velocity(0); }
+
+  /*--- Un-reconstructed variables. ---*/
+  FORCEINLINE Double& laminarVisc() { return all(nDim+4); }
+  FORCEINLINE Double& eddyVisc() { return all(nDim+5); }
+  FORCEINLINE Double& thermalCond() { return all(nDim+6); }
+  FORCEINLINE Double& cp() { return all(nDim+7); }
+  FORCEINLINE const Double& laminarVisc() const { return all(nDim+4); }
+  FORCEINLINE const Double& eddyVisc() const { return all(nDim+5); }
+  FORCEINLINE const Double& thermalCond() const { return all(nDim+6); }
+  FORCEINLINE const Double& cp() const { return all(nDim+7); }
+
+  /*!
+   * \brief Enthalpy, the energy equation is solved for temperature with constant cp.
+   */
+  FORCEINLINE Double enthalpy() const { return cp() * temperature(); }
+};
+
+/*!
+ * \brief Primitive to conservative (density, momentum, rho*cp*T) conversion, incompressible flow.
+ */
+template<size_t nDim, size_t N>
+FORCEINLINE VectorDbl<nDim+2> incompressibleConservatives(const CIncompressiblePrimitives<nDim,N>& V) {
+  VectorDbl<nDim+2> U;
+  U(0) = V.density();
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    U(iDim+1) = V.density() * V.velocity(iDim);
+  }
+  U(nDim+1) = V.density() * V.enthalpy();
+  return U;
+}
+
 /*!
  * \brief Roe-averaged variables.
  */
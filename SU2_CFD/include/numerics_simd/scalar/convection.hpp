@@ -0,0 +1,211 @@
+/*!
+ * \file convection.hpp
+ * \brief Upwind convective scheme for scalar transport equations.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "diffusion.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief MUSCL reconstruction of scalar variables, optionally limited with a point-based limiter.
+ * \note Row-major access, the gradient of a single variable is stored as a vector.
+ */
+template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclScalar(Int iPoint,
+                             const VectorDbl<nDim>& vector_ij,
+                             Double scale,
+                             bool limited,
+                             const Limiter_t& limiter,
+                             const Gradient_t& gradient,
+                             VectorDbl<nVar>& vars) {
+  const auto grad = gatherVariables<nVar,nDim>(iPoint, gradient);
+  VectorDbl<nVar> lim;
+  if (limited) lim = gatherVariables<nVar>(iPoint, limiter);
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double proj = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      proj += grad.data()[iVar*nDim+iDim] * vector_ij(iDim);
+    }
+    if (limited) proj *= lim(iVar);
+    vars(iVar) += scale * proj;
+  }
+}
+
+/*!
+ * \class CUpwScalarScheme
+ * \ingroup ConvDiscr
+ * \brief First order upwind scheme for scalar transport equations (see CUpwScalar),
+ * with MUSCL reconstruction of the flow and scalar variables. The diffusive terms are
+ * added by Decorator, which also determines if the convected quantity is U or rho*U.
+ */
+template<class Decorator>
+class CUpwScalarScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::idx;
+  using Base::flowVars;
+  using Base::edgeFluxesDiff;
+  using typename Base::FlowPrimitives;
+
+  /*--- Velocity and density are all the flow primitives needed for convection. ---*/
+  static constexpr size_t nFlowVarRecon = nDim+3;
+
+  const bool dynamicGrid;
+  const bool musclFlow;
+  const bool reconFlowDensity;
+  const LIMITER typeLimiterFlow;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \param[in] flowPrimVarGrad - Number of flow primitives whose gradients are available for reconstruction.
+   */
+  template<class... Ts>
+  CUpwScalarScheme(const CConfig& config, int iMesh, unsigned short flowPrimVarGrad, Ts... args) :
+    Base(config, iMesh, args...),
+    dynamicGrid(config.GetDynamic_Grid()),
+    musclFlow(config.GetMUSCL_Flow() && config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND),
+    reconFlowDensity(flowPrimVarGrad >= nFlowVarRecon),
+    /*--- Only cell-based flow limiters, edge-based would need to be recomputed. ---*/
+    typeLimiterFlow(config.GetKind_SlopeLimit_Flow() == LIMITER::VAN_ALBADA_EDGE ?
+                    LIMITER::NONE : config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the upwind flux and of the diffusive flux of the decorator.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    /*--- MUSCL is set by the iteration for each solver. ---*/
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- First order flow primitives and scalars, the diffusive terms use these. ---*/
+
+    CPair<FlowPrimitives> V1st;
+    V1st.i.all = gatherVariables<FlowPrimitives::nVar>(iPoint, flowVars->GetPrimitive());
+    V1st.j.all = gatherVariables<FlowPrimitives::nVar>(jPoint, flowVars->GetPrimitive());
+
+    CPair<VectorDbl<nVar> > U1st;
+    U1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    U1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstructed flow primitives (velocity and density) and scalars. ---*/
+
+    CPair<FlowPrimitives> V = V1st;
+    if (muscl && musclFlow) {
+      const auto& gradients = flowVars->GetGradient_Reconstruction();
+      const auto& limiters = flowVars->GetLimiter_Primitive();
+      if (reconFlowDensity) {
+        musclReconstruction<nFlowVarRecon>(iPoint, jPoint, typeLimiterFlow, vector_ij, gradients, limiters, V);
+      } else {
+        musclReconstruction<nFlowVarRecon-1>(iPoint, jPoint, typeLimiterFlow, vector_ij, gradients, limiters, V);
+      }
+    }
+
+    CPair<VectorDbl<nVar> > U = U1st;
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      musclScalar(iPoint, vector_ij, 0.5, limiter, solution.GetLimiter(), gradients, U.i);
+      musclScalar(jPoint, vector_ij,-0.5, limiter, solution.GetLimiter(), gradients, U.j);
+    }
+
+    /*--- Face-normal velocity, relative to the grid if it moves. ---*/
+
+    Double projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projVel += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projVel -= 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                      dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double a0 = fmax(0.0, projVel);
+    const Double a1 = fmin(0.0, projVel);
+
+    /*--- Upwind flux, of U or rho*U, the Jacobians are w.r.t. the conservative variables. ---*/
+
+    Double rho_i = 1.0, rho_j = 1.0;
+    if (Base::densityWeighted) {
+      rho_i = V.i.density(idx);
+      rho_j = V.j.density(idx);
+    }
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * rho_i * U.i(iVar) + a1 * rho_j * U.j(iVar);
+    }
+    if (implicit) {
+      for (auto& x : jac_i) x = 0.0;
+      for (auto& x : jac_j) x = 0.0;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diagonal(jac_i, iVar) = a0;
+        diagonal(jac_j, iVar) = a1;
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    auto nonCons = Base::viscousTerms(iEdge, iPoint, jPoint, V1st, U1st, solution, normal,
+                                      vector_ij, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux, nonCons);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType, updateMask, flux,
+                       jac_i, jac_j, nonCons, edgeFluxesDiff, vector, matrix);
+  }
+};
@@ -0,0 +1,442 @@
+/*!
+ * \file diffusion.hpp
+ * \brief Decorator classes for the diffusive terms of scalar transport equations.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+
+/*!
+ * \brief Empty type returned by the diffusive terms of conservative closures.
+ */
+struct CConservativeTerms {};
+
+/*!
+ * \brief Non-conservative part of an edge contribution, i.e. what must be subtracted from the
+ * residual (flux_j) and Jacobian blocks ji and jj (jac_ji, jac_jj) of point j in addition to
+ * the conservative update of the edge flux.
+ */
+template<size_t nVar>
+struct CNonConservativeTerms {
+  VectorDbl<nVar> flux_j;
+  MatrixDbl<nVar> jac_ji, jac_jj;
+};
+
+/*!
+ * \brief Diagonal entry of a square block, also valid for 1x1 blocks (which are stored as vectors).
+ */
+template<size_t nVar>
+FORCEINLINE Double& diagonal(MatrixDbl<nVar>& block, size_t iVar) { return block.data()[iVar*(nVar+1)]; }
+
+/*!
+ * \brief Stop the AD preaccumulation, conservative closures.
+ */
+template<size_t nVar>
+FORCEINLINE void stopPreacc(VectorDbl<nVar>& flux, CConservativeTerms&) {
+  stopPreacc(flux);
+}
+
+/*!
+ * \brief Stop the AD preaccumulation, including the non-conservative flux.
+ */
+template<size_t nVar>
+FORCEINLINE void stopPreacc(VectorDbl<nVar>& flux, CNonConservativeTerms<nVar>& nonCons) {
+  AD::SetPreaccOut(nonCons.flux_j, nVar, Double::Size);
+  stopPreacc(flux);
+}
+
+/*!
+ * \brief Update the linear system, conservative closures.
+ */
+template<size_t nVar>
+FORCEINLINE void updateLinearSystem(Int iEdge, Int iPoint, Int jPoint, bool implicit, UpdateType updateType,
+                                    Double updateMask, const VectorDbl<nVar>& flux, const MatrixDbl<nVar>& jac_i,
+                                    const MatrixDbl<nVar>& jac_j, const CConservativeTerms&, CSysVector<su2double>*,
+                                    CSysVector<su2double>& vector, SparseMatrixType& matrix) {
+  updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType, updateMask, flux, jac_i, jac_j, vector, matrix);
+}
+
+/*!
+ * \brief Update the linear system with a non-conservative edge contribution.
+ * \note With the reducer strategy the non-conservative flux is stored separately (see
+ * CScalarSolver::SumEdgeFluxes) and, as in the scalar implementation, the off-diagonal
+ * Jacobian blocks are averaged.
+ */
+template<size_t nVar>
+FORCEINLINE void updateLinearSystem(Int iEdge, Int iPoint, Int jPoint, bool implicit, UpdateType updateType,
+                                    Double updateMask, const VectorDbl<nVar>& flux, MatrixDbl<nVar> jac_i,
+                                    MatrixDbl<nVar> jac_j, const CNonConservativeTerms<nVar>& nonCons,
+                                    CSysVector<su2double>* edgeFluxesDiff,
+                                    CSysVector<su2double>& vector, SparseMatrixType& matrix) {
+  if (updateType == UpdateType::REDUCTION) {
+    edgeFluxesDiff->SetBlock(iEdge, nonCons.flux_j, updateMask);
+    if (implicit) {
+      for (size_t k = 0; k < nVar*nVar; ++k) {
+        jac_i.data()[k] += 0.5 * nonCons.jac_ji.data()[k];
+        jac_j.data()[k] += 0.5 * nonCons.jac_jj.data()[k];
+      }
+    }
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType, updateMask, flux, jac_i, jac_j, vector, matrix);
+    return;
+  }
+
+  updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType, updateMask, flux, jac_i, jac_j, vector, matrix);
+
+  /*--- Handle SIMD dimensions 1 by 1, the Jacobian update above overwrites the ji block. ---*/
+  for (size_t k = 0; k < Double::Size; ++k) {
+    if (updateMask[k] == 0) continue;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      vector(jPoint[k], iVar) -= nonCons.flux_j(iVar)[k];
+    }
+  }
+  if (!implicit) return;
+
+  auto wasActive = AD::BeginPassive();
+  for (size_t k = 0; k < Double::Size; ++k) {
+    if (updateMask[k] == 0) continue;
+    decltype(matrix.GetBlock(0ul, 0ul)) bii, bij, bji, bjj;
+    matrix.GetBlocks(iEdge[k], iPoint[k], jPoint[k], bii, bij, bji, bjj);
+    for (size_t iVar = 0; iVar < nVar*nVar; ++iVar) {
+      bji[iVar] -= SU2_TYPE::GetValue(nonCons.jac_ji.data()[iVar][k]);
+      bjj[iVar] -= SU2_TYPE::GetValue(nonCons.jac_jj.data()[iVar][k]);
+    }
+  }
+  AD::EndPassive(wasActive);
+}
+
+/*!
+ * \brief Projected (on the normal) average gradient of scalar variables, corrected with the
+ * directional derivative along the edge, see CNumerics::ComputeProjectedGradient.
+ * \param[out] proj_vector_ij - (Edge vector DOT normal) / |edge vector|^2.
+ */
+template<size_t nVar, size_t nDim, class GradientType>
+FORCEINLINE VectorDbl<nVar> projectedScalarGradient(Int iPoint, Int jPoint,
+                                                    const VectorDbl<nDim>& normal,
+                                                    const VectorDbl<nDim>& vector_ij,
+                                                    const CPair<VectorDbl<nVar> >& U,
+                                                    const GradientType& gradient,
+                                                    Double& proj_vector_ij) {
+  proj_vector_ij = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+  /*--- Row-major access, the gradient of a single variable is stored as a vector. ---*/
+  const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+  const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+
+  VectorDbl<nVar> projGrad;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double projNormal = 0.0, projEdge = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double avgGrad = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+      projNormal += avgGrad * normal(iDim);
+      projEdge += avgGrad * vector_ij(iDim);
+    }
+    projGrad(iVar) = projNormal - (projEdge - (U.j(iVar) - U.i(iVar))) * proj_vector_ij;
+  }
+  return projGrad;
+}
+
+/*!
+ * \brief Type to store the flow primitives needed by scalar transport equations and access them by name.
+ */
+template<size_t nDim_, class FlowIndices>
+struct CScalarFlowPrimitives {
+  static constexpr size_t nDim = nDim_;
+  /*--- Enough for the viscosities of compressible and incompressible flows. ---*/
+  static constexpr size_t nVar = nDim+7;
+  VectorDbl<nVar> all;
+
+  FORCEINLINE Double& velocity(size_t iDim) { return all(iDim+1); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(iDim+1); }
+  FORCEINLINE const Double& pressure(const FlowIndices& idx) const { return all(idx.Pressure()); }
+  FORCEINLINE const Double& density(const FlowIndices& idx) const { return all(idx.Density()); }
+  FORCEINLINE const Double& soundSpeed(const FlowIndices& idx) const { return all(idx.SoundSpeed()); }
+  FORCEINLINE const Double& laminarVisc(const FlowIndices& idx) const { return all(idx.LaminarViscosity()); }
+  FORCEINLINE const Double& eddyVisc(const FlowIndices& idx) const { return all(idx.EddyViscosity()); }
+};
+
+/*!
+ * \class CScalarDiffusionBase
+ * \ingroup ViscDiscr
+ * \brief Base of the decorators that add the diffusive fluxes of scalar transport equations
+ * to the vectorized scalar upwind scheme (CUpwScalarScheme). Derived classes implement
+ * "viscousTerms", which returns the non-conservative part of the contribution, if any.
+ */
+template<size_t NDIM, size_t NVAR, class FlowIndices_>
+class CScalarDiffusionBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  using FlowIndices = FlowIndices_;
+  using FlowPrimitives = CScalarFlowPrimitives<nDim, FlowIndices>;
+
+  const FlowIndices idx;
+  const CFlowVariable* flowVars;
+  CSysVector<su2double>* edgeFluxesDiff;
+
+  /*!
+   * \brief Constructor, store the flow variables and the storage for non-conservative fluxes.
+   */
+  CScalarDiffusionBase(const CConfig& config, int, const CVariable* flowVars_, CSysVector<su2double>* edgeFluxesDiff_) :
+    idx(nDim, config.GetnSpecies()),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)),
+    edgeFluxesDiff(edgeFluxesDiff_) {
+  }
+};
+
+/*!
+ * \class CSADiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the Spalart-Allmaras model (see CAvgGrad_TurbSA and CAvgGrad_TurbSA_Neg).
+ * \note The quadratic term is discretized in non-conservative form, hence the fluxes
+ * leaving i and entering j differ, as in CTurbSASolver::Viscous_Residual.
+ */
+template<size_t NDIM, class FlowIndices, bool NEG>
+class CSADiffusion : public CScalarDiffusionBase<NDIM, 1, FlowIndices> {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, 1, FlowIndices>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::idx;
+  using typename Base::FlowPrimitives;
+  static constexpr bool densityWeighted = false;
+
+  static constexpr passivedouble sigma = 2.0/3.0;
+  static constexpr passivedouble cb2 = 0.622;
+  static constexpr passivedouble cn1 = 16.0;
+
+  const bool useAccurateJacobians;
+
+  template<class... Ts>
+  CSADiffusion(const CConfig& config, int iMesh, Ts... args) :
+    Base(config, iMesh, args...),
+    useAccurateJacobians(!NEG && config.GetUse_Accurate_Turb_Jacobians()) {
+  }
+
+  /*!
+   * \brief Diffusion coefficient of the flux evaluated on the side of "nu_tilde_1".
+   */
+  FORCEINLINE Double diffusionCoeff(Double nu_ij, Double nu_tilde_ij, Double nu_tilde_1) const {
+    if (NEG) {
+      /*--- Diskin's fn function (10.2514/1.J064629) to keep the coefficient positive. ---*/
+      const Double zeta = ((1 + cb2) * nu_tilde_ij - cb2 * nu_tilde_1) / nu_ij;
+      const Double zeta3 = pow(zeta, 3);
+      const Double neg = zeta < 0.0;
+      const Double fn = neg * (cn1 + zeta3) / (cn1 - zeta3) + (1 - neg);
+      return nu_ij + (1 + cb2) * nu_tilde_ij * fn - cb2 * nu_tilde_1 * fn;
+    }
+    return nu_ij + (1 + cb2) * nu_tilde_ij - cb2 * nu_tilde_1;
+  }
+
+  /*!
+   * \brief Add the diffusive flux and Jacobians, return the non-conservative part.
+   */
+  template<class VariableType>
+  FORCEINLINE CNonConservativeTerms<nVar> viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                                       const CPair<FlowPrimitives>& V,
+                                                       const CPair<VectorDbl<nVar> >& U,
+                                                       const VariableType& solution,
+                                                       const VectorDbl<nDim>& normal,
+                                                       const VectorDbl<nDim>& vector_ij,
+                                                       bool implicit,
+                                                       VectorDbl<nVar>& flux,
+                                                       MatrixDbl<nVar>& jac_i,
+                                                       MatrixDbl<nVar>& jac_j) const {
+    Double proj_vector_ij;
+    const auto projGrad = projectedScalarGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                  solution.GetGradient(), proj_vector_ij);
+
+    const Double nu_ij = 0.5 * (V.i.laminarVisc(idx) / V.i.density(idx) + V.j.laminarVisc(idx) / V.j.density(idx));
+    const Double nu_tilde_ij = 0.5 * (U.i(0) + U.j(0));
+
+    /*--- Coefficients of the fluxes i->j and j->i, the latter is computed with the flipped
+     *    normal, therefore its projected gradient is -projGrad. ---*/
+    const Double coeff_i = diffusionCoeff(nu_ij, nu_tilde_ij, U.i(0)) / sigma;
+    const Double coeff_j = diffusionCoeff(nu_ij, nu_tilde_ij, U.j(0)) / sigma;
+
+    flux(0) -= coeff_i * projGrad(0);
+
+    CNonConservativeTerms<nVar> nonCons;
+    nonCons.flux_j(0) = (coeff_i - coeff_j) * projGrad(0);
+
+    if (implicit) {
+      /*--- Jacobians of the i->j (a_i, b_i) and j->i (a_j, b_j) fluxes w.r.t. their first and second points. ---*/
+      Double a_i = -coeff_i * proj_vector_ij, b_i = coeff_i * proj_vector_ij;
+      Double a_j = -coeff_j * proj_vector_ij, b_j = coeff_j * proj_vector_ij;
+
+      if (useAccurateJacobians) {
+        /*--- The diffusion coefficient is also a function of nu_tilde. ---*/
+        const Double dCoeff_self = (0.5 * (1 + cb2) - cb2) / sigma;
+        const Double dCoeff_other = 0.5 * (1 + cb2) / sigma;
+        a_i += dCoeff_self * projGrad(0);
+        b_i += dCoeff_other * projGrad(0);
+        a_j -= dCoeff_self * projGrad(0);
+        b_j -= dCoeff_other * projGrad(0);
+      }
+      diagonal(jac_i, 0) -= a_i;
+      diagonal(jac_j, 0) -= b_i;
+      diagonal(nonCons.jac_ji, 0) = a_i + b_j;
+      diagonal(nonCons.jac_jj, 0) = a_j + b_i;
+    }
+    return nonCons;
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the SST model with blended constants (see CAvgGrad_TurbSST).
+ */
+template<size_t NDIM, class FlowIndices>
+class CSSTDiffusion : public CScalarDiffusionBase<NDIM, 2, FlowIndices> {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, 2, FlowIndices>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::idx;
+  using typename Base::FlowPrimitives;
+  static constexpr bool densityWeighted = true;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  template<class... Ts>
+  CSSTDiffusion(const CConfig& config, int iMesh, const su2double* constants, Ts... args) :
+    Base(config, iMesh, args...),
+    sigma_k1(constants[0]), sigma_k2(constants[1]), sigma_om1(constants[2]), sigma_om2(constants[3]) {
+  }
+
+  /*!
+   * \brief Add the diffusive flux and Jacobians.
+   */
+  template<class VariableType>
+  FORCEINLINE CConservativeTerms viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                              const CPair<FlowPrimitives>& V,
+                                              const CPair<VectorDbl<nVar> >& U,
+                                              const VariableType& solution_,
+                                              const VectorDbl<nDim>& normal,
+                                              const VectorDbl<nDim>& vector_ij,
+                                              bool implicit,
+                                              VectorDbl<nVar>& flux,
+                                              MatrixDbl<nVar>& jac_i,
+                                              MatrixDbl<nVar>& jac_j) const {
+    const auto& solution = static_cast<const CTurbSSTVariable&>(solution_);
+
+    Double proj_vector_ij;
+    const auto projGrad = projectedScalarGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                  solution.GetGradient(), proj_vector_ij);
+
+    /*--- Blended constants and mean effective viscosities. ---*/
+    const Double F1_i = gatherVariables(iPoint, solution.GetF1blending());
+    const Double F1_j = gatherVariables(jPoint, solution.GetF1blending());
+
+    const Double diff_kine = 0.5 * (V.i.laminarVisc(idx) + (F1_i*sigma_k1 + (1-F1_i)*sigma_k2) * V.i.eddyVisc(idx) +
+                                    V.j.laminarVisc(idx) + (F1_j*sigma_k1 + (1-F1_j)*sigma_k2) * V.j.eddyVisc(idx));
+    const Double diff_omega = 0.5 * (V.i.laminarVisc(idx) + (F1_i*sigma_om1 + (1-F1_i)*sigma_om2) * V.i.eddyVisc(idx) +
+                                     V.j.laminarVisc(idx) + (F1_j*sigma_om1 + (1-F1_j)*sigma_om2) * V.j.eddyVisc(idx));
+
+    flux(0) -= diff_kine * projGrad(0);
+    flux(1) -= diff_omega * projGrad(1);
+
+    if (implicit) {
+      const Double proj_on_rho_i = proj_vector_ij / V.i.density(idx);
+      const Double proj_on_rho_j = proj_vector_ij / V.j.density(idx);
+      diagonal(jac_i, 0) += diff_kine * proj_on_rho_i;
+      diagonal(jac_i, 1) += diff_omega * proj_on_rho_i;
+      diagonal(jac_j, 0) -= diff_kine * proj_on_rho_j;
+      diagonal(jac_j, 1) -= diff_omega * proj_on_rho_j;
+    }
+    return {};
+  }
+};
+
+/*!
+ * \class CSpeciesDiffusion
+ * \ingroup ViscDiscr
+ * \brief Fickian diffusion of species mass fractions (see CAvgGrad_Species).
+ */
+template<size_t NDIM, size_t NVAR, class FlowIndices>
+class CSpeciesDiffusion : public CScalarDiffusionBase<NDIM, NVAR, FlowIndices> {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, NVAR, FlowIndices>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::idx;
+  using typename Base::FlowPrimitives;
+  static constexpr bool densityWeighted = true;
+
+  const bool turbulence;
+  const su2double schmidtTurb;
+
+  template<class... Ts>
+  CSpeciesDiffusion(const CConfig& config, int iMesh, Ts... args) :
+    Base(config, iMesh, args...),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    schmidtTurb(config.GetSchmidt_Number_Turbulent()) {
+  }
+
+  /*!
+   * \brief Add the diffusive flux and Jacobians.
+   */
+  template<class VariableType>
+  FORCEINLINE CConservativeTerms viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                              const CPair<FlowPrimitives>& V,
+                                              const CPair<VectorDbl<nVar> >& U,
+                                              const VariableType& solution_,
+                                              const VectorDbl<nDim>& normal,
+                                              const VectorDbl<nDim>& vector_ij,
+                                              bool implicit,
+                                              VectorDbl<nVar>& flux,
+                                              MatrixDbl<nVar>& jac_i,
+                                              MatrixDbl<nVar>& jac_j) const {
+    const auto& solution = static_cast<const CSpeciesVariable&>(solution_);
+
+    Double proj_vector_ij;
+    const auto projGrad = projectedScalarGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                  solution.GetGradient(), proj_vector_ij);
+
+    const auto diff_i = gatherVariables<nVar>(iPoint, solution.GetDiffusivity());
+    const auto diff_j = gatherVariables<nVar>(jPoint, solution.GetDiffusivity());
+
+    Double diffTurb = 0.0;
+    if (turbulence) diffTurb = 0.5 * (V.i.eddyVisc(idx) + V.j.eddyVisc(idx)) / schmidtTurb;
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density(idx);
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density(idx);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diffusivity = 0.5 * (V.i.density(idx) * diff_i(iVar) + V.j.density(idx) * diff_j(iVar)) + diffTurb;
+      flux(iVar) -= diffusivity * projGrad(iVar);
+
+      if (implicit) {
+        diagonal(jac_i, iVar) += diffusivity * proj_on_rho_i;
+        diagonal(jac_j, iVar) -= diffusivity * proj_on_rho_j;
+      }
+    }
+    return {};
+  }
+};
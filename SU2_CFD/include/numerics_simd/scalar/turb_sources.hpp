@@ -0,0 +1,406 @@
+/*!
+ * \file turb_sources.hpp
+ * \brief Vectorized source terms of the SA and SST turbulence models.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "diffusion.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CTurbSourceBase
+ * \ingroup SourceDiscr
+ * \brief Common members of the vectorized turbulence source terms.
+ */
+template<size_t NDIM, class FlowIndices>
+class CTurbSourceBase : public CSourceNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  using FlowPrimitives = CScalarFlowPrimitives<nDim, FlowIndices>;
+
+  const FlowIndices idx;
+  const CFlowVariable* flowVars;
+
+  CTurbSourceBase(const CConfig& config, const CVariable* flowVars_) :
+    idx(nDim, config.GetnSpecies()),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)) {
+  }
+
+  /*!
+   * \brief Gather the velocity gradient.
+   */
+  FORCEINLINE MatrixDbl<nDim> velocityGradient(Int iPoint) const {
+    const auto grad = gatherVariables<nDim+1,nDim>(iPoint, flowVars->GetGradient_Primitive());
+    MatrixDbl<nDim> velGrad;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        velGrad(iDim,jDim) = grad(idx.Velocity()+iDim, jDim);
+    return velGrad;
+  }
+};
+
+/*!
+ * \class CSASource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Spalart-Allmaras model (see CSourceBase_TurbSA), the version (baseline,
+ * negative, Edwards), ft2 term, and compressibility correction are template parameters.
+ * \note Branches of the scalar implementation are evaluated for all lanes and then blended.
+ */
+template<size_t NDIM, class FlowIndices, SA_OPTIONS VERSION, bool FT2, bool COMP>
+class CSASource final : public CTurbSourceBase<NDIM, FlowIndices> {
+private:
+  using Base = CTurbSourceBase<NDIM, FlowIndices>;
+  using Base::nDim;
+  using Base::idx;
+  using Base::flowVars;
+  using typename Base::FlowPrimitives;
+
+  static constexpr bool NEG = (VERSION == SA_OPTIONS::NEG);
+  static constexpr bool EDW = (VERSION == SA_OPTIONS::EDW);
+
+  /*--- Constants of the model, see CSAVariables. ---*/
+  static constexpr passivedouble cv1_3 = 7.1 * 7.1 * 7.1;
+  static constexpr passivedouble k2 = 0.41 * 0.41;
+  static constexpr passivedouble cb1 = 0.1355;
+  static constexpr passivedouble cw2 = 0.3;
+  static constexpr passivedouble ct3 = 1.2;
+  static constexpr passivedouble ct4 = 0.5;
+  static constexpr passivedouble cw3_6 = 64.0;
+  static constexpr passivedouble sigma = 2.0 / 3.0;
+  static constexpr passivedouble cb2 = 0.622;
+  static constexpr passivedouble cw1 = cb1 / k2 + (1 + cb2) / sigma;
+  static constexpr passivedouble cr1 = 0.5;
+  static constexpr passivedouble CRot = 2.0;
+  static constexpr passivedouble c2 = 0.7, c3 = 0.9;
+  static constexpr passivedouble c5 = 3.5;
+
+  const bool rotation;
+  const su2double gamma;
+
+public:
+  CSASource(const CConfig& config, const CVariable* flowVars) :
+    Base(config, flowVars),
+    rotation(config.GetSAParsedOptions().rot),
+    gamma(config.GetGamma()) {
+  }
+
+  void ComputeResidual(Int iPoint,
+                       const CConfig& config,
+                       const CGeometry& geometry,
+                       const CVariable& solution,
+                       Double updateMask,
+                       CSysVector<su2double>& vector,
+                       SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    FlowPrimitives V;
+    V.all = gatherVariables<FlowPrimitives::nVar>(iPoint, flowVars->GetPrimitive());
+    const Double nue = gatherVariables<1>(iPoint, solution.GetSolution())(0);
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+
+    /*--- Wall roughness is accounted for by modifying the wall distance, d_new = d + 0.03 k_s. ---*/
+    const Double roughness = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+    const Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) + 0.03 * roughness;
+
+    MatrixDbl<nDim> velGrad;
+    if (EDW || COMP) velGrad = Base::velocityGradient(iPoint);
+
+    const Double density = V.density(idx);
+    const Double nu = V.laminarVisc(idx) / density;
+
+    /*--- There is no source at (or very near) the wall, use a benign distance for those lanes. ---*/
+    const Double active = dist > 1e-10;
+    const Double dist_i = active * dist + (1 - active);
+    const Double dist_i_2 = dist_i * dist_i;
+    const Double inv_k2_d2 = 1 / (k2 * dist_i_2);
+
+    const Double Ji = nue / nu + cr1 * (roughness / (dist_i + EPS));
+    const Double d_Ji = 1 / nu;
+    const Double Ji_2 = Ji * Ji;
+    const Double Ji_3 = Ji_2 * Ji;
+
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    const Double d_fv1 = 3 * Ji_2 * cv1_3 / (nu * pow(Ji_3 + cv1_3, 2));
+    const Double fv2 = 1 - nue / (nu + nue * fv1);
+    const Double d_fv2 = -(1 / nu - Ji_2 * d_fv1) / pow(1 + Ji * fv1, 2);
+
+    /*--- Omega (vorticity magnitude, or strain rate for Edwards). ---*/
+
+    Double Omega;
+    if (EDW) {
+      Double Sbar = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          Sbar += (velGrad(iDim,jDim) + velGrad(jDim,iDim)) * velGrad(iDim,jDim);
+        }
+        Sbar -= (2.0 / 3.0) * pow(velGrad(iDim,iDim), 2);
+      }
+      Omega = sqrt(fmax(Sbar, 0.0));
+    } else {
+      Omega = sqrt(squaredNorm<3>(gatherVariables<3>(iPoint, flowVars->GetVorticity())));
+    }
+
+    /*--- Modified vorticity. ---*/
+
+    Double Shat, d_Shat;
+    if (EDW) {
+      Shat = fmax(Omega * (1 / fmax(Ji, 1e-16) + fv1), 1e-10);
+      const Double notLim = Shat > 1e-10;
+      /*--- Ji^2 is offset in limited lanes, where the derivative is zero anyway. ---*/
+      d_Shat = notLim * Omega * (d_fv1 - 1 / ((Ji_2 + 1 - notLim) * nu));
+    } else {
+      const Double Sbar = nue * fv2 * inv_k2_d2;
+      const Double d_Sbar = (fv2 + nue * d_fv2) * inv_k2_d2;
+      const Double noLim = Sbar >= -c2 * Omega;
+      const Double num = Omega * (c2 * c2 * Omega + c3 * Sbar);
+      const Double den = noLim + (1 - noLim) * ((c3 - 2 * c2) * Omega - Sbar);
+      Shat = Omega + noLim * Sbar + (1 - noLim) * num / den;
+      d_Shat = d_Sbar * (noLim + (1 - noLim) * (c3 * Omega + num / den) / den);
+      d_Shat *= (Shat > 1e-10);
+      Shat = fmax(Shat, 1e-10);
+    }
+
+    /*--- For SA-neg the baseline branch is only used for positive nue. ---*/
+    const Double pos = nue > 0.0;
+    const Double Shat_bsl = Shat;
+    if (NEG) {
+      Shat = pos * Shat + (1 - pos) * Omega;
+      d_Shat *= pos;
+    }
+
+    /*--- Dacles-Mariani et. al. rotation correction ("-R"). ---*/
+    Double Prod = Shat;
+    if (rotation) {
+      Prod += CRot * fmin(0.0, gatherVariables(iPoint, flowVars->GetStrainMag()) - Omega);
+      /*--- Do not allow negative production for SA-neg. ---*/
+      const Double neg = nue < 0.0;
+      Prod = neg * abs(Prod) + (1 - neg) * Prod;
+    }
+
+    /*--- ft2 term. ---*/
+    Double ft2 = 0.0, d_ft2 = 0.0;
+    if (FT2) {
+      ft2 = ct3 * exp(-ct4 * Ji_2);
+      d_ft2 = -2 * ct4 * Ji * ft2 * d_Ji;
+    }
+
+    /*--- Auxiliary function r, the baseline Shat keeps it finite where it is not used (SA-neg). ---*/
+    const Double inv_Shat = 1 / Shat_bsl;
+    Double r = fmin(nue * inv_Shat * inv_k2_d2, 10.0);
+    Double d_r = (Shat - nue * d_Shat) * pow(inv_Shat, 2) * inv_k2_d2;
+    if (EDW) {
+      r = tanh(r) / std::tanh(1.0);
+      d_r = (1 - pow(tanh(r), 2)) * d_r / std::tanh(1.0);
+    } else {
+      d_r *= (r < 10.0);
+    }
+
+    const Double g = r + cw2 * (pow(r, 6) - r);
+    const Double g_6 = pow(g, 6);
+    const Double glim = pow((1 + cw3_6) / (g_6 + cw3_6), 1.0 / 6.0);
+    const Double fw = g * glim;
+    const Double d_g = d_r * (1 + cw2 * (6 * pow(r, 5) - 1));
+    const Double d_fw = d_g * glim * (1 - g_6 / (g_6 + cw3_6));
+
+    /*--- Production, destruction, and their derivative w.r.t. nue. ---*/
+
+    const Double nue_2 = nue * nue;
+    Double production = cb1 * (1 - ft2) * Prod * nue;
+    Double jacobian = cb1 * (-Prod * nue * d_ft2 + (1 - ft2) * (nue * d_Shat + Prod));
+
+    constexpr passivedouble cb1_k2 = cb1 / k2;
+    const Double factor = cw1 * fw - cb1_k2 * ft2;
+    Double destruction = factor * nue_2 / dist_i_2;
+    jacobian -= ((cw1 * d_fw - cb1_k2 * d_ft2) * nue_2 + factor * 2 * nue) / dist_i_2;
+
+    if (NEG) {
+      /*--- The destruction when nue < 0 is added instead of the usual subtraction. ---*/
+      const Double dP_dnu = cb1 * (1 - ct3) * Prod;
+      const Double dD_dnu = -cw1 * nue / dist_i_2;
+      production = pos * production + (1 - pos) * dP_dnu * nue;
+      destruction = pos * destruction + (1 - pos) * dD_dnu * nue;
+      jacobian = pos * jacobian + (1 - pos) * (dP_dnu - 2 * dD_dnu);
+    }
+
+    VectorDbl<1> residual;
+    MatrixDbl<1> jac;
+    residual(0) = active * (production - destruction) * volume;
+    diagonal(jac, 0) = active * jacobian * volume;
+
+    /*--- Mixing layer compressibility correction (SA-comp). ---*/
+    if (COMP) {
+      Double aux_cc = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          aux_cc += pow(velGrad(iDim,jDim), 2);
+      const Double soundSpeed2 = V.pressure(idx) * gamma / density;
+      const Double d_CompCorrection = 2.0 * c5 * nue / soundSpeed2 * aux_cc * volume;
+      residual(0) -= 0.5 * nue * d_CompCorrection;
+      diagonal(jac, 0) -= d_CompCorrection;
+    }
+
+    stopPreacc(residual);
+
+    updateLinearSystem(iPoint, implicit, updateMask, residual, jac, vector, matrix);
+  }
+};
+
+/*!
+ * \class CSSTSource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Menter SST model (see CSourcePieceWise_TurbSST), the version (1994 or 2003)
+ * and the production term modification are template parameters.
+ */
+template<size_t NDIM, class FlowIndices, SST_OPTIONS VERSION, SST_OPTIONS PRODUCTION>
+class CSSTSource final : public CTurbSourceBase<NDIM, FlowIndices> {
+private:
+  using Base = CTurbSourceBase<NDIM, FlowIndices>;
+  using Base::nDim;
+  using Base::idx;
+  using Base::flowVars;
+  using typename Base::FlowPrimitives;
+
+  static constexpr bool COMP = (PRODUCTION == SST_OPTIONS::COMP_Wilcox) || (PRODUCTION == SST_OPTIONS::COMP_Sarkar);
+
+  /*--- Closure constants. ---*/
+  const su2double beta_1, beta_2, beta_star, alfa_1, alfa_2, prod_lim_const;
+
+  /*--- Ambient values for SST-SUST. ---*/
+  const bool sustaining;
+  const su2double kAmb, omegaAmb;
+
+public:
+  CSSTSource(const CConfig& config, const CVariable* flowVars, const su2double* constants,
+             su2double kineInf, su2double omegaInf) :
+    Base(config, flowVars),
+    beta_1(constants[4]),
+    beta_2(constants[5]),
+    beta_star(constants[6]),
+    alfa_1(constants[8]),
+    alfa_2(constants[9]),
+    prod_lim_const(constants[10]),
+    sustaining(config.GetSSTParsedOptions().sust),
+    kAmb(kineInf),
+    omegaAmb(omegaInf) {
+  }
+
+  void ComputeResidual(Int iPoint,
+                       const CConfig& config,
+                       const CGeometry& geometry,
+                       const CVariable& solution,
+                       Double updateMask,
+                       CSysVector<su2double>& vector,
+                       SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& turbVars = static_cast<const CTurbSSTVariable&>(solution);
+
+    FlowPrimitives V;
+    V.all = gatherVariables<FlowPrimitives::nVar>(iPoint, flowVars->GetPrimitive());
+    const auto U = gatherVariables<2>(iPoint, turbVars.GetSolution());
+    const Double F1 = gatherVariables(iPoint, turbVars.GetF1blending());
+    const Double CDkw = gatherVariables(iPoint, turbVars.GetCrossDiff());
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance());
+
+    const Double density = V.density(idx);
+    const Double eddyVisc = V.eddyVisc(idx);
+    const Double k = U(0), omega = U(1);
+
+    /*--- Blended constants. ---*/
+    const Double alfa_blended = F1 * alfa_1 + (1 - F1) * alfa_2;
+    const Double beta_blended = F1 * beta_1 + (1 - F1) * beta_2;
+
+    /*--- Base production term and compressibility corrections. ---*/
+
+    Double P_Base, zetaFMt = 0.0, Mt = 0.0;
+    if (COMP) Mt = sqrt(2 * fmax(k, 0.0)) / V.soundSpeed(idx);
+
+    if (PRODUCTION == SST_OPTIONS::V || PRODUCTION == SST_OPTIONS::KL) {
+      const Double vorticityMag = sqrt(squaredNorm<3>(gatherVariables<3>(iPoint, flowVars->GetVorticity())));
+      if (PRODUCTION == SST_OPTIONS::V) {
+        P_Base = vorticityMag;
+      } else {
+        P_Base = sqrt(gatherVariables(iPoint, flowVars->GetStrainMag()) * vorticityMag);
+      }
+    } else {
+      P_Base = gatherVariables(iPoint, flowVars->GetStrainMag());
+      if (PRODUCTION == SST_OPTIONS::COMP_Wilcox) zetaFMt = (Mt >= 0.25) * 2 * (Mt * Mt - 0.25 * 0.25);
+      if (PRODUCTION == SST_OPTIONS::COMP_Sarkar) zetaFMt = (Mt >= 0.25) * 0.5 * Mt * Mt;
+    }
+
+    /*--- Production with limiter, only for V2003 in the omega equation. ---*/
+
+    const Double prod_limit = prod_lim_const * beta_star * density * omega * k;
+    Double pk = fmax(0.0, fmin(eddyVisc * pow(P_Base, 2), prod_limit));
+
+    Double pw;
+    if (VERSION == SST_OPTIONS::V1994) {
+      pw = alfa_blended * density * pow(P_Base, 2);
+    } else {
+      pw = (alfa_blended * density / eddyVisc) * pk;
+    }
+
+    /*--- Sustaining terms, the maximum is used rather than adding them (see CSourcePieceWise_TurbSST). ---*/
+    if (sustaining) {
+      pk = fmax(pk, beta_star * density * kAmb * omegaAmb);
+      pw = fmax(pw, beta_blended * density * omegaAmb * omegaAmb);
+    }
+
+    if (PRODUCTION == SST_OPTIONS::COMP_Sarkar) {
+      pk += -0.15 * pk * Mt + 0.2 * beta_star * (1 + zetaFMt) * density * omega * k * Mt * Mt;
+    }
+
+    /*--- Dissipation. ---*/
+    const Double dk = beta_star * density * omega * k * (1 + zetaFMt);
+    const Double dw = beta_blended * density * omega * omega * (1 - 0.09 / beta_blended * zetaFMt);
+
+    VectorDbl<2> residual;
+    residual(0) = (pk - dk) * volume;
+    residual(1) = (pw - dw + (1 - F1) * CDkw) * volume;
+
+    MatrixDbl<2> jac;
+    jac(0,0) = -beta_star * omega * volume * (1 + zetaFMt);
+    jac(0,1) = -beta_star * k * volume * (1 + zetaFMt);
+    jac(1,0) = 0.0;
+    jac(1,1) = -2 * beta_blended * omega * volume * (1 - 0.09 / beta_blended * zetaFMt);
+
+    stopPreacc(residual);
+
+    /*--- There is no source at (or very near) the wall. ---*/
+    const Double mask = updateMask * (dist > 1e-10);
+
+    updateLinearSystem(iPoint, implicit, mask, residual, jac, vector, matrix);
+  }
+};
@@ -261,3 +261,23 @@ FORCEINLINE void updateLinearSystem(Int iEdge,
     }
   }
 }
+
+/*!
+ * \overload Update of the linear system with point contributions (e.g. source terms), which
+ * are subtracted from the right-hand-side and from the diagonal blocks of the matrix.
+ */
+template<size_t nVar>
+FORCEINLINE void updateLinearSystem(Int iPoint,
+                                    bool implicit,
+                                    Double updateMask,
+                                    const VectorDbl<nVar>& residual,
+                                    const MatrixDbl<nVar>& jacobian,
+                                    CSysVector<su2double>& vector,
+                                    SparseMatrixType& matrix) {
+  vector.AddBlock(iPoint, residual, -updateMask);
+  if(implicit) {
+    auto wasActive = AD::BeginPassive();
+    matrix.AddBlock2Diag(iPoint, jacobian, -updateMask);
+    AD::EndPassive(wasActive);
+  }
+}
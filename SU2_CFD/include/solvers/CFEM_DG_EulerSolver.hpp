@@ -39,11 +39,12 @@
  */
 class CFEM_DG_EulerSolver : public CSolver {
 protected:
+  enum : size_t {OMP_ELEM_SIZE = 4}; /*!< \brief Chunk size for loops over elements with a lot of work per element. */
 
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one per OpenMP thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -199,6 +200,11 @@ protected:
                                                          level. Cumulative storage. */
   vector<unsigned long> entriesResAdjFaces;  /*!< \brief The corresponding entries in the residual of the faces. */
 
+  vector<unsigned long> prefixResInternalFaces;           /*!< \brief Number of DOFs in the residual of the internal matching
+                                                                      faces. Cumulative storage. */
+  vector<vector<unsigned long> > prefixResBoundaryFaces;  /*!< \brief Number of DOFs in the residual of the surface elements
+                                                                      of each boundary marker. Cumulative storage. */
+
   vector<vector<unsigned long> > startLocResFacesMarkers; /*!< \brief The starting location in the residual of the
                                                                       faces for the time levels of the boundary
                                                                       markers. */
@@ -324,7 +330,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -584,6 +590,32 @@ public:
                              CNumerics           *numerics,
                              su2double           *workArray);
 
+  /*!
+   * \brief Function, which determines the number of DOFs stored in the vector of
+            face residuals for the given range of internal matching faces.
+   * \param[in] indFaceBeg - Starting index in the matching faces.
+   * \param[in] indFaceEnd - End index (not included) in the matching faces.
+   * \return The number of DOFs in the face residuals for this range of faces.
+   */
+  inline unsigned long SizeResidualInternalFaces(const unsigned long indFaceBeg,
+                                                 const unsigned long indFaceEnd) const {
+    return prefixResInternalFaces[indFaceEnd] - prefixResInternalFaces[indFaceBeg];
+  }
+
+  /*!
+   * \brief Function, which determines the number of DOFs stored in the vector of
+            face residuals for the given range of boundary faces.
+   * \param[in] iMarker     - Boundary marker of the surface elements.
+   * \param[in] surfElemBeg - Starting index in the surface elements.
+   * \param[in] surfElemEnd - End index (not included) in the surface elements.
+   * \return The number of DOFs in the face residuals for this range of faces.
+   */
+  inline unsigned long SizeResidualBoundaryFaces(const unsigned short iMarker,
+                                                 const unsigned long  surfElemBeg,
+                                                 const unsigned long  surfElemEnd) const {
+    return prefixResBoundaryFaces[iMarker][surfElemEnd] - prefixResBoundaryFaces[iMarker][surfElemBeg];
+  }
+
   /*!
    * \brief Function, which accumulates the space time residual of the ADER-DG
             time integration scheme for the owned elements.
@@ -1633,6 +1665,31 @@ private:
                                     unsigned long            &indResFaces);
 
 protected:
+  /*!
+   * \brief Function, which determines the contiguous part of the range of elements/faces,
+            which must be treated by the calling OpenMP thread. The range is split in
+            blocks of nElemSimul entities, such that the thread partitioning does not
+            break up the chunks that are treated simultaneously in the matrix products.
+   * \param[in]  rangeBeg   - Start index of the entire range.
+   * \param[in]  rangeEnd   - End index (not included) of the entire range.
+   * \param[in]  nElemSimul - Desired number of elements/faces that must be treated
+                              simultaneously for optimal performance.
+   * \param[out] threadBeg  - Start index of the range of this thread.
+   * \param[out] threadEnd  - End index (not included) of the range of this thread.
+   */
+  static void ThreadRangeOfElem(const unsigned long  rangeBeg,
+                                const unsigned long  rangeEnd,
+                                const unsigned short nElemSimul,
+                                unsigned long        &threadBeg,
+                                unsigned long        &threadEnd) {
+
+    const unsigned long nBlocks          = roundUpDiv(rangeEnd-rangeBeg, nElemSimul);
+    const unsigned long nBlocksPerThread = roundUpDiv(nBlocks, omp_get_num_threads());
+
+    threadBeg = min(rangeEnd, rangeBeg  + omp_get_thread_num()*nBlocksPerThread*nElemSimul);
+    threadEnd = min(rangeEnd, threadBeg + nBlocksPerThread*nElemSimul);
+  }
+
   /*!
    * \brief Template function, which determines some meta data for the chunk of
             elements/faces that must be treated simulaneously.
@@ -204,6 +204,12 @@ class CFVMFlowSolverBase : public CSolver {
   static constexpr bool ReducerStrategy = false;
 #endif
 
+  /*--- Edge colors split into the groups of edges between domain points, computed while a deferred
+   *    halo exchange is in flight, and the groups that touch halo points, computed after it. ---*/
+
+  vector<unsigned long> OverlapEdges;  /*!< \brief Indices of the edges of both splits, color by color. */
+  vector<GridColor<> > EdgeColoringInterior, EdgeColoringHalo;
+
   /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids.
    * We first store the fluxes and then compute the sum for each cell.
    * This strategy is thread-safe but lower performance than writting to both
@@ -268,10 +274,17 @@ class CFVMFlowSolverBase : public CSolver {
    */
   su2double EvaluateCommonObjFunc(const CConfig& config) const;
 
+  /*!
+   * \brief Split the edge colors into interior and halo groups (EdgeColoringInterior and EdgeColoringHalo).
+   */
+  void SetEdgeColoringOverlap(const CGeometry& geometry);
+
   /*!
    * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
+   * \note If the halo exchange of the limiters is deferred (COMM_OVERLAP, see SetPrimitive_Limiter), the edges
+   *       between domain points are computed first, and the exchange is completed before the other edges.
    */
-  void EdgeFluxResidual(const CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
@@ -1063,11 +1076,22 @@ class CFVMFlowSolverBase : public CSolver {
 
   /*!
    * \brief Compute the limiter of the primitive variables.
+   * \note With COMM_OVERLAP and vectorized edge fluxes, the halo exchange is completed by EdgeFluxResidual.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the reconstruction gradient of the primitive variables using the Green-Gauss method,
+   *        and their limiters, in a single pass over the mesh and with a single MPI exchange.
+   * \note Falls back to separate computations if there are periodic boundaries. The exchange is deferred as in
+   *       SetPrimitive_Limiter if the reconstruction gradient is separate from the primitive one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_GG_Limiter(CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
@@ -423,10 +423,35 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  /*--- The limiters of halo points are only used by the vectorized edge loop, which completes their exchange. ---*/
+  if (edgeNumerics && geometry->GetCommOverlap()) DeferNextComms(MPI_QUANTITIES::PRIMITIVE_LIMITER);
+
   computeLimiters(kindLimiter, this, MPI_QUANTITIES::PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG_Limiter(CGeometry* geometry, const CConfig* config) {
+  if (config->GetnMarker_Periodic() > 0) {
+    SetPrimitive_Gradient_GG(geometry, config, true);
+    SetPrimitive_Limiter(geometry, config);
+    return;
+  }
+  const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = nodes->GetGradient_Reconstruction();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  /*--- Same as SetPrimitive_Limiter, if the gradient is not the primitive gradient used by other routines. ---*/
+  if (edgeNumerics && geometry->GetCommOverlap() && config->GetReconstructionGradientRequired())
+    DeferNextComms(MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER);
+
+  computeGradientsLimitersGreenGauss(kindLimiter, this, MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER, *geometry, *config, 0,
+                                     nPrimVarGrad, prim_idx.Velocity(), primitives, gradient, primMin, primMax, limiter);
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                                      CNumerics *numerics, CConfig *config) {
@@ -1512,7 +1537,58 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
+void CFVMFlowSolverBase<V, R>::SetEdgeColoringOverlap(const CGeometry& geometry) {
+
+  const auto nPointDomain = geometry.GetnPointDomain();
+  const auto nColor = EdgeColoring.size();
+
+  /*--- The edges of a group are computed by the same thread (they may share points), and the
+   *    SIMD version of CEdge::GetNode expects packs of consecutive edges. Hence the colors are
+   *    split in blocks of whole groups and whole packs, a block with any edge that touches a
+   *    halo point goes to the halo split. In each split, all blocks but the last of a color are
+   *    full, i.e. the groups and packs remain aligned. ---*/
+
+  OverlapEdges.clear();
+  OverlapEdges.reserve(geometry.GetnEdge());
+  vector<unsigned long> colorBegin(2 * nColor + 1, 0), groupSize(nColor, 1);
+
+  for (auto iSplit = 0ul; iSplit < 2; ++iSplit) {
+    for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+      const auto& color = EdgeColoring[iColor];
+#ifdef HAVE_OMP
+      groupSize[iColor] = color.groupSize;
+#endif
+      const auto blockSize = nextMultiple(groupSize[iColor], Double::Size);
+
+      for (auto k = 0ul; k < color.size; k += blockSize) {
+        const auto kEnd = std::min<unsigned long>(k + blockSize, color.size);
+        bool halo = false;
+        for (auto kEdge = k; kEdge < kEnd && !halo; ++kEdge) {
+          const auto iEdge = color.indices[kEdge];
+          halo = (geometry.edges->GetNode(iEdge, 0) >= nPointDomain) ||
+                 (geometry.edges->GetNode(iEdge, 1) >= nPointDomain);
+        }
+        if (halo == (iSplit == 1)) {
+          for (auto kEdge = k; kEdge < kEnd; ++kEdge) OverlapEdges.push_back(color.indices[kEdge]);
+        }
+      }
+      colorBegin[iSplit * nColor + iColor + 1] = OverlapEdges.size();
+    }
+  }
+
+  EdgeColoringInterior.clear();
+  EdgeColoringHalo.clear();
+  for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+    for (auto iSplit = 0ul; iSplit < 2; ++iSplit) {
+      const auto begin = colorBegin[iSplit * nColor + iColor], end = colorBegin[iSplit * nColor + iColor + 1];
+      auto& split = (iSplit == 0) ? EdgeColoringInterior : EdgeColoringHalo;
+      split.emplace_back(OverlapEdges.data() + begin, end - begin, groupSize[iColor]);
+    }
+  }
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
   if (!edgeNumerics) {
@@ -1523,9 +1599,19 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     }
     InstantiateEdgeNumerics(solvers, config);
 
-    /*--- The SIMD numerics do not use gradients of density and enthalpy. ---*/
-    if (!config->GetContinuous_Adjoint()) {
-      SU2_OMP_SAFE_GLOBAL_ACCESS(nPrimVarGrad = std::min<unsigned short>(nDim + 2, nPrimVarGrad);)
+    /*--- The SIMD numerics do not use gradients of density and enthalpy, except
+     *    upwind schemes for general gases which reconstruct the density. The
+     *    incompressible solver already only allocates the required gradients. ---*/
+    if (R == ENUM_REGIME::COMPRESSIBLE && !config->GetContinuous_Adjoint()) {
+      const bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR) ||
+                             (config->GetKind_FluidModel() == IDEAL_GAS);
+      const bool reconDensity = !ideal_gas && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+      const unsigned short nVarGrad = nDim + (reconDensity ? 3 : 2);
+      SU2_OMP_SAFE_GLOBAL_ACCESS(nPrimVarGrad = std::min<unsigned short>(nVarGrad, nPrimVarGrad);)
+    }
+
+    if (geometry->GetCommOverlap()) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(SetEdgeColoringOverlap(*geometry);)
     }
   }
 
@@ -1542,29 +1628,42 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
-    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-    for(auto k = 0ul; k < color.size; k += Double::Size) {
-      Int iEdge;
-      Double mask;
-      for (auto j = 0ul; j < Double::Size; ++j) {
-        bool in = (k+j < color.size);
-        mask[j] = in;
-        iEdge[j] = color.indices[k+j*in];
-      }
+  auto computeColors = [&](const auto& coloring) {
+    for (auto color : coloring) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for(auto k = 0ul; k < color.size; k += Double::Size) {
+        Int iEdge;
+        Double mask;
+        for (auto j = 0ul; j < Double::Size; ++j) {
+          bool in = (k+j < color.size);
+          mask[j] = in;
+          iEdge[j] = color.indices[k+j*in];
+        }
 
-      if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
-      } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
-      }
-      if (MGLevel == MESH_0) {
-        for (auto j = 0ul; j < Double::Size; ++j)
-          counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+        if (ReducerStrategy) {
+          edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+        } else {
+          edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+        }
+        if (MGLevel == MESH_0) {
+          for (auto j = 0ul; j < Double::Size; ++j)
+            counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+        }
       }
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
+  };
+
+  /*--- With a deferred halo exchange (see SetPrimitive_Limiter), the edges between
+   *    domain points are computed while the messages are in flight. ---*/
+  if (GetDeferredCommsPending() && !EdgeColoringInterior.empty()) {
+    computeColors(EdgeColoringInterior);
+    CompleteDeferredComms(geometry, config);
+    computeColors(EdgeColoringHalo);
+  } else {
+    CompleteDeferredComms(geometry, config);
+    computeColors(EdgeColoring);
   }
 
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
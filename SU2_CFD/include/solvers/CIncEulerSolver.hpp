@@ -124,6 +124,23 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
+  /*!
+   * \brief Whether the vectorized edge loop (EdgeFluxResidual) is used for the convective and viscous fluxes.
+   * \note Opt-in via USE_VECTORIZATION, and not compatible with bounded scalar transport which needs the
+   *       edge mass fluxes.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline bool UseEdgeNumerics(const CConfig* config) const {
+    return config->GetUseVectorization() && !config->GetBounded_Scalar();
+  }
+
 public:
   CIncEulerSolver() = delete;
 
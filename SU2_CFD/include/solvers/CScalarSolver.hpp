@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -79,6 +81,9 @@ class CScalarSolver : public CSolver {
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
   CSysVector<su2double> EdgeFluxesDiff; /*!< \brief Flux difference between ij and ji for non-conservative discretisation. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  bool edgeNumericsTried = false; /*!< \brief InstantiateEdgeNumerics was called (edgeNumerics may still be nullptr). */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -298,6 +303,20 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object, the solvers that support vectorization override this.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous fluxes of all edges with the vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, const CConfig* config);
+
  private:
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
@@ -186,6 +186,35 @@ private:
    directly instead of calling GetBaseClassPointerToNodes() or doing something equivalent. ---*/
   CVariable* base_nodes;  /*!< \brief Pointer to CVariable to allow polymorphic access to solver nodes. */
 
+  /*!
+   * \brief Halo exchange whose completion is deferred (see DeferNextComms). It has its own buffers and
+   *        requests, those of the geometry are shared by all the comms that may take place in the meantime.
+   */
+  struct CDeferredComms {
+    bool requested = false;  /*!< \brief Whether the next exchange of requestedType is deferred. */
+    bool pending = false;    /*!< \brief Whether an exchange was initiated and not completed yet. */
+    bool completing = false; /*!< \brief Set by CompleteDeferredComms, for CompleteComms to do the work. */
+    MPI_QUANTITIES requestedType = MPI_QUANTITIES::SOLUTION;
+    MPI_QUANTITIES commType = MPI_QUANTITIES::SOLUTION;
+    vector<su2double> bufSend, bufRecv;
+    vector<SU2_MPI::Request> reqSend, reqRecv;
+  } deferredComms;
+
+  /*!
+   * \brief Launch the non-blocking recvs of the deferred exchange.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] countPerPoint - Number of variables per point.
+   */
+  void PostDeferredRecvs(const CGeometry *geometry, unsigned short countPerPoint);
+
+  /*!
+   * \brief Launch one non-blocking send of the deferred exchange, once its part of the buffer is loaded.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] iSend - Index of the message.
+   */
+  void PostDeferredSend(const CGeometry *geometry, unsigned short countPerPoint, int iSend);
+
 public:
 
   CSysVector<su2double> LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
@@ -264,6 +293,26 @@ public:
                      const CConfig *config,
                      MPI_QUANTITIES commType);
 
+  /*!
+   * \brief Defer the completion of the next exchange of a quantity. InitiateComms then loads it into private
+   *        buffers, CompleteComms returns immediately, and the exchange is completed by CompleteDeferredComms.
+   * \note Every rank must defer the same exchanges, and the halo values of the quantity must not be used in between.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void DeferNextComms(MPI_QUANTITIES commType);
+
+  /*!
+   * \brief Complete the deferred exchange, if one is pending.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void CompleteDeferredComms(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Whether a deferred exchange was initiated and not completed yet.
+   */
+  inline bool GetDeferredCommsPending() const { return deferredComms.pending; }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -4213,6 +4262,12 @@ public:
    */
   inline const string& GetSolverName() const  { return SolverName; }
 
+  /*!
+   * \brief Name the linear system of the solver, to identify it in the files written with LINEAR_SYSTEM_DUMP_ITER.
+   * \param[in] name - Name of the system.
+   */
+  inline void SetLinearSystemName(const string& name) { System.SetName(name); }
+
   /*!
    * \brief Get the solution fields.
    * \return A vector containing the solution fields.
@@ -75,36 +75,38 @@ class CSpeciesFlameletSolver final : public CSpeciesSolver {
   su2double GetBurntProgressVariable(CFluidModel* fluid_model, const su2double* scalars);
 
   /*!
-   * \brief Retrieve scalar source terms from manifold.
+   * \brief Retrieve scalar source terms from manifold, for a batch of consecutive points.
    * \param[in] config - definition of particular problem.
    * \param[in] fluid_model_local - pointer to flamelet fluid model.
-   * \param[in] iPoint - node ID.
-   * \param[in] scalars - local scalar solution.
-   * \param[in] table_source_names - variable names of scalar source terms.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] iPointBegin - ID of the first node of the batch.
+   * \param[in] nPointBatch - number of nodes in the batch (at most CFluidModel::BatchSize).
+   * \param[in] scalars - scalar solution of the batch, one row per scalar.
+   * \return - number of nodes outside manifold bounds.
    */
-  unsigned long SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  unsigned long SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPointBegin,
+                                 unsigned short nPointBatch, const su2activematrix& scalars);
 
   /*!
-   * \brief Retrieve passive look-up data from manifold.
+   * \brief Retrieve passive look-up data from manifold, for a batch of consecutive points.
    * \param[in] fluid_model_local - pointer to flamelet fluid model.
-   * \param[in] iPoint - node ID.
-   * \param[in] scalars - local scalar solution.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] iPointBegin - ID of the first node of the batch.
+   * \param[in] nPointBatch - number of nodes in the batch (at most CFluidModel::BatchSize).
+   * \param[in] scalars - scalar solution of the batch, one row per scalar.
+   * \return - number of nodes outside manifold bounds.
    */
-  unsigned long SetScalarLookUps(CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  unsigned long SetScalarLookUps(CFluidModel* fluid_model_local, unsigned long iPointBegin,
+                                 unsigned short nPointBatch, const su2activematrix& scalars);
 
   /*!
-   * \brief Retrieve the preferential diffusion scalar values from manifold.
+   * \brief Retrieve the preferential diffusion scalar values from manifold, for a batch of consecutive points.
    * \param[in] fluid_model_local - pointer to flamelet fluid model.
-   * \param[in] iPoint - node ID.
-   * \param[in] scalars - local scalar solution.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] iPointBegin - ID of the first node of the batch.
+   * \param[in] nPointBatch - number of nodes in the batch (at most CFluidModel::BatchSize).
+   * \param[in] scalars - scalar solution of the batch, one row per scalar.
+   * \return - number of nodes outside manifold bounds.
    */
-  unsigned long SetPreferentialDiffusionScalars(CFluidModel* fluid_model_local,
-                                                unsigned long iPoint, const vector<su2double>& scalars);
+  unsigned long SetPreferentialDiffusionScalars(CFluidModel* fluid_model_local, unsigned long iPointBegin,
+                                                unsigned short nPointBatch, const su2activematrix& scalars);
 
  public:
   /*!
@@ -109,6 +109,13 @@ public:
   void Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
                         CNumerics* numerics, const CConfig* config) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Source term computation.
    * \param[in] geometry - Geometrical definition of the problem.
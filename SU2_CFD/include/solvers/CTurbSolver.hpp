@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
+class CSourceNumericsSIMD;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -42,6 +44,16 @@ protected:
 
   vector<su2activematrix> Inlet_TurbVars;  /*!< \brief Turbulence variables at inlet profiles */
 
+  CSourceNumericsSIMD* sourceNumerics = nullptr; /*!< \brief Object for vectorized source term computation. */
+  bool sourceNumericsTried = false; /*!< \brief The factory was called (it returns nullptr for unsupported options). */
+
+  /*!
+   * \brief Compute the source terms with the vectorized numerics, i.e. the point loop of Source_Residual.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PointSourceResidual(const CGeometry* geometry, const CConfig* config);
+
 public:
   /*!
    * \brief Destructor of the class.
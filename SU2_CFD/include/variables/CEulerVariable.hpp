@@ -133,6 +133,16 @@ class CEulerVariable : public CFlowVariable {
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a range of points (inviscid compressible flows),
+   *        evaluating the thermodynamic state with the batched fluid model methods.
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] nPointBatch - Number of points, at most CFluidModel::BatchSize.
+   * \param[in] FluidModel - Fluid model.
+   * \return Number of non-physical points in the range.
+   */
+  unsigned long SetPrimVarBatch(unsigned long iPointBegin, unsigned short nPointBatch, CFluidModel *FluidModel);
+
   /*!
    * \brief A virtual member.
    */
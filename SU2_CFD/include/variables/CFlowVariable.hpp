@@ -255,6 +255,11 @@ class CFlowVariable : public CVariable {
   inline su2double* GetVorticity(unsigned long iPoint) final { return Vorticity[iPoint]; }
   inline const su2double* GetVorticity(unsigned long iPoint) const final { return Vorticity[iPoint]; }
 
+  /*!
+   * \brief Get the vorticity of all points.
+   */
+  inline const MatrixType& GetVorticity() const { return Vorticity; }
+
   /*!
    * \brief Get the magnitude of rate of strain.
    * \param[in] iPoint - Point index.
@@ -267,4 +272,5 @@ class CFlowVariable : public CVariable {
    * \return Vector of magnitudes.
    */
   inline su2activevector& GetStrainMag() { return StrainMag; }
+  inline const su2activevector& GetStrainMag() const { return StrainMag; }
 };
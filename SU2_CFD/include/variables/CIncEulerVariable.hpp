@@ -204,6 +204,16 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive variables of a range of points (inviscid incompressible flows),
+   *        evaluating the thermodynamic state with the batched fluid model methods.
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] nPointBatch - Number of points, at most CFluidModel::BatchSize.
+   * \param[in] FluidModel - Fluid model.
+   * \return Number of non-physical points in the range.
+   */
+  unsigned long SetPrimVarBatch(unsigned long iPointBegin, unsigned short nPointBatch, CFluidModel *FluidModel);
+
   /*!
    * \brief Set the specific heat Cp.
    */
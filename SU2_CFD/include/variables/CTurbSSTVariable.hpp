@@ -78,13 +78,28 @@ public:
    */
   inline su2double GetF1blending(unsigned long iPoint) const override { return F1(iPoint); }
 
+  /*!
+   * \brief Get the first blending function of all points.
+   */
+  inline const VectorType& GetF1blending() const { return F1; }
+
   /*!
    * \brief Get the second blending function.
    */
   inline su2double GetF2blending(unsigned long iPoint) const override { return F2(iPoint); }
 
+  /*!
+   * \brief Get the second blending function of all points.
+   */
+  inline const VectorType& GetF2blending() const { return F2; }
+
   /*!
    * \brief Get the value of the cross diffusion of tke and omega.
    */
   inline su2double GetCrossDiff(unsigned long iPoint) const override { return CDkw(iPoint); }
+
+  /*!
+   * \brief Get the cross diffusion of all points.
+   */
+  inline const VectorType& GetCrossDiff() const { return CDkw; }
 };
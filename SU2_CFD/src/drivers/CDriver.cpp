@@ -891,6 +891,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
       if ((rank == MASTER_NODE) && (iMGlevel == MESH_0))
         cout << "Finding max control volume width." << endl;
       geometry[iMGlevel]->SetMaxLength(config);
+      geometry[iMGlevel]->SetLeastSquaresWeights(config);
     }
 
     /*--- Communicate the number of neighbors. This is needed for
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/fluid/CDataDrivenFluid.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 #if defined(HAVE_MLPCPP)
 #include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
 #define USE_MLPCPP
@@ -89,6 +90,7 @@ CDataDrivenFluid::~CDataDrivenFluid() {
       delete iomap_rhoe;
       delete lookup_mlp;
 #endif
+      delete batched_mlp;
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
       delete lookup_table;
@@ -159,6 +161,21 @@ void CDataDrivenFluid::MapInputs_to_Outputs() {
     iomap_rhoe = new MLPToolbox::CIOMap(input_names_rhoe, output_names_rhoe);
     lookup_mlp->PairVariableswithMLPs(*iomap_rhoe);
     MLP_inputs.resize(2);
+
+    /*--- Batched evaluation of the same networks, if their architecture is supported. ---*/
+    batched_mlp = new CBatchedMLP(datadriven_fluid_options.n_filenames, datadriven_fluid_options.datadriven_filenames);
+    batched_map = batched_mlp->PairVariables(input_names_rhoe, output_names_rhoe);
+    if (batched_mlp->IsSupported(batched_map)) {
+      batch_inputs.resize(2, BatchSize);
+      batch_outputs.resize(output_names_rhoe.size(), BatchSize);
+      if (use_MLP_derivatives) {
+        batch_d_outputs.resize(2, BatchSize);
+        batch_d2_outputs.resize(4, BatchSize);
+      }
+    } else {
+      delete batched_mlp;
+      batched_mlp = nullptr;
+    }
 #endif
   } else {
     /*--- Retrieve column indices of LUT output variables ---*/
@@ -175,6 +192,8 @@ void CDataDrivenFluid::MapInputs_to_Outputs() {
     LUT_lookup_indices.push_back(LUT_idx_d2sde2);
     LUT_lookup_indices.push_back(LUT_idx_d2sdedrho);
     LUT_lookup_indices.push_back(LUT_idx_d2sdrho2);
+
+    batch_outputs.resize(LUT_lookup_indices.size(), BatchSize);
   }
 }
 
@@ -242,6 +261,98 @@ void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CDataDrivenFluid::SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) {
+  /*--- MLPs whose architecture is not supported by CBatchedMLP are evaluated one point at a time. In reverse AD
+   *    the point-wise method preaccumulates the derivatives of each point. ---*/
+#ifdef CODI_REVERSE_TYPE
+  const bool batched = false;
+#else
+  const bool batched = (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) || (batched_mlp != nullptr);
+#endif
+  if (!batched) {
+    CFluidModel::SetTDStateBatch_rhoe(nPoint, state);
+    return;
+  }
+
+  su2double rho[BatchSize], e[BatchSize], s_e[BatchSize], s_rho[BatchSize];
+  su2double s_ee[BatchSize], s_erho[BatchSize], s_rhorho[BatchSize];
+
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    rho[i] = max(min(state.Density[i], rho_max), rho_min);
+    e[i] = max(min(state.StaticEnergy[i], e_max), e_min);
+  }
+
+  /*--- Query the data set for all the points of the batch, the rows of batch_outputs are s, dsde_rho, dsdrho_e,
+   *    d2sde2, d2sdedrho, and d2sdrho2, or only s for the physics-informed MLPs, whose derivatives are computed
+   *    with respect to the inputs. ---*/
+
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    bool inside[BatchSize];
+    lookup_table->LookUpBatch_XY(LUT_lookup_indices, nPoint, rho, e, batch_outputs, inside);
+    for (unsigned short i = 0; i < nPoint; ++i) state.Extrapolation[i] = !inside[i];
+  } else {
+    for (unsigned short i = 0; i < nPoint; ++i) {
+      batch_inputs(idx_rho, i) = rho[i];
+      batch_inputs(idx_e, i) = e[i];
+    }
+    if (use_MLP_derivatives) {
+      batched_mlp->Predict(batched_map, nPoint, batch_inputs, batch_outputs, state.Extrapolation, &batch_d_outputs,
+                           &batch_d2_outputs);
+      for (unsigned short i = 0; i < nPoint; ++i) {
+        state.Entropy[i] = batch_outputs(0, i);
+        s_e[i] = batch_d_outputs(idx_e, i);
+        s_rho[i] = batch_d_outputs(idx_rho, i);
+        s_ee[i] = batch_d2_outputs(idx_e * 2 + idx_e, i);
+        s_erho[i] = batch_d2_outputs(idx_e * 2 + idx_rho, i);
+        s_rhorho[i] = batch_d2_outputs(idx_rho * 2 + idx_rho, i);
+      }
+    } else {
+      batched_mlp->Predict(batched_map, nPoint, batch_inputs, batch_outputs, state.Extrapolation);
+    }
+  }
+
+  if (!use_MLP_derivatives || Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    for (unsigned short i = 0; i < nPoint; ++i) {
+      state.Entropy[i] = batch_outputs(0, i);
+      s_e[i] = batch_outputs(1, i);
+      s_rho[i] = batch_outputs(2, i);
+      s_ee[i] = batch_outputs(3, i);
+      s_erho[i] = batch_outputs(4, i);
+      s_rhorho[i] = batch_outputs(5, i);
+    }
+  }
+
+  /*--- Thermodynamic properties from the entropy and its derivatives (see SetTDState_rhoe). ---*/
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    const su2double rho_2 = rho[i] * rho[i];
+    const su2double T = 1 / s_e[i];
+    const su2double P = -rho_2 * T * s_rho[i];
+
+    const su2double dTde = -T * T * s_ee[i];
+    const su2double dTdrho = -T * T * s_erho[i];
+
+    const su2double blue_term = (s_rho[i] * (2 - rho[i] * T * s_erho[i]) + rho[i] * s_rhorho[i]);
+    const su2double green_term = (-T * s_ee[i] * s_rho[i] + s_erho[i]);
+
+    const su2double dPde = -rho_2 * T * (-T * (s_ee[i] * s_rho[i]) + s_erho[i]);
+    const su2double dPdrho = -rho[i] * T * (s_rho[i] * (2 - rho[i] * T * s_erho[i]) + rho[i] * s_rhorho[i]);
+
+    const su2double dhdrho = -P * (1 / rho_2) + dPdrho / rho[i];
+    const su2double dhde = 1 + dPde / rho[i];
+    const su2double drhode_p = -dPde / dPdrho;
+
+    state.Temperature[i] = T;
+    state.Pressure[i] = P;
+    state.SoundSpeed2[i] = -rho[i] * T * (blue_term - rho[i] * green_term * (s_rho[i] / s_e[i]));
+    state.dPde_rho[i] = dPde;
+    state.dPdrho_e[i] = dPdrho;
+    state.Cv[i] = 1 / dTde;
+    state.Cp[i] = (dhde + drhode_p * dhdrho) / (dTde + dTdrho * drhode_p);
+  }
+}
+
 void CDataDrivenFluid::SetTDState_PT(su2double P, su2double T) {
 
   /*--- Approximate density and static energy with ideal gas law. ---*/
@@ -115,6 +115,7 @@ CFluidFlamelet::~CFluidFlamelet() {
     if (preferential_diffusion) delete iomap_PD;
     }
 #endif
+  delete batched_mlp;
 }
 
 void CFluidFlamelet::SetTDState_T(su2double val_temperature, const su2double* val_scalars) {
@@ -245,6 +246,19 @@ void CFluidFlamelet::PreprocessLookUp(CConfig* config) {
       iomap_PD = new MLPToolbox::CIOMap(controlling_variable_names, varnames_PD);
       lookup_mlp->PairVariableswithMLPs(*iomap_PD);
     }
+
+    /*--- Batched evaluation of the same networks, if their architecture is supported. ---*/
+    batched_mlp = new CBatchedMLP(datadriven_fluid_options.n_filenames, datadriven_fluid_options.datadriven_filenames);
+    batched_maps[FLAMELET_LOOKUP_OPS::THERMO] = batched_mlp->PairVariables(controlling_variable_names, varnames_TD);
+    batched_maps[FLAMELET_LOOKUP_OPS::SOURCES] = batched_mlp->PairVariables(controlling_variable_names, varnames_Sources);
+    batched_maps[FLAMELET_LOOKUP_OPS::LOOKUP] = batched_mlp->PairVariables(controlling_variable_names, varnames_LookUp);
+    batched_maps[FLAMELET_LOOKUP_OPS::PREFDIF] = batched_mlp->PairVariables(controlling_variable_names, varnames_PD);
+    bool supported = true;
+    for (const auto iMap : batched_maps) supported &= batched_mlp->IsSupported(iMap);
+    if (!supported) {
+      delete batched_mlp;
+      batched_mlp = nullptr;
+    }
 #endif
   } else {
     for (auto iVar=0u; iVar < varnames_TD.size(); iVar++) {
@@ -344,3 +358,15 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
   AD::EndPreacc();
   return extrapolation;
 }
+
+unsigned long CFluidFlamelet::EvaluateDataSetBatch(unsigned short nPoint, const su2activematrix& input_scalars,
+                                                   unsigned short lookup_type, su2activematrix& output_refs,
+                                                   unsigned long* extrapolation) {
+  /*--- In reverse AD the point-wise method preaccumulates the derivatives of each point. ---*/
+#ifndef CODI_REVERSE_TYPE
+  if (batched_mlp != nullptr) {
+    return batched_mlp->Predict(batched_maps[lookup_type], nPoint, input_scalars, output_refs, extrapolation);
+  }
+#endif
+  return CFluidModel::EvaluateDataSetBatch(nPoint, input_scalars, lookup_type, output_refs, extrapolation);
+}
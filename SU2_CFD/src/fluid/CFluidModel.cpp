@@ -153,3 +153,54 @@ unique_ptr<CDiffusivityModel> CFluidModel::MakeMassDiffusivityModel(const CConfi
 void CFluidModel::SetMassDiffusivityModel(const CConfig* config) {
   MassDiffusivity = MakeMassDiffusivityModel(config, 0);
 }
+
+void CFluidModel::SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) {
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    SetTDState_rhoe(state.Density[i], state.StaticEnergy[i]);
+    state.Pressure[i] = Pressure;
+    state.Temperature[i] = Temperature;
+    state.SoundSpeed2[i] = SoundSpeed2;
+    state.dPdrho_e[i] = dPdrho_e;
+    state.dPde_rho[i] = dPde_rho;
+    state.Cp[i] = Cp;
+    state.Cv[i] = Cv;
+    state.Entropy[i] = Entropy;
+    state.Extrapolation[i] = GetExtrapolation();
+  }
+}
+
+void CFluidModel::SetTDStateBatch_PT(unsigned short nPoint, TDStateBatch& state) {
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    SetTDState_PT(state.Pressure[i], state.Temperature[i]);
+    state.Density[i] = Density;
+    state.StaticEnergy[i] = StaticEnergy;
+    state.SoundSpeed2[i] = SoundSpeed2;
+    state.dPdrho_e[i] = dPdrho_e;
+    state.dPde_rho[i] = dPde_rho;
+    state.Cp[i] = Cp;
+    state.Cv[i] = Cv;
+  }
+}
+
+void CFluidModel::SetTDStateBatch_T(unsigned short nPoint, TDStateBatch& state) {
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    SetTDState_T(state.Temperature[i]);
+    state.Density[i] = Density;
+    state.Cp[i] = Cp;
+    state.Cv[i] = Cv;
+  }
+}
+
+unsigned long CFluidModel::EvaluateDataSetBatch(unsigned short nPoint, const su2activematrix& input_scalars,
+                                                unsigned short lookup_type, su2activematrix& output_refs,
+                                                unsigned long* extrapolation) {
+  vector<su2double> inputs(input_scalars.rows()), outputs(output_refs.rows());
+  unsigned long misses = 0;
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    for (auto iVar = 0ul; iVar < inputs.size(); ++iVar) inputs[iVar] = input_scalars(iVar, i);
+    extrapolation[i] = EvaluateDataSet(inputs, lookup_type, outputs);
+    for (auto iVar = 0ul; iVar < outputs.size(); ++iVar) output_refs(iVar, i) = outputs[iVar];
+    misses += extrapolation[i];
+  }
+  return misses;
+}
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/fluid/CIdealGas.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 CIdealGas::CIdealGas(su2double gamma, su2double R, bool CompEntropy) : CFluidModel() {
   Gamma = gamma;
@@ -98,3 +99,32 @@ void CIdealGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
   dsdP_rho = 1.0 / dPds_rho;
   dsdrho_P = -SoundSpeed2 / dPds_rho;
 }
+
+void CIdealGas::SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) {
+  const su2double gm1 = Gamma_Minus_One, gamma = Gamma, R = Gas_Constant, cp = Cp, cv = Cv;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    const su2double rho = state.Density[i], e = state.StaticEnergy[i];
+    const su2double P = gm1 * rho * e;
+    state.Pressure[i] = P;
+    state.Temperature[i] = gm1 * e / R;
+    state.SoundSpeed2[i] = gamma * P / rho;
+    state.dPdrho_e[i] = gm1 * e;
+    state.dPde_rho[i] = gm1 * rho;
+    state.Cp[i] = cp;
+    state.Cv[i] = cv;
+  }
+}
+
+void CIdealGas::SetTDStateBatch_PT(unsigned short nPoint, TDStateBatch& state) {
+  const su2double gm1 = Gamma_Minus_One, R = Gas_Constant;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    const su2double P = state.Pressure[i], T = state.Temperature[i];
+    state.StaticEnergy[i] = T * R / gm1;
+    state.Density[i] = P / (T * R);
+  }
+  SetTDStateBatch_rhoe(nPoint, state);
+}
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/fluid/CPengRobinson.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 CPengRobinson::CPengRobinson(su2double gamma, su2double R, su2double Pstar, su2double Tstar, su2double w)
     : CIdealGas(gamma, R) {
@@ -143,6 +144,63 @@ void CPengRobinson::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CPengRobinson::SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) {
+  if (nPoint == 0) return;
+  const su2double sqrt2 = sqrt(2.0), R = Gas_Constant, gm1 = Gamma_Minus_One, cp = Cp, cv = Cv;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    const su2double rho = state.Density[i], e = state.StaticEnergy[i];
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(rho);
+    AD::SetPreaccIn(e);
+
+    const su2double rho2 = rho * rho;
+    const su2double fv = (log(1.0 + (rho * b * sqrt2 / (1 + rho * b))) - log(1.0 - (rho * b * sqrt2 / (1 + rho * b)))) / 2.0;
+
+    su2double A = R / gm1;
+    su2double B = a * k * (k + 1) * fv / (b * sqrt2 * sqrt(TstarCrit));
+    const su2double C = a * (k + 1) * (k + 1) * fv / (b * sqrt2) + e;
+
+    su2double T = (-B + sqrt(B * B + 4 * A * C)) / (2 * A);
+    T *= T;
+
+    const su2double a2T = alpha2(T);
+
+    A = (1 / rho2 + 2 * b / rho - b * b);
+    B = 1 / rho - b;
+
+    su2double P = T * R / B - a * a2T / A;
+    const su2double DpDd_T = (T * R / (B * B) - 2 * a * a2T * (1 / rho + b) / (A * A)) / (rho2);
+    const su2double DpDT_d = R / B + a * k / A * sqrt(a2T / (T * TstarCrit));
+    const su2double Cv_T = R / gm1 + (a * k * (k + 1) * fv) / (2 * b * sqrt(2 * T * TstarCrit));
+    su2double dPde = DpDT_d / Cv_T;
+    const su2double DeDd_T = -a * (1 + k) * sqrt(a2T) / A / (rho2);
+    su2double dPdrho = DpDd_T - dPde * DeDd_T;
+    su2double c2 = dPdrho + P / (rho2)*dPde;
+
+    AD::SetPreaccOut(T);
+    AD::SetPreaccOut(c2);
+    AD::SetPreaccOut(dPde);
+    AD::SetPreaccOut(dPdrho);
+    AD::SetPreaccOut(P);
+    AD::EndPreacc();
+
+    state.Pressure[i] = P;
+    state.Temperature[i] = T;
+    state.SoundSpeed2[i] = c2;
+    state.dPde_rho[i] = dPde;
+    state.dPdrho_e[i] = dPdrho;
+    state.Cp[i] = cp;
+    state.Cv[i] = cv;
+  }
+
+  /*--- Keep the compressibility factor of the last point as the initial guess for SetTDState_PT. ---*/
+  const auto last = nPoint - 1;
+  Zed = state.Pressure[last] / (Gas_Constant * state.Temperature[last] * state.Density[last]);
+}
+
 void CPengRobinson::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-6;
   su2double A, B, Z, DZ = 1.0, F, F1, atanh;
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 
 CVanDerWaalsGas::CVanDerWaalsGas(su2double gamma, su2double R, su2double Pstar, su2double Tstar) : CIdealGas(gamma, R) {
   a = 27.0 / 64.0 * Gas_Constant * Gas_Constant * Tstar * Tstar / Pstar;
@@ -53,6 +54,31 @@ void CVanDerWaalsGas::SetTDState_rhoe(su2double rho, su2double e) {
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 }
 
+void CVanDerWaalsGas::SetTDStateBatch_rhoe(unsigned short nPoint, TDStateBatch& state) {
+  if (nPoint == 0) return;
+  const su2double gm1 = Gamma_Minus_One, R = Gas_Constant, cp = Cp, cv = Cv;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    const su2double rho = state.Density[i], e = state.StaticEnergy[i];
+    const su2double P = gm1 * rho / (1.0 - rho * b) * (e + rho * a) - a * rho * rho;
+    const su2double dPde = rho * gm1 / (1.0 - rho * b);
+    const su2double dPdrho = gm1 / (1.0 - rho * b) *
+                             ((e + 2 * rho * a) + rho * b * (e + rho * a) / (1.0 - rho * b)) - 2 * rho * a;
+    state.Pressure[i] = P;
+    state.Temperature[i] = (P + rho * rho * a) * ((1 - rho * b) / (rho * R));
+    state.dPde_rho[i] = dPde;
+    state.dPdrho_e[i] = dPdrho;
+    state.SoundSpeed2[i] = dPdrho + P / (rho * rho) * dPde;
+    state.Cp[i] = cp;
+    state.Cv[i] = cv;
+  }
+
+  /*--- Keep the compressibility factor of the last point as the initial guess for SetTDState_PT. ---*/
+  const auto last = nPoint - 1;
+  Zed = state.Pressure[last] / (Gas_Constant * state.Temperature[last] * state.Density[last]);
+}
+
 void CVanDerWaalsGas::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-5;
   unsigned short nmax = 20, count = 0;
@@ -166,6 +166,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
+    Jacobian.SetFloatStorage(config->GetLinear_Solver_Float_Storage_Flow());
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
   }
   else {
@@ -1660,11 +1661,18 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    /*--- Green-Gauss gradients and limiters can be computed in a single pass. ---*/
+
+    const bool fusedLimiter = limiter && !van_albada && config->GetFusedGradientLimiter() &&
+                              (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
+        if (fusedLimiter) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+        else SetPrimitive_Gradient_GG(geometry, config, true);
+        break;
       case LEAST_SQUARES:
       case WEIGHTED_LEAST_SQUARES:
         SetPrimitive_Gradient_LS(geometry, config, true); break;
@@ -1673,7 +1681,7 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
     /*--- Limiter computation ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    if (limiter && !van_albada && !fusedLimiter) SetPrimitive_Limiter(geometry, config);
   }
 }
 
@@ -1685,17 +1693,21 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The thermodynamic state is evaluated for batches of points to amortize
+   *    the cost of the fluid model calls (and to allow their vectorization). ---*/
+
+  constexpr auto batchSize = CFluidModel::BatchSize;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint += batchSize) {
 
     /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+    const auto nPointBatch = static_cast<unsigned short>(min<unsigned long>(batchSize, nPoint - iPoint));
 
-    /* Check for non-realizable states for reporting. */
+    /* Count non-realizable states for reporting. */
 
-    if (!physical) nonPhysicalPoints++;
+    nonPhysicalPoints += nodes->SetPrimVarBatch(iPoint, nPointBatch, GetFluidModel());
   }
   END_SU2_OMP_FOR
 
@@ -1767,10 +1779,31 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                          (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool low_mach_corr = config->Low_Mach_Correction();
 
-  /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
-    EdgeFluxResidual(geometry, solver_container, config);
-    return;
+  /*--- Use vectorization if the scheme supports it. For non-ideal gases the vectorized MUSCL
+   *    reconstruction linearizes the equation of state, which changes the results, therefore
+   *    it needs to be requested with USE_VECTORIZATION. ---*/
+  if (!low_mach_corr) {
+    switch (config->GetKind_Upwind_Flow()) {
+      case UPWIND::ROE:
+      case UPWIND::HLLC:
+        if (ideal_gas || config->GetUseVectorization()) {
+          EdgeFluxResidual(geometry, solver_container, config);
+          return;
+        }
+        break;
+      case UPWIND::AUSM:
+      case UPWIND::AUSMPLUSUP:
+      case UPWIND::AUSMPLUSUP2:
+      case UPWIND::SLAU:
+      case UPWIND::SLAU2:
+        if (ideal_gas) {
+          EdgeFluxResidual(geometry, solver_container, config);
+          return;
+        }
+        break;
+      default:
+        break;
+    }
   }
 
   const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -42,8 +42,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver() : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -76,8 +74,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -121,8 +117,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
   CFx_Inv = nullptr;   CFy_Inv = nullptr;   CFz_Inv = nullptr;
@@ -732,7 +726,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver() {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -816,6 +810,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -823,98 +819,98 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
-                                       config->GetPressure_Critical(), config->GetTemperature_Critical());
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+                                          config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
-                                     config->GetTemperature_Critical(), config->GetAcentric_Factor());
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+                                        config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case COOLPROP:
 
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      auxFluidModel = new CCoolProp(config->GetFluid_Name());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config, false);
+      auxFluidModel = new CDataDrivenFluid(config, false);
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
 
       break;
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -954,17 +950,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -972,10 +968,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -989,7 +985,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1070,50 +1066,58 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
 
-  delete FluidModel;
+  delete auxFluidModel;
 
-  switch (config->GetKind_FluidModel()) {
+  /*--- Create one fluid model object per OpenMP thread, such that the tasks of
+        ProcessTaskList_DG can be carried out in parallel. GetFluidModel()
+        returns the object of the calling thread. ---*/
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-  }
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
 
-  if (viscous) {
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
-    FluidModel->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+      case COOLPROP:
+        FluidModel[thread] = new CCoolProp(config->GetFluid_Name());
+        break;
+
+      case DATADRIVEN_FLUID:
+        FluidModel[thread] = new CDataDrivenFluid(config);
+        break;
+    }
+
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+      GetFluidModel()->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+    }
   }
+  END_SU2_OMP_PARALLEL
+
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
@@ -1901,6 +1905,35 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
 
 void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
 
+  /*--- Determine the cumulative number of DOFs in the face residuals of the
+        internal matching faces and of the surface elements of the boundaries.
+        These are used by the threads to find the starting position of their
+        part of a range of faces in the vector of face residuals. ---*/
+  const unsigned long nMatchingFaces = nMatchingInternalFacesWithHaloElem[config->GetnLevels_TimeAccurateLTS()];
+  prefixResInternalFaces.assign(nMatchingFaces+1, 0);
+  for(unsigned long l=0; l<nMatchingFaces; ++l) {
+    const unsigned short ind = matchingInternalFaces[l].indStandardElement;
+    prefixResInternalFaces[l+1] = prefixResInternalFaces[l]
+                                + standardMatchingFacesSol[ind].GetNDOFsFaceSide0()
+                                + standardMatchingFacesSol[ind].GetNDOFsFaceSide1();
+    if( symmetrizingTermsPresent )
+      prefixResInternalFaces[l+1] += standardMatchingFacesSol[ind].GetNDOFsElemSide0()
+                                   + standardMatchingFacesSol[ind].GetNDOFsElemSide1();
+  }
+
+  prefixResBoundaryFaces.resize(nMarker);
+  for(unsigned short iMarker=0; iMarker<nMarker; ++iMarker) {
+    const vector<CSurfaceElementFEM> &surfElem = boundaries[iMarker].surfElem;
+    prefixResBoundaryFaces[iMarker].assign(surfElem.size()+1, 0);
+    for(unsigned long l=0; l<surfElem.size(); ++l) {
+      const unsigned short ind = surfElem[l].indStandardElement;
+      prefixResBoundaryFaces[iMarker][l+1] = prefixResBoundaryFaces[iMarker][l]
+                                           + standardBoundaryFacesSol[ind].GetNDOFsFace();
+      if( symmetrizingTermsPresent )
+        prefixResBoundaryFaces[iMarker][l+1] += standardBoundaryFacesSol[ind].GetNDOFsElem();
+    }
+  }
+
   /* Check whether an ADER space-time step must be carried out.
      When only a spatial Jacobian is computed this is false per definition.  */
   if( (config->GetKind_TimeIntScheme_Flow() == ADER_DG) &&
@@ -3227,9 +3260,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3253,9 +3286,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3713,8 +3746,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3745,8 +3778,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3857,311 +3890,329 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   /* Easier storage of the number of time levels.. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
+  /* Flag, which indicates whether or not the completion of a non-blocking
+     communication succeeded. The communication is carried out by the master
+     thread only, hence this flag is shared by all threads. */
+  bool commCompleted = false;
+
+  /*--- All OpenMP threads traverse the task list in the same order. The work
+        of a computational task is distributed over the threads inside the
+        function that carries out the task, which also synchronizes the threads
+        at its end. The MPI communication is carried out by the master thread. ---*/
+  SU2_OMP_PARALLEL
+  {
+    /* Numerics objects of this thread. */
+    CNumerics **numericsThread = numerics + omp_get_thread_num()*MAX_TERMS;
+
+    /* Define and initialize the bool vector, that indicates whether or
+       not the tasks from the list have been completed. */
+    vector<bool> taskCompleted(tasksList.size(), false);
+
+    /* Allocate the memory for the work array and initialize it to zero to avoid
+       warnings in debug mode  about uninitialized memory when padding is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    /* While loop to carry out all the tasks in tasksList. */
+    unsigned long lowestIndexInList = 0;
+    while(lowestIndexInList < tasksList.size()) {
+
+      /* Find the next task that can be carried out. The outer loop is there
+         to make sure that a communication is completed in case there are no
+         other tasks */
+      for(unsigned short j=0; j<2; ++j) {
+        bool taskCarriedOut = false;
+        for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+
+          /* Determine whether or not it can be attempted to carry out
+             this task. */
+          bool taskCanBeCarriedOut = !taskCompleted[i];
+          for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+            if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
+              taskCanBeCarriedOut = false;
+          }
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
+          if( taskCanBeCarriedOut ) {
 
-        if( taskCanBeCarriedOut ) {
+            /*--- Determine the actual task to be carried out and do so. The
+                  only tasks that may fail are the completion of the non-blocking
+                  communication. If that is the case the next task needs to be
+                  found. ---*/
+            switch( tasksList[i].task ) {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+              case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+                /* Carry out the ADER predictor step for the elements whose
+                   solution must be communicated for this time level. */
+                const unsigned short level   = tasksList[i].timeLevel;
+                const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                             + nVolElemInternalPerTimeLevel[level];
+                const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+                ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+                /* Carry out the ADER predictor step for the elements whose
+                   solution must not be communicated for this time level. */
+                const unsigned short level   = tasksList[i].timeLevel;
+                const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+                const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                             + nVolElemInternalPerTimeLevel[level];
+                ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+                /* Start the MPI communication of the solution in the halo elements. */
+                SU2_OMP_SAFE_GLOBAL_ACCESS(Initiate_MPI_Communication(config, tasksList[i].timeLevel);)
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
+
+                /* Attempt to complete the MPI communication of the solution data.
+                   For j==0, SU2_MPI::Testall will be used, which returns false if
+                   not all requests can be completed. In that case the next task on
+                   the list is carried out. If j==1, this means that the next
+                   tasks are waiting for this communication to be completed and
+                   hence MPI_Waitall is used. */
+                SU2_OMP_SAFE_GLOBAL_ACCESS(
+                  commCompleted = Complete_MPI_Communication(config, tasksList[i].timeLevel, j==1);)
+                if( commCompleted )
+                  taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
+              case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
+                /* Start the communication of the residuals, for which the
+                   reverse communication must be used. */
+                SU2_OMP_SAFE_GLOBAL_ACCESS(Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);)
                 taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                break;
+              }
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+              case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+
+                /* Attempt to complete the MPI communication of the residual data.
+                   For j==0, SU2_MPI::Testall will be used, which returns false if
+                   not all requests can be completed. In that case the next task on
+                   the list is carried out. If j==1, this means that the next
+                   tasks are waiting for this communication to be completed and
+                   hence MPI_Waitall is used. */
+                SU2_OMP_SAFE_GLOBAL_ACCESS(
+                  commCompleted = Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel, j==1);)
+                if( commCompleted )
+                  taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+                /* Interpolate the predictor solution of the owned elements
+                   in time to the given time integration point for the
+                   given time level. */
+                const unsigned short level = tasksList[i].timeLevel;
+                unsigned long nAdjElem = 0, *adjElem = nullptr;
+                if(level < (nTimeLevels-1)) {
+                  nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+                  adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+                }
 
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
+                ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                                    nVolElemOwnedPerTimeLevel[level],
+                                                    nVolElemOwnedPerTimeLevel[level+1],
+                                                    nAdjElem, adjElem,
+                                                    tasksList[i].secondPartTimeIntADER,
+                                                    VecWorkSolDOFs[level].data());
                 taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
-
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+                break;
               }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+                /* Interpolate the predictor solution of the halo elements
+                   in time to the given time integration point for the
+                   given time level. */
+                const unsigned short level = tasksList[i].timeLevel;
+                unsigned long nAdjElem = 0, *adjElem = nullptr;
+                if(level < (nTimeLevels-1)) {
+                  nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+                  adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+                }
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+                ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                                    nVolElemHaloPerTimeLevel[level],
+                                                    nVolElemHaloPerTimeLevel[level+1],
+                                                    nAdjElem, adjElem,
+                                                    tasksList[i].secondPartTimeIntADER,
+                                                    VecWorkSolDOFs[level].data());
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
               }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
-
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+                const unsigned short level = tasksList[i].timeLevel;
+                Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                                   nVolElemOwnedPerTimeLevel[level+1], workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+              case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+                const unsigned short level = tasksList[i].timeLevel;
+                Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                                   nVolElemHaloPerTimeLevel[level+1], workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+              case CTaskDefinition::VOLUME_RESIDUAL: {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Compute the volume portion of the residual. ---*/
+                const unsigned short level = tasksList[i].timeLevel;
+                Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
+                                nVolElemOwnedPerTimeLevel[level+1], workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+              case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Compute the residual of the faces that only involve owned elements. */
+                const unsigned short level = tasksList[i].timeLevel;
+                unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+                ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                              nMatchingInternalFacesLocalElem[level+1],
+                              indResFaces, numericsThread[CONV_TERM], workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+              case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Compute the residual of the faces that involve a halo element. */
+                const unsigned short level = tasksList[i].timeLevel;
+                unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+                ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                              nMatchingInternalFacesWithHaloElem[level+1],
+                              indResFaces, numericsThread[CONV_TERM], workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+              case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Apply the boundary conditions that only depend on data
+                      of owned elements. ---*/
+                Boundary_Conditions(tasksList[i].timeLevel, config, numericsThread, false,
+                                    workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+              case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Apply the boundary conditions that also depend on data
+                      of halo elements. ---*/
+                Boundary_Conditions(tasksList[i].timeLevel, config, numericsThread, true,
+                                    workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+              case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Create the final residual by summing up all contributions. */
+                CreateFinalResidual(tasksList[i].timeLevel, true);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+              case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Create the final residual by summing up all contributions. */
+                CreateFinalResidual(tasksList[i].timeLevel, false);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+              case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Accumulate the space time residuals for the owned elements
+                   for ADER-DG. */
+                AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
+                                                         tasksList[i].intPointADER);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+              case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /* Accumulate the space time residuals for the halo elements
+                   for ADER-DG. */
+                AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
+                                                        tasksList[i].intPointADER);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+              case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+                const unsigned short level = tasksList[i].timeLevel;
+                const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+                MultiplyResidualByInverseMassMatrix(config, useADER,
+                                                    nVolElemOwnedPerTimeLevel[level],
+                                                    nVolElemOwnedPerTimeLevel[level+1],
+                                                    workArray);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+              case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Perform the update step for ADER-DG. ---*/
+                const unsigned short level = tasksList[i].timeLevel;
+                ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                                  nVolElemOwnedPerTimeLevel[level+1]);
+                taskCarriedOut = taskCompleted[i] = true;
+                break;
+              }
 
-            default: {
+              default: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
+                cout << "Task not defined. This should not happen." << endl;
+                exit(1);
+              }
             }
           }
+
+          /* Break the inner loop if a task has been carried out. */
+          if( taskCarriedOut ) break;
         }
 
-        /* Break the inner loop if a task has been carried out. */
+        /* Break the outer loop if a task has been carried out. */
         if( taskCarriedOut ) break;
       }
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      /* Update the value of lowestIndexInList. */
+      for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+        if( !taskCompleted[lowestIndexInList] ) break;
     }
-
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4288,6 +4339,7 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
   /*--- the ADER scheme is only conditionally stable.                      ---*/
   /*--------------------------------------------------------------------------*/
 
+  SU2_OMP_FOR_DYN(OMP_ELEM_SIZE)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Easier storage of the number of spatial DOFs and the total
@@ -4753,6 +4805,7 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
         solADERPred[mm] = solPredTime[mm];
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig              *config,
@@ -4818,8 +4871,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5067,8 +5120,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5357,8 +5410,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5572,8 +5625,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5750,6 +5803,7 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
                                     + iTime*nTimeDOFs;
 
   /* Loop over the element range of this time level. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Determine the number of solution variables for this element and
@@ -5771,6 +5825,7 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
         solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
     }
   }
+  END_SU2_OMP_FOR
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 2: Interpolate the solution to the given integration point    ---*/
@@ -5791,6 +5846,7 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
   DOFToThisTimeInt = timeInterpolAdjDOFToIntegrationADER_DG + iiTime*nTimeDOFs;
 
   /* Loop over the adjacent elements. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=0; l<nAdjElem; ++l) {
     const unsigned long ll = adjElem[l];
 
@@ -5813,6 +5869,7 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
         solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_EulerSolver::Shock_Capturing_DG(CConfig             *config,
@@ -5857,19 +5914,23 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
      on the number of dimensions. */
   const unsigned short nMetricPerPoint = nDim*nDim + 1;
 
+  /*--- Determine the part of the element range that is treated by this thread. ---*/
+  unsigned long elemBegThread, elemEndThread;
+  ThreadRangeOfElem(elemBeg, elemEnd, nElemSimul, elemBegThread, elemEndThread);
+
   /*--- Loop over the given element range to compute the contribution of the
         volume integral in the DG FEM formulation to the residual. Multiple
         elements are treated simultaneously to improve the performance
         of the matrix multiplications. As a consequence, the update of the
         counter l happens at the end of this loop section. ---*/
-  for(unsigned long l=elemBeg; l<elemEnd;) {
+  for(unsigned long l=elemBegThread; l<elemEndThread;) {
 
     /* Determine the end index for this chunk of elements and the padded
        N value in the gemm computations. */
     unsigned long lEnd;
     unsigned short ind, llEnd, NPad;
 
-    MetaDataChunkOfElem(volElem, l, elemEnd, nElemSimul, nPadMin, lEnd, ind, llEnd, NPad);
+    MetaDataChunkOfElem(volElem, l, elemEndThread, nElemSimul, nPadMin, lEnd, ind, llEnd, NPad);
 
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
@@ -5959,8 +6020,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6054,8 +6115,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6208,6 +6269,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
        current chunk. */
     l = lEnd;
   }
+  SU2_OMP_BARRIER
 }
 
 void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
@@ -6216,6 +6278,10 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
                                               const bool           haloInfoNeededForBC,
                                               su2double            *workArray){
 
+  /* Determine the number of faces that are treated simultaneously
+     in the matrix products to obtain good gemm performance. */
+  const unsigned short nFaceSimul = config->GetSizeMatMulPadding()/nVar;
+
   /* Loop over all boundaries. */
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -6224,19 +6290,24 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
 
       /* Determine the range of faces for this time level and test if any
          surface element for this marker must be treated at all. */
-      const unsigned long surfElemBeg = boundaries[iMarker].nSurfElem[timeLevel];
-      const unsigned long surfElemEnd = boundaries[iMarker].nSurfElem[timeLevel+1];
+      const unsigned long surfElemBegLevel = boundaries[iMarker].nSurfElem[timeLevel];
+      const unsigned long surfElemEndLevel = boundaries[iMarker].nSurfElem[timeLevel+1];
 
-      if(surfElemEnd > surfElemBeg) {
+      /* Determine the part of this range that is treated by this thread. */
+      unsigned long surfElemBeg, surfElemEnd;
+      ThreadRangeOfElem(surfElemBegLevel, surfElemEndLevel, nFaceSimul, surfElemBeg, surfElemEnd);
 
-        /* Set the starting position in the vector for the face residuals for
-           this boundary marker and time level and set the pointer to the boundary
-           faces for this boundary marker. */
-        su2double *resFaces = VecResFaces.data()
-                            + nVar*startLocResFacesMarkers[iMarker][timeLevel];
+      if(surfElemEnd > surfElemBeg) {
 
+        /* Set the pointer to the boundary faces for this boundary marker and
+           the starting position in the vector for the face residuals for this
+           boundary marker, time level and thread. */
         const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
+        su2double *resFaces = VecResFaces.data()
+                            + nVar*(startLocResFacesMarkers[iMarker][timeLevel]
+                            +       SizeResidualBoundaryFaces(iMarker, surfElemBegLevel, surfElemBeg));
+
         /* Apply the appropriate boundary condition. */
         switch (config->GetMarker_All_KindBC(iMarker)) {
           case EULER_WALL:
@@ -6292,6 +6363,7 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
       }
     }
   }
+  SU2_OMP_BARRIER
 }
 
 void CFEM_DG_EulerSolver::ResidualFaces(CConfig             *config,
@@ -6310,18 +6382,23 @@ void CFEM_DG_EulerSolver::ResidualFaces(CConfig             *config,
      corresponds to 64 byte alignment. */
   const unsigned short nPadMin = 64/sizeof(passivedouble);
 
+  /*--- Determine the part of the face range that is treated by this thread. ---*/
+  unsigned long indFaceBegThread, indFaceEndThread;
+  ThreadRangeOfElem(indFaceBeg, indFaceEnd, nFaceSimul, indFaceBegThread, indFaceEndThread);
+  indResFaces += SizeResidualInternalFaces(indFaceBeg, indFaceBegThread);
+
   /*--- Loop over the requested range of matching faces. Multiple faces
         are treated simultaneously to improve the performance of the matrix
         multiplications. As a consequence, the update of the counter l
         happens at the end of this loop section. ---*/
-  for(unsigned long l=indFaceBeg; l<indFaceEnd;) {
+  for(unsigned long l=indFaceBegThread; l<indFaceEndThread;) {
 
     /* Determine the end index for this chunk of faces and the padded
        N value in the gemm computations. */
     unsigned long lEnd;
     unsigned short ind, llEnd, NPad;
 
-    MetaDataChunkOfElem(matchingInternalFaces, l, indFaceEnd, nFaceSimul,
+    MetaDataChunkOfElem(matchingInternalFaces, l, indFaceEndThread, nFaceSimul,
                         nPadMin, lEnd, ind, llEnd, NPad);
 
     /* Get the necessary data from the standard face. */
@@ -6412,6 +6489,7 @@ void CFEM_DG_EulerSolver::ResidualFaces(CConfig             *config,
        current chunk. */
     l = lEnd;
   }
+  SU2_OMP_BARRIER
 }
 
 void CFEM_DG_EulerSolver::InviscidFluxesInternalMatchingFace(
@@ -6576,6 +6654,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
   const unsigned long elemEndOwned = nVolElemOwnedPerTimeLevel[timeLevel+1];
 
   /* Add the residuals coming from the volume integral to VecTotResDOFsADER. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
     const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
     const su2double    *res     = VecResDOFs.data() + offset;
@@ -6584,9 +6663,11 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
     for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
       resADER[i] += halfWeight*res[i];
   }
+  END_SU2_OMP_FOR
 
   /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
      This part is from faces with the same time level as the element. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
     for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
       const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
@@ -6599,6 +6680,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
       }
     }
   }
+  END_SU2_OMP_FOR
 
   /* Check if this is not the last time level. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
@@ -6613,6 +6695,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
     const unsigned long nAdjElem = ownedElemAdjLowTimeLevel[timeLevel+1].size();
     const unsigned long *adjElem = ownedElemAdjLowTimeLevel[timeLevel+1].data();
 
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for(unsigned l=0; l<nAdjElem; ++l) {
       const unsigned long ll = adjElem[l];
       for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
@@ -6626,6 +6709,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
         }
       }
     }
+    END_SU2_OMP_FOR
   }
 }
 
@@ -6650,6 +6734,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
 
   /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
      This part is from faces with the same time level as the element. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBegHalo; l<elemEndHalo; ++l) {
     for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
       const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
@@ -6662,6 +6747,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
       }
     }
   }
+  END_SU2_OMP_FOR
 
   /* Check if this is not the last time level. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
@@ -6676,6 +6762,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
     const unsigned long nAdjElem = haloElemAdjLowTimeLevel[timeLevel+1].size();
     const unsigned long *adjElem = haloElemAdjLowTimeLevel[timeLevel+1].data();
 
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for(unsigned l=0; l<nAdjElem; ++l) {
       const unsigned long ll = adjElem[l];
       for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
@@ -6689,6 +6776,7 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
         }
       }
     }
+    END_SU2_OMP_FOR
   }
 }
 
@@ -6710,14 +6798,17 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
   /* For the halo elements the residual is initialized to zero. */
   if( !ownedElements ) {
 
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for(unsigned long l=elemStart; l<elemEnd; ++l) {
       su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
       for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
         resDOFsElem[i] = 0.0;
     }
+    END_SU2_OMP_FOR
   }
 
   /* Loop over the required element range. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemStart; l<elemEnd; ++l) {
 
     /* Loop over the DOFs of this element. */
@@ -6733,6 +6824,7 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
       }
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
@@ -6747,6 +6839,7 @@ void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
   vector<su2double> &VecRes = useADER ? VecTotResDOFsADER : VecResDOFs;
 
   /* Loop over the owned volume elements. */
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Easier storage of the residuals for this volume element. */
@@ -6778,6 +6871,7 @@ void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
                           volElem[l].invMassMatrix.data(), workArray, res, config);
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConfig* config) {
@@ -6960,8 +7054,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7013,8 +7107,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7484,6 +7578,7 @@ void CFEM_DG_EulerSolver::ADER_DG_Iteration(const unsigned long elemBeg,
 
   /*--- Update the solution by looping over the given range
         of volume elements. ---*/
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Set the pointers for the residual and solution for this element. */
@@ -7498,6 +7593,7 @@ void CFEM_DG_EulerSolver::ADER_DG_Iteration(const unsigned long elemBeg,
       res[i]      = 0.0;
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_EulerSolver::BoundaryStates_Euler_Wall(CConfig                  *config,
@@ -7619,9 +7715,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7727,9 +7823,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7791,11 +7887,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
 
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7822,9 +7918,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7854,10 +7950,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7905,10 +8001,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -8002,7 +8098,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -8017,7 +8113,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8068,11 +8164,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8147,11 +8243,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9368,11 +9464,13 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
       su2double Prim_L[8];
       su2double Prim_R[8];
 
-      Jacobian_i = new su2double*[nVar];
-      Jacobian_j = new su2double*[nVar];
+      /* Dummy Jacobians, which are local such that this function can
+         be called by multiple threads simultaneously. */
+      su2double jacDataI[5][5], jacDataJ[5][5];
+      su2double *jacI[5], *jacJ[5];
       for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
-        Jacobian_i[iVar] = new su2double[nVar];
-        Jacobian_j[iVar] = new su2double[nVar];
+        jacI[iVar] = jacDataI[iVar];
+        jacJ[iVar] = jacDataJ[iVar];
       }
 
       /* Loop over the number of faces treated simultaneously. */
@@ -9438,19 +9536,9 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
           /*--- Now simply call the ComputeResidual() function to calculate
            the flux using the chosen approximate Riemann solver. Note that
            the Jacobian arrays here are just dummies for now (no implicit). ---*/
-          numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
+          numerics->ComputeResidual(flux, jacI, jacJ, config);
         }
       }
-
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
-      }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
-
-      Jacobian_i = nullptr;
-      Jacobian_j = nullptr;
     }
   }
 }
@@ -9543,9 +9631,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
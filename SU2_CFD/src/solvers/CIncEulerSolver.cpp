@@ -32,6 +32,7 @@
 #include "../../include/fluid/CIncIdealGasPolynomial.hpp"
 #include "../../include/variables/CIncNSVariable.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/fluid/CFluidScalar.hpp"
 #include "../../include/fluid/CFluidFlamelet.hpp"
@@ -165,6 +166,7 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
+    Jacobian.SetFloatStorage(config->GetLinear_Solver_Float_Storage_Flow());
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
   }
   else {
@@ -1017,11 +1019,18 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
+    /*--- Green-Gauss gradients and limiters can be computed in a single pass. ---*/
+
+    const bool fusedLimiter = limiter && !van_albada && config->GetFusedGradientLimiter() &&
+                              (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
+        if (fusedLimiter) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+        else SetPrimitive_Gradient_GG(geometry, config, true);
+        break;
       case LEAST_SQUARES:
       case WEIGHTED_LEAST_SQUARES:
         SetPrimitive_Gradient_LS(geometry, config, true); break;
@@ -1030,26 +1039,30 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Limiter computation ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    if (limiter && !van_albada && !fusedLimiter) SetPrimitive_Limiter(geometry, config);
   }
 }
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0;
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The thermodynamic state is evaluated for batches of points. ---*/
+
+  constexpr auto batchSize = CFluidModel::BatchSize;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint += batchSize) {
 
     /*--- Incompressible flow, primitive variables ---*/
 
-    auto physical = nodes->SetPrimVar(iPoint,GetFluidModel());
+    const auto nPointBatch = static_cast<unsigned short>(min<unsigned long>(batchSize, nPoint - iPoint));
 
-    /* Check for non-realizable states for reporting. */
+    /* Count non-realizable states for reporting. */
 
-    if (!physical) nonPhysicalPoints++;
+    nonPhysicalPoints += nodes->SetPrimVarBatch(iPoint, nPointBatch, GetFluidModel());
   }
   END_SU2_OMP_FOR
 
@@ -1112,9 +1125,32 @@ void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contain
 
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes());
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme in use does not support vectorization, "
+                   "only FDS, JST, and LAX are vectorized for incompressible flows.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
+  if (UseEdgeNumerics(config)) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   unsigned long iPoint, jPoint;
@@ -1210,6 +1246,11 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  if (UseEdgeNumerics(config)) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
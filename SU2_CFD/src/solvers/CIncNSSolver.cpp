@@ -74,12 +74,21 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Green-Gauss gradients and limiters can be computed in a single pass. The limiters use the
+   *    reconstruction gradient, which is the primitive gradient if no separate one is required. ---*/
+
+  const bool limiterNeeded = muscl && !center && limiter && !van_albada && !Output;
+  const bool fusedLimiter = limiterNeeded && config->GetFusedGradientLimiter() &&
+                            (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
   /*--- Compute gradient for MUSCL reconstruction ---*/
 
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
+        if (fusedLimiter) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+        else SetPrimitive_Gradient_GG(geometry, config, true);
+        break;
       case LEAST_SQUARES:
       case WEIGHTED_LEAST_SQUARES:
         SetPrimitive_Gradient_LS(geometry, config, true); break;
@@ -90,7 +99,8 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   /*--- Compute gradient of the primitive variables ---*/
 
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+    if (fusedLimiter && !config->GetReconstructionGradientRequired()) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+    else SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     SetPrimitive_Gradient_LS(geometry, config);
@@ -98,7 +108,7 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (limiterNeeded && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
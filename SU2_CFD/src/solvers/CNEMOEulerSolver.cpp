@@ -133,6 +133,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
+    Jacobian.SetFloatStorage(config->GetLinear_Solver_Float_Storage_Flow());
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
   }
   else {
@@ -82,6 +82,13 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Green-Gauss gradients and limiters can be computed in a single pass. The limiters use the
+   *    reconstruction gradient, which is the primitive gradient if no separate one is required. ---*/
+
+  const bool limiterNeeded = muscl && !center && limiter && !van_albada && !Output;
+  const bool fusedLimiter = limiterNeeded && config->GetFusedGradientLimiter() &&
+                            (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+
   /*--- Compute gradient for MUSCL reconstruction, for output (i.e. the
    turbulence solver, and post) only temperature and velocity are needed ---*/
 
@@ -91,7 +98,9 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
+        if (fusedLimiter) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+        else SetPrimitive_Gradient_GG(geometry, config, true);
+        break;
       case LEAST_SQUARES:
       case WEIGHTED_LEAST_SQUARES:
         SetPrimitive_Gradient_LS(geometry, config, true); break;
@@ -102,7 +111,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   /*--- Compute gradient of the primitive variables ---*/
 
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+    if (fusedLimiter && !config->GetReconstructionGradientRequired()) SetPrimitive_Gradient_GG_Limiter(geometry, config);
+    else SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     SetPrimitive_Gradient_LS(geometry, config);
@@ -112,7 +122,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (limiterNeeded && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
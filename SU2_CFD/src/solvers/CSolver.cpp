@@ -1352,6 +1352,10 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       COUNT_PER_POINT  = nPrimVarGrad;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER:
+      COUNT_PER_POINT  = nPrimVarGrad*(nDim+1);
+      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      break;
     case MPI_QUANTITIES::SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
@@ -1392,13 +1396,15 @@ namespace CommHelpers {
       case MPI_QUANTITIES::SOLUTION_GRAD_REC: return nodes->GetGradient_Reconstruction();
       case MPI_QUANTITIES::PRIMITIVE_GRADIENT: return nodes->GetGradient_Primitive();
       case MPI_QUANTITIES::PRIMITIVE_GRAD_REC: return nodes->GetGradient_Reconstruction();
+      case MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER: return nodes->GetGradient_Reconstruction();
       case MPI_QUANTITIES::AUXVAR_GRADIENT: return nodes->GetAuxVarGradient();
       default: return nodes->GetGradient();
     }
   }
 
   su2activematrix& selectLimiter(CVariable* nodes, MPI_QUANTITIES commType) {
-    if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
+    if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER ||
+        commType == MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
 }
@@ -1421,16 +1427,38 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
-  /*--- Check to make sure we have created a large enough buffer
-   for these comms during preprocessing. This is only for the su2double
-   buffer. It will be reallocated whenever we find a larger count
-   per point. After the first cycle of comms, this should be inactive. ---*/
+  /*--- A pending deferred exchange of the same quantity is completed first. ---*/
+
+  if (deferredComms.pending && commType == deferredComms.commType) CompleteDeferredComms(geometry, config);
 
-  geometry->AllocateP2PComms(COUNT_PER_POINT);
+  /*--- A deferred exchange uses its own buffers (see DeferNextComms). ---*/
+
+  const bool deferred = deferredComms.requested && commType == deferredComms.requestedType;
+
+  if (deferred) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      deferredComms.requested = false;
+      deferredComms.pending = true;
+      deferredComms.commType = commType;
+      deferredComms.bufSend.resize(COUNT_PER_POINT * geometry->nPoint_P2PSend[geometry->nP2PSend]);
+      deferredComms.bufRecv.resize(COUNT_PER_POINT * geometry->nPoint_P2PRecv[geometry->nP2PRecv]);
+      deferredComms.reqSend.resize(geometry->nP2PSend);
+      deferredComms.reqRecv.resize(geometry->nP2PRecv);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  } else {
+
+    /*--- Check to make sure we have created a large enough buffer
+     for these comms during preprocessing. This is only for the su2double
+     buffer. It will be reallocated whenever we find a larger count
+     per point. After the first cycle of comms, this should be inactive. ---*/
+
+    geometry->AllocateP2PComms(COUNT_PER_POINT);
+  }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDSend = geometry->bufD_P2PSend;
+  su2double *bufDSend = deferred ? deferredComms.bufSend.data() : geometry->bufD_P2PSend;
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1445,7 +1473,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
     /*--- Post all non-blocking recvs first before sends. ---*/
 
-    geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
+    if (deferred) PostDeferredRecvs(geometry, COUNT_PER_POINT);
+    else geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
 
     for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
 
@@ -1507,6 +1536,13 @@ void CSolver::InitiateComms(CGeometry *geometry,
               for (iDim = 0; iDim < nDim; iDim++)
                 bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
             break;
+          case MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++)
+                bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+              bufDSend[buf_offset+nPrimVarGrad*nDim+iVar] = limiter(iPoint, iVar);
+            }
+            break;
           case MPI_QUANTITIES::SOLUTION_FEA:
             for (iVar = 0; iVar < nVar; iVar++) {
               bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
@@ -1538,7 +1574,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
       /*--- Launch the point-to-point MPI send for this message. ---*/
 
-      geometry->PostP2PSends(geometry, config, MPI_TYPE, COUNT_PER_POINT, iMessage, false);
+      if (deferred) PostDeferredSend(geometry, COUNT_PER_POINT, iMessage);
+      else geometry->PostP2PSends(geometry, config, MPI_TYPE, COUNT_PER_POINT, iMessage, false);
 
     }
   }
@@ -1556,18 +1593,24 @@ void CSolver::CompleteComms(CGeometry *geometry,
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE = 0;
 
-  int ind, source, iMessage, jRecv;
+  int source, iMessage, jRecv;
 
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
+  /*--- A deferred exchange is only completed by CompleteDeferredComms. ---*/
+
+  if (deferredComms.pending && !deferredComms.completing && commType == deferredComms.commType) return;
+
+  const bool deferred = deferredComms.completing;
+
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
+  const su2double *bufDRecv = nullptr;
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1585,7 +1628,15 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+        if (deferred) {
+          int ind;
+          SU2_MPI::Waitany(geometry->nP2PRecv, deferredComms.reqRecv.data(), &ind, &status);
+        } else {
+          geometry->WaitAnyP2PRecv(iMessage, MPI_TYPE, COUNT_PER_POINT, false, status);
+        }
+      }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -1604,6 +1655,12 @@ void CSolver::CompleteComms(CGeometry *geometry,
       nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
                geometry->nPoint_P2PRecv[jRecv]);
 
+      /*--- Get the start of this message, the data of neighbors on the same
+       node may be read directly from their shared buffer. ---*/
+
+      bufDRecv = deferred ? deferredComms.bufRecv.data() + COUNT_PER_POINT * msg_offset
+                          : geometry->GetP2PRecvBuffer(jRecv, COUNT_PER_POINT);
+
       SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
       for (iRecv = 0; iRecv < nRecv; iRecv++) {
 
@@ -1611,9 +1668,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-        /*--- Compute the offset in the recv buffer for this point. ---*/
+        /*--- Compute the offset in the message for this point. ---*/
 
-        buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
+        buf_offset = iRecv*COUNT_PER_POINT;
 
         /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -1655,6 +1712,13 @@ void CSolver::CompleteComms(CGeometry *geometry,
               for (iDim = 0; iDim < nDim; iDim++)
                 gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
             break;
+          case MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++)
+                gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
+              limiter(iPoint,iVar) = bufDRecv[buf_offset+nPrimVarGrad*nDim+iVar];
+            }
+            break;
           case MPI_QUANTITIES::SOLUTION_FEA:
             for (iVar = 0; iVar < nVar; iVar++) {
               base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
@@ -1690,12 +1754,67 @@ void CSolver::CompleteComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
+    auto* reqSend = deferred ? deferredComms.reqSend.data() : geometry->req_P2PSend;
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, reqSend, MPI_STATUS_IGNORE);)
 #endif
   }
 
 }
 
+void CSolver::DeferNextComms(MPI_QUANTITIES commType) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    deferredComms.requested = true;
+    deferredComms.requestedType = commType;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+void CSolver::CompleteDeferredComms(CGeometry *geometry, const CConfig *config) {
+  if (!deferredComms.pending) return;
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(deferredComms.completing = true;)
+
+  CompleteComms(geometry, config, deferredComms.commType);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    deferredComms.pending = false;
+    deferredComms.completing = false;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+void CSolver::PostDeferredRecvs(const CGeometry *geometry, unsigned short countPerPoint) {
+
+  /*--- Plain messages, with tags that differ from those of the comms of the geometry,
+   since those may be posted while the deferred exchange is in flight. ---*/
+
+  SU2_OMP_MASTER
+  for (int iRecv = 0; iRecv < geometry->nP2PRecv; iRecv++) {
+    const auto offset = countPerPoint * geometry->nPoint_P2PRecv[iRecv];
+    const auto count = countPerPoint * (geometry->nPoint_P2PRecv[iRecv+1] - geometry->nPoint_P2PRecv[iRecv]);
+    const auto source = geometry->Neighbors_P2PRecv[iRecv];
+    const auto tag = size + source + 1;
+
+    SU2_MPI::Irecv(&deferredComms.bufRecv[offset], count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
+                   &deferredComms.reqRecv[iRecv]);
+  }
+  END_SU2_OMP_MASTER
+}
+
+void CSolver::PostDeferredSend(const CGeometry *geometry, unsigned short countPerPoint, int iSend) {
+
+  SU2_OMP_MASTER {
+    const auto offset = countPerPoint * geometry->nPoint_P2PSend[iSend];
+    const auto count = countPerPoint * (geometry->nPoint_P2PSend[iSend+1] - geometry->nPoint_P2PSend[iSend]);
+    const auto dest = geometry->Neighbors_P2PSend[iSend];
+    const auto tag = size + rank + 1;
+
+    SU2_MPI::Isend(&deferredComms.bufSend[offset], count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
+                   &deferredComms.reqSend[iSend]);
+  }
+  END_SU2_OMP_MASTER
+}
+
 void CSolver::ResetCFLAdapt() {
   NonLinRes_Series.clear();
   Old_Func = 0;
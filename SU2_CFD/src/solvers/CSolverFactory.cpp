@@ -332,9 +332,17 @@ CSolver* CSolverFactory::CreateSubSolver(SUB_SOLVER_TYPE kindSolver, CSolver **s
       break;
   }
 
-  if (genericSolver != nullptr)
+  if (genericSolver != nullptr) {
     allocatedSolvers[genericSolver] = metaData;
 
+    /*--- The solver name (e.g. "C.FLOW") and the multigrid level identify the linear system. ---*/
+    string systemName = genericSolver->GetSolverName();
+    for (auto& c : systemName)
+      if (!isalnum(static_cast<unsigned char>(c))) c = '_';
+    if (iMGLevel != MESH_0) systemName += "_mg" + to_string(iMGLevel);
+    genericSolver->SetLinearSystemName(systemName);
+  }
+
   return genericSolver;
 
 }
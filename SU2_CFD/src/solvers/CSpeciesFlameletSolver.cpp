@@ -71,7 +71,6 @@ void CSpeciesFlameletSolver::Preprocessing(CGeometry* geometry, CSolver** solver
                                            unsigned short iMesh, unsigned short iRKStep,
                                            unsigned short RunTime_EqSystem, bool Output) {
   unsigned long n_not_in_domain_local = 0, n_not_in_domain_global = 0;
-  vector<su2double> scalars_vector(nVar);
   unsigned long spark_iter_start, spark_duration;
   bool ignition = false;
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
@@ -87,44 +86,54 @@ void CSpeciesFlameletSolver::Preprocessing(CGeometry* geometry, CSolver** solver
 
   SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetGlobalParam(config->GetKind_Solver(), RunTime_EqSystem);)
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto i_point = 0u; i_point < nPoint; i_point++) {
+  /*--- The manifold is queried for batches of points, which lets the MLPs evaluate each layer for all the points
+   *    of a batch with one matrix product. ---*/
+
+  constexpr auto batchSize = CFluidModel::BatchSize;
+  su2activematrix scalars_batch(nVar, batchSize);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long i_begin = 0; i_begin < nPoint; i_begin += batchSize) {
+    const auto n_batch = static_cast<unsigned short>(min<unsigned long>(batchSize, nPoint - i_begin));
     CFluidModel* fluid_model_local = solver_container[FLOW_SOL]->GetFluidModel();
-    su2double* scalars = nodes->GetSolution(i_point);
-    for (auto iVar = 0u; iVar < nVar; iVar++) scalars_vector[iVar] = scalars[iVar];
+
+    for (unsigned short k = 0; k < n_batch; ++k)
+      for (auto iVar = 0u; iVar < nVar; iVar++) scalars_batch(iVar, k) = nodes->GetSolution(i_begin + k, iVar);
 
     /*--- Compute total source terms from the production and consumption. ---*/
-    unsigned long misses = SetScalarSources(config, fluid_model_local, i_point, scalars_vector);
-
-    if (ignition) {
-      /*--- Apply source terms within spark radius. ---*/
-      su2double dist_from_center = 0,
-                spark_radius = flamelet_config_options.spark_init[3];
-      dist_from_center = GeometryToolbox::SquaredDistance(nDim, geometry->nodes->GetCoord(i_point), flamelet_config_options.spark_init.data());
-      if (dist_from_center < pow(spark_radius,2)) {
-        for (auto iVar = 0u; iVar < nVar; iVar++)
-          nodes->SetScalarSource(i_point, iVar, nodes->GetScalarSources(i_point)[iVar] + flamelet_config_options.spark_reaction_rates[iVar]);
-      }
-    }
+    n_not_in_domain_local += SetScalarSources(config, fluid_model_local, i_begin, n_batch, scalars_batch);
 
-    nodes->SetTableMisses(i_point, misses);
-    n_not_in_domain_local += misses;
     /*--- Obtain passive look-up scalars. ---*/
-    SetScalarLookUps(fluid_model_local, i_point, scalars_vector);
-
-    /*--- Set mass diffusivity based on thermodynamic state. ---*/
-    auto T = flowNodes->GetTemperature(i_point);
-    fluid_model_local->SetTDState_T(T, scalars);
-    /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
-    for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
-      nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
-    }
+    SetScalarLookUps(fluid_model_local, i_begin, n_batch, scalars_batch);
 
     /*--- Obtain preferential diffusion scalar values. ---*/
     if (flamelet_config_options.preferential_diffusion)
-      SetPreferentialDiffusionScalars(fluid_model_local, i_point, scalars_vector);
+      SetPreferentialDiffusionScalars(fluid_model_local, i_begin, n_batch, scalars_batch);
+
+    for (auto i_point = i_begin; i_point < i_begin + n_batch; i_point++) {
+      su2double* scalars = nodes->GetSolution(i_point);
+
+      if (ignition) {
+        /*--- Apply source terms within spark radius. ---*/
+        su2double dist_from_center = 0,
+                  spark_radius = flamelet_config_options.spark_init[3];
+        dist_from_center = GeometryToolbox::SquaredDistance(nDim, geometry->nodes->GetCoord(i_point), flamelet_config_options.spark_init.data());
+        if (dist_from_center < pow(spark_radius,2)) {
+          for (auto iVar = 0u; iVar < nVar; iVar++)
+            nodes->SetScalarSource(i_point, iVar, nodes->GetScalarSources(i_point)[iVar] + flamelet_config_options.spark_reaction_rates[iVar]);
+        }
+      }
 
-    if (!Output) LinSysRes.SetBlock_Zero(i_point);
+      /*--- Set mass diffusivity based on thermodynamic state. ---*/
+      auto T = flowNodes->GetTemperature(i_point);
+      fluid_model_local->SetTDState_T(T, scalars);
+      /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
+      for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
+        nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
+      }
+
+      if (!Output) LinSysRes.SetBlock_Zero(i_point);
+    }
   }
   END_SU2_OMP_FOR
   /* --- Sum up some global counters over processes. --- */
@@ -511,62 +520,76 @@ void CSpeciesFlameletSolver::BC_ConjugateHeat_Interface(CGeometry* geometry, CSo
 }
 
 unsigned long CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
+                                                       unsigned long iPointBegin, unsigned short nPointBatch,
+                                                       const su2activematrix& scalars) {
   /*--- Compute total source terms from the production and consumption. ---*/
 
-  vector<su2double> table_sources(flamelet_config_options.n_control_vars + 2 * flamelet_config_options.n_user_scalars);
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::SOURCES, table_sources);
-  table_sources[I_PROGVAR] = fmax(0, table_sources[I_PROGVAR]);
-  nodes->SetTableMisses(iPoint, misses);
-
-  /*--- The source term for progress variable is always positive, we clip from below to makes sure. --- */
-
-  vector<su2double> source_scalar(flamelet_config_options.n_scalars);
-  for (auto iCV = 0u; iCV < flamelet_config_options.n_control_vars; iCV++) source_scalar[iCV] = table_sources[iCV];
-
-  /*--- Source term for the auxiliary species transport equations. ---*/
-  for (size_t i_aux = 0; i_aux < flamelet_config_options.n_user_scalars; i_aux++) {
-    /*--- The source term for the auxiliary equations consists of a production term and a consumption term:
-          S_TOT = S_PROD + S_CONS * Y ---*/
-    su2double y_aux = scalars[flamelet_config_options.n_control_vars + i_aux];
-    su2double source_prod = table_sources[flamelet_config_options.n_control_vars + 2 * i_aux];
-    su2double source_cons = table_sources[flamelet_config_options.n_control_vars + 2 * i_aux + 1];
-    source_scalar[flamelet_config_options.n_control_vars + i_aux] = source_prod + source_cons * y_aux;
+  const auto n_control_vars = flamelet_config_options.n_control_vars;
+  su2activematrix table_sources(n_control_vars + 2 * flamelet_config_options.n_user_scalars, CFluidModel::BatchSize);
+  unsigned long misses[CFluidModel::BatchSize];
+  const auto n_misses = fluid_model_local->EvaluateDataSetBatch(nPointBatch, scalars, FLAMELET_LOOKUP_OPS::SOURCES,
+                                                                table_sources, misses);
+
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    const auto iPoint = iPointBegin + k;
+    nodes->SetTableMisses(iPoint, misses[k]);
+
+    /*--- The source term for progress variable is always positive, we clip from below to makes sure. --- */
+
+    table_sources(I_PROGVAR, k) = fmax(0, table_sources(I_PROGVAR, k));
+    for (auto iCV = 0u; iCV < n_control_vars; iCV++) nodes->SetScalarSource(iPoint, iCV, table_sources(iCV, k));
+
+    /*--- Source term for the auxiliary species transport equations. ---*/
+    for (size_t i_aux = 0; i_aux < flamelet_config_options.n_user_scalars; i_aux++) {
+      /*--- The source term for the auxiliary equations consists of a production term and a consumption term:
+            S_TOT = S_PROD + S_CONS * Y ---*/
+      su2double y_aux = scalars(n_control_vars + i_aux, k);
+      su2double source_prod = table_sources(n_control_vars + 2 * i_aux, k);
+      su2double source_cons = table_sources(n_control_vars + 2 * i_aux + 1, k);
+      nodes->SetScalarSource(iPoint, n_control_vars + i_aux, source_prod + source_cons * y_aux);
+    }
   }
-  for (auto i_scalar = 0u; i_scalar < nVar; i_scalar++)
-    nodes->SetScalarSource(iPoint, i_scalar, source_scalar[i_scalar]);
-  return misses;
+  return n_misses;
 }
 
-unsigned long CSpeciesFlameletSolver::SetScalarLookUps(CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
+unsigned long CSpeciesFlameletSolver::SetScalarLookUps(CFluidModel* fluid_model_local, unsigned long iPointBegin,
+                                                       unsigned short nPointBatch, const su2activematrix& scalars) {
   /*--- Retrieve the passive look-up variables from the manifold. ---*/
-  unsigned long misses{0};
+  unsigned long n_misses{0};
   /*--- Skip if no passive look-ups are listed ---*/
   if (flamelet_config_options.n_lookups > 0) {
-    vector<su2double> lookup_scalar(flamelet_config_options.n_lookups);
-    misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::LOOKUP, lookup_scalar);
-
-    for (auto i_lookup = 0u; i_lookup < flamelet_config_options.n_lookups; i_lookup++) {
-      nodes->SetLookupScalar(iPoint, lookup_scalar[i_lookup], i_lookup);
+    su2activematrix lookup_scalar(flamelet_config_options.n_lookups, CFluidModel::BatchSize);
+    unsigned long misses[CFluidModel::BatchSize];
+    n_misses = fluid_model_local->EvaluateDataSetBatch(nPointBatch, scalars, FLAMELET_LOOKUP_OPS::LOOKUP,
+                                                       lookup_scalar, misses);
+
+    for (unsigned short k = 0; k < nPointBatch; ++k) {
+      for (auto i_lookup = 0u; i_lookup < flamelet_config_options.n_lookups; i_lookup++) {
+        nodes->SetLookupScalar(iPointBegin + k, lookup_scalar(i_lookup, k), i_lookup);
+      }
     }
   }
 
-  return misses;
+  return n_misses;
 }
 
 unsigned long CSpeciesFlameletSolver::SetPreferentialDiffusionScalars(CFluidModel* fluid_model_local,
-                                                                      unsigned long iPoint,
-                                                                      const vector<su2double>& scalars) {
+                                                                      unsigned long iPointBegin,
+                                                                      unsigned short nPointBatch,
+                                                                      const su2activematrix& scalars) {
   /*--- Retrieve the preferential diffusion scalar values from the manifold. ---*/
 
-  vector<su2double> beta_scalar(FLAMELET_PREF_DIFF_SCALARS::N_BETA_TERMS);
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::PREFDIF, beta_scalar);
+  su2activematrix beta_scalar(FLAMELET_PREF_DIFF_SCALARS::N_BETA_TERMS, CFluidModel::BatchSize);
+  unsigned long misses[CFluidModel::BatchSize];
+  const auto n_misses = fluid_model_local->EvaluateDataSetBatch(nPointBatch, scalars, FLAMELET_LOOKUP_OPS::PREFDIF,
+                                                                beta_scalar, misses);
 
-  for (auto i_beta = 0u; i_beta < FLAMELET_PREF_DIFF_SCALARS::N_BETA_TERMS; i_beta++) {
-    nodes->SetAuxVar(iPoint, i_beta, beta_scalar[i_beta]);
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    for (auto i_beta = 0u; i_beta < FLAMELET_PREF_DIFF_SCALARS::N_BETA_TERMS; i_beta++) {
+      nodes->SetAuxVar(iPointBegin + k, i_beta, beta_scalar(i_beta, k));
+    }
   }
-  return misses;
+  return n_misses;
 }
 
 void CSpeciesFlameletSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
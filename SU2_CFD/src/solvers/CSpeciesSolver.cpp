@@ -326,6 +326,18 @@ void CSpeciesSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+void CSpeciesSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+  /*--- Only the transport of species mass fractions is vectorized (not the flamelet model). ---*/
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, MESH_0, SPECIES_SOL,
+                                                     solver_container[FLOW_SOL]->GetnPrimVarGrad(),
+                                                     solver_container[FLOW_SOL]->GetNodes());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CSpeciesSolver::BC_Inlet(CGeometry* geometry, CSolver** solver_container, CNumerics* conv_numerics,
                               CNumerics* visc_numerics, CConfig* config, unsigned short val_marker) {
 
@@ -28,6 +28,7 @@
 #include "../../include/solvers/CTurbSASolver.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -68,6 +69,7 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SA model)." << endl;
+    Jacobian.SetFloatStorage(config->GetLinear_Solver_Float_Storage_Turb());
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
@@ -369,6 +371,19 @@ void CTurbSASolver::Viscous_Residual(const unsigned long iEdge, const CGeometry*
   }
 }
 
+void CTurbSASolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+  /*--- The non-conservative part of the fluxes is stored separately with the reducer strategy. ---*/
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, MESH_0, TURB_SOL,
+                                                     solver_container[FLOW_SOL]->GetnPrimVarGrad(),
+                                                     solver_container[FLOW_SOL]->GetNodes(), nullptr,
+                                                     ReducerStrategy ? &EdgeFluxesDiff : nullptr);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                     CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
@@ -383,12 +398,23 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
+  /*--- Use the vectorized source terms if they support the model options (the factory is only tried once). ---*/
+  if (config->GetUseVectorization() && !sourceNumericsTried) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(
+      sourceNumerics = CSourceNumericsSIMD::CreateTurbSourceNumerics(*config, nDim, flowNodes);
+      sourceNumericsTried = true;)
+  }
+
   AD::StartNoSharedReading();
 
   /*--- Loop over all points. ---*/
 
+  /*--- With the vectorized source terms there are no points left for the scalar loop. ---*/
+  if (sourceNumerics) PointSourceResidual(geometry, config);
+  const auto nPointScalar = sourceNumerics ? 0ul : nPointDomain;
+
   SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  for (unsigned long iPoint = 0; iPoint < nPointScalar; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
 
@@ -43,6 +43,24 @@ CTurbSolver::~CTurbSolver() {
   for (auto& mat : SlidingState) {
     for (auto ptr : mat) delete [] ptr;
   }
+  delete sourceNumerics;
+}
+
+void CTurbSolver::PointSourceResidual(const CGeometry* geometry, const CConfig* config) {
+
+  /*--- Loop over groups of points, the chunk size is given in number of points. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, Double::Size))
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j*in;
+    }
+    sourceNumerics->ComputeResidual(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
 }
 
 void CTurbSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
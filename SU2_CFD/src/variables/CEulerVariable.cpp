@@ -141,6 +141,55 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+unsigned long CEulerVariable::SetPrimVarBatch(unsigned long iPointBegin, unsigned short nPointBatch,
+                                              CFluidModel *FluidModel) {
+
+  unsigned long nonPhysicalPoints = 0;
+
+  CFluidModel::TDStateBatch state;
+
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    const auto iPoint = iPointBegin + k;
+    SetVelocity(iPoint);   // Computes velocity and velocity^2
+    state.Density[k] = GetDensity(iPoint);
+    state.StaticEnergy[k] = GetEnergy(iPoint)-0.5*Velocity2(iPoint);
+  }
+
+  FluidModel->SetTDStateBatch_rhoe(nPointBatch, state);
+
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    const auto iPoint = iPointBegin + k;
+
+    bool check_dens  = SetDensity(iPoint);
+    bool check_press = SetPressure(iPoint, state.Pressure[k]);
+    bool check_sos   = SetSoundSpeed(iPoint, state.SoundSpeed2[k]);
+    bool check_temp  = SetTemperature(iPoint, state.Temperature[k]);
+
+    if (check_dens || check_press || check_sos || check_temp) {
+
+      /*--- The point-wise method reverts to the old solution. ---*/
+
+      SetPrimVar(iPoint, FluidModel);
+      SetSecondaryVar(iPoint, FluidModel);
+      nonPhysicalPoints++;
+      continue;
+    }
+
+    SetEnthalpy(iPoint); // Requires pressure computation.
+
+    SetdPdrho_e(iPoint, state.dPdrho_e[k]);
+    SetdPde_rho(iPoint, state.dPde_rho[k]);
+
+    /*--- Set look-up variables in case of data-driven fluid model ---*/
+    if (DataDrivenFluid) {
+      SetDataExtrapolation(iPoint, state.Extrapolation[k]);
+      SetEntropy(iPoint, state.Entropy[k]);
+    }
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
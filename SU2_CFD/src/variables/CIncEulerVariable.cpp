@@ -124,3 +124,45 @@ bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel
   return physical;
 
 }
+
+unsigned long CIncEulerVariable::SetPrimVarBatch(unsigned long iPointBegin, unsigned short nPointBatch,
+                                                 CFluidModel *FluidModel) {
+
+  unsigned long nonPhysicalPoints = 0;
+
+  CFluidModel::TDStateBatch state;
+
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    state.Temperature[k] = Solution(iPointBegin + k, nDim+1);
+  }
+
+  /*--- Use the fluid model to compute the new value of density. ---*/
+
+  FluidModel->SetTDStateBatch_T(nPointBatch, state);
+
+  for (unsigned short k = 0; k < nPointBatch; ++k) {
+    const auto iPoint = iPointBegin + k;
+
+    SetPressure(iPoint);
+    const auto check_temp = SetTemperature(iPoint, state.Temperature[k]);
+    const auto check_dens = SetDensity(iPoint, state.Density[k]);
+
+    if (check_dens || check_temp) {
+
+      /*--- The point-wise method reverts to the old solution. ---*/
+
+      SetPrimVar(iPoint, FluidModel);
+      nonPhysicalPoints++;
+      continue;
+    }
+
+    /*--- Set the value of the velocity and velocity^2 (requires density) ---*/
+
+    SetVelocity(iPoint);
+
+    SetSpecificHeatCp(iPoint, state.Cp[k]);
+    SetSpecificHeatCv(iPoint, state.Cv[k]);
+  }
+
+  return nonPhysicalPoints;
+}
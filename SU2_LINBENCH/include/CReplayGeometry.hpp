@@ -0,0 +1,58 @@
+/*!
+ * \file CReplayGeometry.hpp
+ * \brief Geometry (point adjacency and halo comms) of a linear system written by CSysSolve.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../Common/include/geometry/CGeometry.hpp"
+#include "../../Common/include/linear_algebra/CLinearSystemFile.hpp"
+
+/*!
+ * \class CReplayGeometry
+ * \brief Rows of a linear system written by CSysSolve (see CLinearSystemFile), re-partitioned in contiguous
+ *        ranges of global index over the ranks of the replay. The geometry has no coordinates or elements,
+ *        only the adjacency of the points, from which CSysMatrix builds its sparse patterns (including the
+ *        ILU fill-in), and the point-to-point communications of the halo points.
+ * \note The rows of the halo points couple them to the domain points but their values are zero, in the
+ *       original run they were assembled by the rank, they are not available to the replay.
+ */
+class CReplayGeometry final : public CGeometry {
+ public:
+  CLinearSystemFile::Header header;    /*!< \brief Header of the first file, with the settings of the original run. */
+  unsigned long nDroppedBlocks = 0;    /*!< \brief Blocks of columns that do not correspond to a row (e.g. periodic). */
+  vector<unsigned long> rowPtr;        /*!< \brief Start of the blocks of each domain row. */
+  vector<unsigned long> colInd;        /*!< \brief Local column index of the blocks. */
+  vector<double> values;               /*!< \brief Blocks, nVar x nEqn each. */
+  vector<double> rhs;                  /*!< \brief Right hand side of the domain rows. */
+
+  /*!
+   * \brief Read the files of the linear system and set up the partition of this rank.
+   * \param[in] prefix - Common part of the names of the files.
+   */
+  CReplayGeometry(const string& prefix);
+};
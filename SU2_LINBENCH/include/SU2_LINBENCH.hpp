@@ -0,0 +1,45 @@
+/*!
+ * \file SU2_LINBENCH.hpp
+ * \brief Headers of the main subroutines of the linear solver replay benchmark (SU2_LINBENCH).
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/parallelization/omp_structure.hpp"
+#include "CLI11.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../../Common/include/CConfig.hpp"
+#include "../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "CReplayGeometry.hpp"
+
+using namespace std;
@@ -0,0 +1,183 @@
+/*!
+ * \file CReplayGeometry.cpp
+ * \brief Reads the files of a linear system and re-partitions its rows for the replay.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/CReplayGeometry.hpp"
+
+CReplayGeometry::CReplayGeometry(const string& prefix) {
+  CLinearSystemFile file;
+  file.Read(CLinearSystemFile::FileName(prefix, 0), true);
+  header = file.header;
+
+  const auto blockSize = header.nVar * header.nEqn;
+  const unsigned long nPointGlobal = header.nPointGlobal;
+
+  /*--- Contiguous ranges of global index. ---*/
+  vector<unsigned long> rowBegin(size + 1);
+  for (int iRank = 0; iRank <= size; ++iRank) rowBegin[iRank] = nPointGlobal * iRank / size;
+  const auto begin = rowBegin[rank];
+  nPointDomain = rowBegin[rank + 1] - begin;
+
+  auto owner = [&](unsigned long iGlobal) {
+    return static_cast<int>(upper_bound(rowBegin.begin(), rowBegin.end(), iGlobal) - rowBegin.begin()) - 1;
+  };
+
+  /*--- Collect the rows of this rank from all files, the columns are global for now. ---*/
+  vector<vector<pair<unsigned long, unsigned long> > > rows(nPointDomain);
+  vector<double> blocks;
+  rhs.resize(nPointDomain * header.nVar);
+  unsigned long nRowsRead = 0;
+
+  for (int iFile = 0; iFile < header.size; ++iFile) {
+    file.Read(CLinearSystemFile::FileName(prefix, iFile));
+
+    if (file.header.nVar != header.nVar || file.header.nEqn != header.nEqn || file.header.size != header.size ||
+        file.header.nPointGlobal != nPointGlobal) {
+      SU2_MPI::Error("The linear system files " + prefix + "_*.dat are not from the same system.", CURRENT_FUNCTION);
+    }
+
+    for (auto iRow = 0ul; iRow < file.header.nPointDomain; ++iRow) {
+      const auto iGlobal = file.globalRow[iRow];
+      if (iGlobal < begin || iGlobal >= begin + nPointDomain) continue;
+      const auto iPoint = iGlobal - begin;
+      ++nRowsRead;
+
+      for (auto k = file.rowPtr[iRow]; k < file.rowPtr[iRow + 1]; ++k) {
+        if (file.globalCol[k] >= nPointGlobal) {
+          ++nDroppedBlocks;
+          continue;
+        }
+        rows[iPoint].emplace_back(file.globalCol[k], blocks.size() / blockSize);
+        blocks.insert(blocks.end(), &file.values[k * blockSize], &file.values[(k + 1) * blockSize]);
+      }
+      for (auto iVar = 0ul; iVar < header.nVar; ++iVar) {
+        rhs[iPoint * header.nVar + iVar] = file.rhs[iRow * header.nVar + iVar];
+      }
+    }
+  }
+
+  unsigned long nRowsTotal = 0;
+  SU2_MPI::Allreduce(&nRowsRead, &nRowsTotal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  if (nRowsTotal != nPointGlobal) {
+    SU2_MPI::Error("The linear system files " + prefix + "_*.dat do not contain all the rows.", CURRENT_FUNCTION);
+  }
+
+  /*--- Halo points are the columns owned by other ranks, numbered after the domain points in
+   *    ascending global index, which groups them by owner as required by the P2P comms. ---*/
+  vector<unsigned long> halo;
+  for (const auto& row : rows)
+    for (const auto& entry : row)
+      if (owner(entry.first) != rank) halo.push_back(entry.first);
+  sort(halo.begin(), halo.end());
+  halo.erase(unique(halo.begin(), halo.end()), halo.end());
+
+  nPoint = nPointDomain + halo.size();
+  Global_nPointDomain = nPointGlobal;
+
+  auto localIndex = [&](unsigned long iGlobal) {
+    if (owner(iGlobal) == rank) return iGlobal - begin;
+    return nPointDomain + (lower_bound(halo.begin(), halo.end(), iGlobal) - halo.begin());
+  };
+
+  /*--- Matrix values in local CSR format, and adjacency of the points (including the halos). ---*/
+  vector<vector<unsigned long> > adjacency(nPoint);
+  rowPtr.resize(nPointDomain + 1, 0);
+  colInd.clear();
+  values.clear();
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (const auto& entry : rows[iPoint]) {
+      const auto jPoint = localIndex(entry.first);
+      colInd.push_back(jPoint);
+      values.insert(values.end(), &blocks[entry.second * blockSize], &blocks[(entry.second + 1) * blockSize]);
+      if (jPoint == iPoint) continue;
+      adjacency[iPoint].push_back(jPoint);
+      if (jPoint >= nPointDomain) adjacency[jPoint].push_back(iPoint);
+    }
+    rowPtr[iPoint + 1] = colInd.size();
+  }
+  for (auto& neighbors : adjacency) {
+    sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  }
+
+  nodes = new CPoint(nPoint, 1);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) nodes->SetGlobalIndex(iPoint, begin + iPoint);
+  for (auto iHalo = 0ul; iHalo < halo.size(); ++iHalo) nodes->SetGlobalIndex(nPointDomain + iHalo, halo[iHalo]);
+  nodes->SetPoints(adjacency);
+
+  /*--- Point-to-point comms, the owners are told which of their points are needed. ---*/
+  vector<int> nRecvFrom(size, 0), nSendTo(size, 0);
+  for (const auto iGlobal : halo) ++nRecvFrom[owner(iGlobal)];
+
+  SU2_MPI::Alltoall(nRecvFrom.data(), 1, MPI_INT, nSendTo.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> recvDispl(size + 1, 0), sendDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    recvDispl[iRank + 1] = recvDispl[iRank] + nRecvFrom[iRank];
+    sendDispl[iRank + 1] = sendDispl[iRank] + nSendTo[iRank];
+  }
+  vector<unsigned long> sendGlobal(sendDispl[size]);
+
+  SU2_MPI::Alltoallv(halo.data(), nRecvFrom.data(), recvDispl.data(), MPI_UNSIGNED_LONG, sendGlobal.data(),
+                     nSendTo.data(), sendDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  nP2PSend = 0;
+  nP2PRecv = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (nSendTo[iRank] > 0) ++nP2PSend;
+    if (nRecvFrom[iRank] > 0) ++nP2PRecv;
+  }
+  nPoint_P2PSend = new int[nP2PSend + 1];
+  nPoint_P2PRecv = new int[nP2PRecv + 1];
+  Neighbors_P2PSend = new int[nP2PSend];
+  Neighbors_P2PRecv = new int[nP2PRecv];
+  nPoint_P2PSend[0] = 0;
+  nPoint_P2PRecv[0] = 0;
+
+  for (int iRank = 0, iSend = 0, iRecv = 0; iRank < size; ++iRank) {
+    if (nSendTo[iRank] > 0) {
+      Neighbors_P2PSend[iSend] = iRank;
+      P2PSend2Neighbor[iRank] = iSend;
+      nPoint_P2PSend[iSend + 1] = sendDispl[iRank + 1];
+      ++iSend;
+    }
+    if (nRecvFrom[iRank] > 0) {
+      Neighbors_P2PRecv[iRecv] = iRank;
+      P2PRecv2Neighbor[iRank] = iRecv;
+      nPoint_P2PRecv[iRecv + 1] = recvDispl[iRank + 1];
+      ++iRecv;
+    }
+  }
+
+  Local_Point_P2PSend = new unsigned long[sendGlobal.size()];
+  for (auto i = 0ul; i < sendGlobal.size(); ++i) Local_Point_P2PSend[i] = sendGlobal[i] - begin;
+
+  Local_Point_P2PRecv = new unsigned long[halo.size()];
+  for (auto i = 0ul; i < halo.size(); ++i) Local_Point_P2PRecv[i] = nPointDomain + i;
+
+  if (nP2PSend > 0) req_P2PSend = new SU2_MPI::Request[nP2PSend];
+  if (nP2PRecv > 0) req_P2PRecv = new SU2_MPI::Request[nP2PRecv];
+}
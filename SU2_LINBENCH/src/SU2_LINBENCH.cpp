@@ -0,0 +1,317 @@
+/*!
+ * \file SU2_LINBENCH.cpp
+ * \brief Main file of the linear solver replay benchmark (SU2_LINBENCH). Linear systems written by SU2_CFD
+ *        (LINEAR_SYSTEM_DUMP_ITER) are solved with combinations of linear solvers and preconditioners, for
+ *        different numbers of threads, to choose the settings of a case without running it.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define ENABLE_MAPS
+#include "../include/SU2_LINBENCH.hpp"
+
+namespace {
+
+using ScalarType = su2mixedfloat;
+
+/*!
+ * \brief Name of an enum in one of the option maps.
+ */
+template <class Map, class Enum>
+string OptionName(const Map& map, Enum value) {
+  for (const auto& item : map)
+    if (item.second == value) return item.first;
+  return "UNKNOWN";
+}
+
+/*!
+ * \brief Results of solving the system with one combination of settings.
+ */
+struct CReplayResult {
+  unsigned long iterations = 0;
+  passivedouble residual = 0.0;
+  passivedouble setupTime = 0.0; /*!< \brief Building the preconditioner. */
+  passivedouble solveTime = 0.0; /*!< \brief Solving the system (time to tolerance if converged). */
+  passivedouble spmvTime = 0.0;  /*!< \brief Of all the matrix-vector products of the bandwidth test. */
+};
+
+/*!
+ * \brief Solve the system with the settings in config, using the number of threads currently set.
+ */
+CReplayResult Replay(CReplayGeometry& geometry, const CConfig& config, unsigned long nSpMV) {
+  const auto& header = geometry.header;
+  const auto nPoint = geometry.GetnPoint();
+  const auto nPointDomain = geometry.GetnPointDomain();
+  const auto blockSize = header.nVar * header.nEqn;
+
+  CSysMatrix<ScalarType> Jacobian;
+  Jacobian.SetFloatStorage(config.GetLinear_Solver_Float_Storage_Flow());
+  Jacobian.Initialize(nPoint, nPointDomain, header.nVar, header.nEqn, true, &geometry, &config);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = geometry.rowPtr[iPoint]; k < geometry.rowPtr[iPoint + 1]; ++k) {
+      Jacobian.AddBlock(iPoint, geometry.colInd[k], &geometry.values[k * blockSize]);
+    }
+  }
+
+  CSysVector<ScalarType> LinSysRes(nPoint, nPointDomain, header.nVar, 0.0);
+  CSysVector<ScalarType> LinSysSol(nPoint, nPointDomain, header.nVar, 0.0);
+  CSysVector<ScalarType> LinSysTmp(nPoint, nPointDomain, header.nVar, 0.0);
+  for (auto i = 0ul; i < nPointDomain * header.nVar; ++i) LinSysRes[i] = geometry.rhs[i];
+
+  CSysSolve<ScalarType> System;
+  CReplayResult result;
+
+  const auto kindSolver = config.GetKind_Linear_Solver();
+  const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(config.GetKind_Linear_Solver_Prec());
+  const auto maxIter = config.GetLinear_Solver_Iter();
+  const ScalarType tol = SU2_TYPE::GetValue(config.GetLinear_Solver_Error());
+
+  SU2_OMP_PARALLEL {
+    auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, &geometry, &config);
+    auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, &geometry, &config);
+
+    SU2_OMP_BARRIER
+    const passivedouble start = SU2_MPI::Wtime();
+
+    precond->Build();
+
+    SU2_OMP_BARRIER
+    const passivedouble setup = SU2_MPI::Wtime();
+
+    ScalarType residual = 0.0;
+    unsigned long iter = 0;
+
+    switch (kindSolver) {
+      case BCGSTAB:
+        iter = System.BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      case FGMRES:
+        iter = System.FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      case RESTARTED_FGMRES:
+        iter = System.RFGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      case GCRO_DR:
+        iter = System.GCRODR_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      case CONJUGATE_GRADIENT:
+        iter = System.CG_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      case SMOOTHER:
+        iter =
+            System.Smoother_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, tol, maxIter, residual, false, &config);
+        break;
+      default:
+        SU2_MPI::Error("The linear solver cannot be replayed.", CURRENT_FUNCTION);
+    }
+
+    SU2_OMP_BARRIER
+    const passivedouble solve = SU2_MPI::Wtime();
+
+    /*--- Sustained bandwidth of the matrix-vector product (with halo comms). ---*/
+    for (auto iSpMV = 0ul; iSpMV < nSpMV; ++iSpMV) mat_vec(LinSysSol, LinSysTmp);
+
+    SU2_OMP_BARRIER
+    const passivedouble spmv = SU2_MPI::Wtime();
+
+    SU2_OMP_MASTER {
+      result.iterations = iter;
+      result.residual = SU2_TYPE::GetValue(residual);
+      result.setupTime = setup - start;
+      result.solveTime = solve - setup;
+      result.spmvTime = spmv - solve;
+    }
+    END_SU2_OMP_MASTER
+
+    delete precond;
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- The slowest rank determines the times. ---*/
+  passivedouble times[] = {result.setupTime, result.solveTime, result.spmvTime}, maxTimes[3];
+  SU2_MPI::Allreduce(times, maxTimes, 3, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  result.setupTime = maxTimes[0];
+  result.solveTime = maxTimes[1];
+  result.spmvTime = maxTimes[2];
+
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  string prefix, configFile;
+  vector<string> solvers, preconditioners;
+  vector<int> threads;
+  unsigned long nSpMV = 50;
+
+  /*--- Command line parsing ---*/
+
+  CLI::App app{"SU2 v8.2.0 \"Harrier\", linear solver replay benchmark"};
+  app.add_option("prefix", prefix,
+                 "Common part of the names of the linear system files written by SU2_CFD, e.g. linear_system_nvar5.")
+      ->required();
+  app.add_option("-c,--config", configFile, "Config file with further linear solver options.")
+      ->check(CLI::ExistingFile);
+  app.add_option("-s,--solvers", solvers, "Linear solvers (default: the one used to write the system).")
+      ->delimiter(',');
+  app.add_option("-p,--preconditioners", preconditioners,
+                 "Preconditioners (default: the one used to write the system).")
+      ->delimiter(',');
+  app.add_option("-t,--threads", threads, "Numbers of OpenMP threads per MPI rank (default: all).")->delimiter(',');
+  app.add_option("-n,--spmv", nSpMV, "Number of matrix-vector products to measure the bandwidth.");
+
+  CLI11_PARSE(app, argc, argv)
+
+  /*--- MPI initialization ---*/
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Read and distribute the linear system. ---*/
+
+  CReplayGeometry geometry(prefix);
+  const auto& header = geometry.header;
+
+  if (solvers.empty()) solvers.push_back(OptionName(Linear_Solver_Map, header.kindSolver));
+  if (preconditioners.empty()) preconditioners.push_back(OptionName(Linear_Solver_Prec_Map, header.kindPrec));
+  if (threads.empty()) threads.push_back(omp_get_max_threads());
+
+  for (const auto& name : solvers) {
+    if (Linear_Solver_Map.count(name) == 0) SU2_MPI::Error("Unknown linear solver " + name, CURRENT_FUNCTION);
+    const auto kind = Linear_Solver_Map.at(name);
+    if (kind == PASTIX_LU || kind == PASTIX_LDLT) SU2_MPI::Error(name + " cannot be replayed.", CURRENT_FUNCTION);
+  }
+  for (const auto& name : preconditioners) {
+    if (Linear_Solver_Prec_Map.count(name) == 0) SU2_MPI::Error("Unknown preconditioner " + name, CURRENT_FUNCTION);
+    const auto kind = Linear_Solver_Prec_Map.at(name);
+    if (kind == LINELET || kind >= PASTIX_ILU) SU2_MPI::Error(name + " cannot be replayed.", CURRENT_FUNCTION);
+  }
+
+  /*--- Options from the config file take precedence over those of the original run. ---*/
+
+  string userOptions;
+  vector<string> userKeys;
+  if (!configFile.empty()) {
+    ifstream file(configFile);
+    for (string line; getline(file, line);) {
+      userOptions += line + "\n";
+      const auto pos = line.find('=');
+      if (line.empty() || line[0] == '%' || pos == string::npos) continue;
+      auto key = line.substr(0, pos);
+      key.erase(remove_if(key.begin(), key.end(), ::isspace), key.end());
+      transform(key.begin(), key.end(), key.begin(), ::toupper);
+      userKeys.push_back(key);
+    }
+  }
+
+  auto makeConfig = [&](const string& solver, const string& precond) {
+    stringstream options;
+    auto setOption = [&](const string& key, const string& value) {
+      if (find(userKeys.begin(), userKeys.end(), key) == userKeys.end()) options << key << "= " << value << "\n";
+    };
+    setOption("SOLVER", "EULER");
+    setOption("LINEAR_SOLVER_ERROR", PrintingToolbox::to_string(header.tolerance));
+    setOption("LINEAR_SOLVER_ITER", to_string(header.maxIter));
+    setOption("LINEAR_SOLVER_RESTART_FREQUENCY", to_string(header.restart));
+    setOption("LINEAR_SOLVER_ILU_FILL_IN", to_string(header.iluFill));
+    setOption("LINEAR_SOLVER_CHEBYSHEV_DEGREE", to_string(header.chebyshevDegree));
+    setOption("LINEAR_SOLVER_SCHWARZ_OVERLAP", to_string(header.schwarzOverlap));
+    options << userOptions;
+    options << "LINEAR_SOLVER= " << solver << "\nLINEAR_SOLVER_PREC= " << precond << "\n";
+    return new CConfig(options, SU2_COMPONENT::SU2_CFD, false);
+  };
+
+  if (rank == MASTER_NODE) {
+    cout << "\n------------------------------ Linear System Replay ------------------------------\n";
+    cout << "Files: " << prefix << "_*.dat (" << header.size << " ranks in the original run).\n";
+    cout << "Rows: " << header.nPointGlobal << ", blocks of " << header.nVar << "x" << header.nEqn << ".\n";
+    cout << "Replayed on " << size << " ranks." << endl;
+  }
+  unsigned long nDropped = 0, nNonZero = 0, nNonZeroLocal = geometry.colInd.size();
+  SU2_MPI::Reduce(&geometry.nDroppedBlocks, &nDropped, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE,
+                  SU2_MPI::GetComm());
+  SU2_MPI::Reduce(&nNonZeroLocal, &nNonZero, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  if (rank == MASTER_NODE && nDropped > 0) {
+    cout << "WARNING: " << nDropped << " blocks coupling to periodic points were dropped." << endl;
+  }
+
+  /*--- Approximate memory traffic of one product: the blocks, the column indices and row pointers,
+   *    reading the vector once, and writing the result. ---*/
+  auto spmvBytes = [&](bool floatStorage) {
+    const passivedouble valueSize = floatStorage ? sizeof(float) : sizeof(ScalarType);
+    const passivedouble nRows = header.nPointGlobal;
+    return nNonZero * (header.nVar * header.nEqn * valueSize + sizeof(unsigned long)) +
+           nRows * (sizeof(unsigned long) + (header.nVar + header.nEqn) * sizeof(ScalarType));
+  };
+
+  PrintingToolbox::CTablePrinter table(&cout);
+  table.AddColumn("Solver", 18);
+  table.AddColumn("Preconditioner", 14);
+  table.AddColumn("Ranks", 6);
+  table.AddColumn("Threads", 7);
+  table.AddColumn("Iter", 6);
+  table.AddColumn("Residual", 10);
+  table.AddColumn("Conv.", 5);
+  table.AddColumn("Setup [s]", 10);
+  table.AddColumn("Solve [s]", 10);
+  table.AddColumn("SpMV [GB/s]", 11);
+  table.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  table.SetPrecision(4);
+  if (rank == MASTER_NODE) table.PrintHeader();
+
+  for (const auto numThreads : threads) {
+    omp_set_num_threads(numThreads);
+
+    for (const auto& solver : solvers) {
+      for (const auto& precond : preconditioners) {
+        CConfig* config = makeConfig(solver, precond);
+
+        const auto result = Replay(geometry, *config, nSpMV);
+
+        if (rank == MASTER_NODE) {
+          const bool converged = result.residual <= SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+          const auto GBs = spmvBytes(config->GetLinear_Solver_Float_Storage_Flow()) * nSpMV /
+                           max(result.spmvTime, passivedouble(1e-12)) / 1e9;
+          table << solver << precond << size << numThreads << result.iterations << result.residual
+                << (converged ? "yes" : "no") << result.setupTime << result.solveTime << GBs;
+        }
+        delete config;
+      }
+    }
+  }
+  if (rank == MASTER_NODE) table.PrintFooter();
+
+  /*--- Finalize MPI parallelization ---*/
+
+  SU2_MPI::Finalize();
+
+  return EXIT_SUCCESS;
+}
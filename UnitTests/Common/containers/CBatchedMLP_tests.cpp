@@ -0,0 +1,110 @@
+/*!
+ * \file CBatchedMLP_tests.cpp
+ * \brief Unit tests for the batched evaluation of multi-layer perceptrons.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../../../Common/include/containers/CBatchedMLP.hpp"
+
+TEST_CASE("Batched MLP matches the reference values of MLPCpp", "[LookUpANN]") {
+  /*--- Same network and reference values as the MLPCpp look-up test. ---*/
+  const std::string fileName = "src/SU2/UnitTests/Common/toolboxes/multilayer_perceptron/simple_mlp.mlp";
+  CBatchedMLP mlp(1, &fileName);
+
+  /*--- The inputs in a different order than in the file. ---*/
+  const auto iMap = mlp.PairVariables({"y", "x"}, {"z"});
+  REQUIRE(mlp.IsSupported(iMap));
+
+  const unsigned long nPoint = 3;
+  su2activematrix inputs(2, nPoint), outputs(1, nPoint);
+  const su2double x[] = {1.0, 3.0, 1.0}, y[] = {-0.5, -10.0, -0.5};
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    inputs(0, iPoint) = y[iPoint];
+    inputs(1, iPoint) = x[iPoint];
+  }
+  unsigned long extrapolation[nPoint];
+
+  CHECK(mlp.Predict(iMap, nPoint, inputs, outputs, extrapolation) == 1);
+
+  CHECK(outputs(0, 0) == Approx(0.344829));
+  CHECK(outputs(0, 1) == Approx(0.012737));
+  CHECK(outputs(0, 2) == outputs(0, 0));
+  CHECK(extrapolation[0] == 0);
+  CHECK(extrapolation[1] == 1);
+  CHECK(extrapolation[2] == 0);
+
+  /*--- Outputs that the network does not provide are zero. ---*/
+  const auto iMapMissing = mlp.PairVariables({"x", "y"}, {"w", "z"});
+  su2activematrix twoOutputs(2, 1);
+  twoOutputs = 1.0;
+  inputs(0, 0) = x[0];
+  inputs(1, 0) = y[0];
+  mlp.Predict(iMapMissing, 1, inputs, twoOutputs, extrapolation);
+  CHECK(twoOutputs(0, 0) == 0.0);
+  CHECK(twoOutputs(1, 0) == Approx(0.344829));
+}
+
+TEST_CASE("Batched MLP derivatives match finite differences", "[LookUpANN]") {
+  const std::string fileName = "src/SU2/UnitTests/SU2_CFD/fluid/MLP_PINN.mlp";
+  CBatchedMLP mlp(1, &fileName);
+  const auto iMap = mlp.PairVariables({"Density", "Energy"}, {"s"});
+  REQUIRE(mlp.IsSupported(iMap));
+
+  /*--- Each point is followed by its perturbations in density and energy. ---*/
+  const unsigned long nBase = 4, nPoint = 5 * nBase;
+  const su2double rho[] = {1.0, 10.0, 50.0, 200.0}, e[] = {3e5, 4e5, 2.7e5, 5e5};
+  const su2double h[] = {1e-4, 1e-1};
+
+  su2activematrix inputs(2, nPoint), outputs(1, nPoint), d(2, nPoint), d2(4, nPoint);
+  for (auto iBase = 0ul; iBase < nBase; ++iBase) {
+    for (auto iPert = 0ul; iPert < 5; ++iPert) {
+      const auto iPoint = 5 * iBase + iPert;
+      inputs(0, iPoint) = rho[iBase];
+      inputs(1, iPoint) = e[iBase];
+      if (iPert > 0) inputs((iPert - 1) / 2, iPoint) += ((iPert % 2) ? 1 : -1) * h[(iPert - 1) / 2];
+    }
+  }
+  std::vector<unsigned long> extrapolation(nPoint);
+  mlp.Predict(iMap, nPoint, inputs, outputs, extrapolation.data(), &d, &d2);
+
+  for (auto iBase = 0ul; iBase < nBase; ++iBase) {
+    const auto i0 = 5 * iBase;
+    for (auto iInput = 0ul; iInput < 2; ++iInput) {
+      CAPTURE(iBase, iInput);
+      const auto ip = i0 + 1 + 2 * iInput, im = ip + 1;
+      const su2double fd = (outputs(0, ip) - outputs(0, im)) / (2 * h[iInput]);
+      CHECK(d(iInput, i0) == Approx(fd).epsilon(1e-5));
+
+      for (auto jInput = 0ul; jInput < 2; ++jInput) {
+        const su2double fd2 = (d(jInput, ip) - d(jInput, im)) / (2 * h[iInput]);
+        CHECK(d2(iInput * 2 + jInput, i0) == Approx(fd2).epsilon(1e-4).margin(1e-14));
+      }
+    }
+    CHECK(d2(1, i0) == Approx(d2(2, i0)));
+  }
+}
@@ -136,3 +136,32 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(idx_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_batch", "[tabulated chemistry]") {
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable", "EnthalpyTot");
+
+  /*--- batched look up of density and viscosity, including points outside the table ---*/
+
+  const vector<unsigned long> idx_vars = {look_up_table.GetIndexOfVar("Density"),
+                                          look_up_table.GetIndexOfVar("Viscosity"), look_up_table.GetNullIndex()};
+  const unsigned long n_points = 6;
+  const su2double prog[] = {0.55, 0.6, 0.05, 0.95, 1.10, 0.3};
+  const su2double enth[] = {-0.5, 0.9, 0.95, -0.9, 1.1, 0.5};
+
+  su2activematrix batch_vals(idx_vars.size(), n_points);
+  bool inside[n_points];
+  const auto n_outside = look_up_table.LookUpBatch_XY(idx_vars, n_points, prog, enth, batch_vals, inside);
+  CHECK(n_outside == 1);
+
+  /*--- the results must be the same as those of single look ups ---*/
+
+  vector<su2double> vals(idx_vars.size());
+  for (auto iPoint = 0ul; iPoint < n_points; ++iPoint) {
+    const bool inside_single = look_up_table.LookUp_XY(idx_vars, vals, prog[iPoint], enth[iPoint]);
+    CHECK(inside[iPoint] == inside_single);
+    for (auto iVar = 0ul; iVar < idx_vars.size(); ++iVar) {
+      CHECK(SU2_TYPE::GetValue(batch_vals(iVar, iPoint)) == Approx(SU2_TYPE::GetValue(vals[iVar])));
+    }
+  }
+  CHECK(SU2_TYPE::GetValue(batch_vals(0, 0)) == Approx(1.02));
+}
@@ -0,0 +1,168 @@
+/*!
+ * \file CP2PComms_tests.cpp
+ * \brief Unit tests for the point-to-point (halo) comms of the geometry.
+ * \note Meaningful with multiple ranks, e.g. "mpirun -n 2 test_driver [MPI]".
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+namespace {
+
+/*--- Unit quad mesh partitioned over the ranks, with extra comms options. ---*/
+std::unique_ptr<UnitQuadTestCase> MakeCommsTestCase(const std::string& options) {
+  auto testCase = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  testCase->AddOption(options);
+  testCase->InitConfig();
+  testCase->InitGeometry();
+  return testCase;
+}
+
+/*--- Value of a variable of a point, the same on all ranks. ---*/
+su2double PointValue(const CGeometry& geometry, unsigned long iPoint, unsigned long iVar, int exchange) {
+  return 1.0 + geometry.nodes->GetGlobalIndex(iPoint) + 0.1 * iVar + 1000.0 * exchange;
+}
+
+/*--- Forward comms of a vector, the halo points receive the values of their owners. ---*/
+void CheckForwardComms(UnitQuadTestCase& testCase, unsigned short nVar, int exchange) {
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysVector<su2double> x(nPoint, nPointDomain, nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x(iPoint, iVar) = PointValue(*geometry, iPoint, iVar, exchange);
+
+  CSysMatrixComms::Initiate(x, geometry, config, MPI_QUANTITIES::SOLUTION_MATRIX);
+  CSysMatrixComms::Complete(x, geometry, config, MPI_QUANTITIES::SOLUTION_MATRIX);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    CAPTURE(nVar, exchange, iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) CHECK(x(iPoint, iVar) == PointValue(*geometry, iPoint, iVar, exchange));
+  }
+}
+
+/*--- Reverse (transposed) comms of a vector, the owners accumulate the values of their halo copies. ---*/
+void CheckReverseComms(UnitQuadTestCase& testCase, unsigned short nVar, int exchange) {
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysVector<su2double> x(nPoint, nPointDomain, nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x(iPoint, iVar) = PointValue(*geometry, iPoint, iVar, exchange);
+
+  /*--- Each copy of a point on another rank is one entry in the send lists of the owner. ---*/
+  std::vector<int> nCopies(nPoint, 1);
+  for (auto i = 0ul; i < geometry->nPoint_P2PSend[geometry->nP2PSend]; ++i)
+    ++nCopies[geometry->Local_Point_P2PSend[i]];
+
+  CSysMatrixComms::Initiate(x, geometry, config, MPI_QUANTITIES::SOLUTION_MATRIXTRANS);
+  CSysMatrixComms::Complete(x, geometry, config, MPI_QUANTITIES::SOLUTION_MATRIXTRANS);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    CAPTURE(nVar, exchange, iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      CHECK(x(iPoint, iVar) == Approx(nCopies[iPoint] * PointValue(*geometry, iPoint, iVar, exchange)));
+  }
+}
+
+/*--- Forward comms of the coordinates, through the geometry instead of a vector. ---*/
+void CheckCoordinateComms(UnitQuadTestCase& testCase) {
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nDim = geometry->GetnDim();
+
+  std::vector<su2double> coord(nPoint * nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iPoint * nDim + iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+
+  for (auto iPoint = geometry->GetnPointDomain(); iPoint < nPoint; ++iPoint)
+    for (auto iDim = 0u; iDim < nDim; ++iDim) geometry->nodes->SetCoord(iPoint, iDim, -1.0);
+
+  geometry->InitiateComms(geometry, config, MPI_QUANTITIES::COORDINATES);
+  geometry->CompleteComms(geometry, config, MPI_QUANTITIES::COORDINATES);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    CAPTURE(iPoint);
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      CHECK(geometry->nodes->GetCoord(iPoint, iDim) == coord[iPoint * nDim + iDim]);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Persistent requests of the point-to-point comms", "[Geometry][MPI]") {
+  auto testCase = MakeCommsTestCase("P2P_PERSISTENT_REQUESTS= YES");
+  const auto* geometry = testCase->geometry.get();
+
+  /*--- Requests of one type of comms, in both directions. ---*/
+  const auto nRequests = size_t(geometry->nP2PSend + geometry->nP2PRecv);
+
+  /*--- Repeated exchanges restart the same requests. ---*/
+  for (int exchange = 0; exchange < 3; ++exchange) {
+    CheckForwardComms(*testCase, 2, exchange);
+    CheckReverseComms(*testCase, 2, exchange);
+  }
+  CHECK(geometry->GetnPersistentP2PRequests() == 2 * nRequests);
+
+  /*--- A larger count per point reallocates the buffers, the old requests must be freed. ---*/
+  for (int exchange = 0; exchange < 2; ++exchange) {
+    CheckForwardComms(*testCase, 6, exchange);
+    CheckReverseComms(*testCase, 6, exchange);
+  }
+  CHECK(geometry->GetnPersistentP2PRequests() == 2 * nRequests);
+
+  /*--- A smaller count fits in the buffers, its requests are added. ---*/
+  for (int exchange = 0; exchange < 2; ++exchange) {
+    CheckForwardComms(*testCase, 3, exchange);
+    CheckReverseComms(*testCase, 3, exchange);
+  }
+  CHECK(geometry->GetnPersistentP2PRequests() == 4 * nRequests);
+}
+
+TEST_CASE("Shared memory transport of the point-to-point comms", "[Geometry][MPI]") {
+  /*--- Regular messages, the shared transport for up to 4 values per point, and both combined with persistent
+   *    requests. The halo values must be the same with all of them. ---*/
+  for (const auto* options : {"P2P_SHARED_MEMORY_COUNT= 0", "P2P_SHARED_MEMORY_COUNT= 4",
+                              "P2P_SHARED_MEMORY_COUNT= 4\nP2P_PERSISTENT_REQUESTS= YES"}) {
+    auto testCase = MakeCommsTestCase(options);
+    CAPTURE(options);
+
+    /*--- Consecutive exchanges alternate between the halves of the shared send buffers, stale data in either half
+     *    shows up as the values of another exchange. Reverse comms and larger counts use regular messages. ---*/
+    for (int exchange = 0; exchange < 4; ++exchange) {
+      CheckForwardComms(*testCase, 4, exchange);
+      CheckForwardComms(*testCase, 2, exchange);
+      CheckReverseComms(*testCase, 3, exchange);
+      CheckForwardComms(*testCase, 6, exchange);
+      CheckCoordinateComms(*testCase);
+    }
+  }
+}
@@ -0,0 +1,106 @@
+/*!
+ * \file CLinearSystemFile_tests.cpp
+ * \brief Unit tests for the linear systems written for (and read by) SU2_LINBENCH.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../SU2_LINBENCH/include/CReplayGeometry.hpp"
+
+TEST_CASE("Linear system dump round trip", "[Linear algebra]") {
+  using ScalarType = su2mixedfloat;
+  const unsigned short nVar = 3;
+
+  /*--- The system is written by the first solve, at inner iteration 0. ---*/
+  UnitQuadTestCase testCase;
+  testCase.AddOption("LINEAR_SOLVER= FGMRES");
+  testCase.AddOption("LINEAR_SOLVER_PREC= JACOBI");
+  testCase.AddOption("LINEAR_SOLVER_ITER= 7");
+  testCase.AddOption("LINEAR_SYSTEM_DUMP_ITER= 0");
+  testCase.AddOption("LINEAR_SYSTEM_DUMP_FILENAME= roundtrip");
+  testCase.InitConfig();
+  testCase.InitGeometry();
+
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<ScalarType> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<ScalarType> block(nVar * nVar);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar + 1) == 0) ? 20.0 + iPoint % 3 : 0.1 * k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -1.0 - 0.01 * ((iPoint + 2 * jPoint + k) % 11);
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  for (auto i = 0ul; i < nPointDomain * nVar; ++i) rhs[i] = 1.0 + 0.1 * (i % 13);
+
+  CSysSolve<ScalarType> solver;
+  solver.SetName("TEST");
+  solver.Solve(matrix, rhs, sol, geometry, config);
+
+  /*--- Read the system back as SU2_LINBENCH does, on one rank the replay index is the global index. ---*/
+  const std::string prefix = "roundtrip_TEST_zone0_nvar3";
+  const CReplayGeometry replay(prefix);
+
+  const auto& header = replay.header;
+  CHECK(header.nVar == nVar);
+  CHECK(header.nEqn == nVar);
+  CHECK(header.nPointGlobal == geometry->GetGlobal_nPointDomain());
+  CHECK(header.kindSolver == FGMRES);
+  CHECK(header.kindPrec == JACOBI);
+  CHECK(header.maxIter == 7);
+  REQUIRE(replay.GetnPointDomain() == nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto iGlobal = geometry->nodes->GetGlobalIndex(iPoint);
+    CAPTURE(iPoint, iGlobal);
+
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      CHECK(replay.rhs[iGlobal * nVar + iVar] == SU2_TYPE::GetValue(rhs(iPoint, iVar)));
+
+    const auto begin = replay.rowPtr[iGlobal], end = replay.rowPtr[iGlobal + 1];
+    CHECK(end - begin == geometry->nodes->GetnPoint(iPoint) + 1);
+
+    for (auto k = begin; k < end; ++k) {
+      const auto jPoint = geometry->GetGlobal_to_Local_Point(replay.colInd[k]);
+      REQUIRE(jPoint >= 0);
+      const auto* original = matrix.GetBlock(iPoint, jPoint);
+      REQUIRE(original != nullptr);
+      for (auto i = 0ul; i < block.size(); ++i)
+        CHECK(replay.values[k * block.size() + i] == SU2_TYPE::GetValue(original[i]));
+    }
+  }
+
+  std::remove(CLinearSystemFile::FileName(prefix, 0).c_str());
+}
@@ -0,0 +1,739 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the block sparse matrix and its preconditioners.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+/*--- The block kernels are only visible where the inline definitions of CSysMatrix are included. ---*/
+#include "../../../Common/include/linear_algebra/CSysMatrix.inl"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+namespace {
+
+using ScalarType = su2mixedfloat;
+using VectorType = CSysVector<ScalarType>;
+
+/*--- Unit quad mesh (125 points by default) with extra linear solver options. ---*/
+std::unique_ptr<UnitQuadTestCase> MakeTestCase(const std::string& options, const std::string& boxSize = "5,5,5") {
+  auto testCase = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  auto& base = testCase->config_options;
+  base.replace(base.find("5,5,5"), 5, boxSize);
+  testCase->AddOption(options);
+  testCase->InitConfig();
+  testCase->InitGeometry();
+  return testCase;
+}
+
+/*--- Non-symmetric (values and pattern of the blocks), diagonally dominant, block matrix on the edge pattern. ---*/
+void FillMatrix(CSysMatrix<ScalarType>& matrix, CGeometry& geometry, unsigned short nVar) {
+  std::vector<ScalarType> block(nVar * nVar);
+
+  matrix.SetValZero();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      for (auto jVar = 0u; jVar < nVar; ++jVar)
+        block[iVar * nVar + jVar] = (iVar == jVar) ? 10.0 * nVar + 0.1 * (iPoint % 7) + iVar
+                                                   : 0.1 * (iVar + 1) - 0.05 * jVar * (iPoint % 3);
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar)
+        for (auto jVar = 0u; jVar < nVar; ++jVar)
+          block[iVar * nVar + jVar] = (jPoint > iPoint ? -1.0 : -0.5) + 0.02 * (int(iVar) - int(jVar)) +
+                                      0.01 * (jPoint % 5);
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+}
+
+/*--- Block diffusion operator (graph Laplacian plus a small shift) with weak non-symmetric coupling
+ *    of the variables, the kind of matrix for which a multigrid method is needed. ---*/
+void FillDiffusionMatrix(CSysMatrix<ScalarType>& matrix, CGeometry& geometry, unsigned short nVar) {
+  std::vector<ScalarType> block(nVar * nVar);
+
+  matrix.SetValZero();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    const auto nNeighbor = geometry.nodes->GetnPoint(iPoint);
+
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      for (auto jVar = 0u; jVar < nVar; ++jVar)
+        block[iVar * nVar + jVar] = (iVar == jVar) ? nNeighbor + 0.01 : 0.05 * (int(jVar) - int(iVar));
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar)
+        for (auto jVar = 0u; jVar < nVar; ++jVar)
+          block[iVar * nVar + jVar] = (iVar == jVar) ? -1.0 : 0.01 * (jPoint > iPoint);
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+}
+
+/*--- Build and apply a preconditioner of the matrix of the test case, using the current number of threads. ---*/
+VectorType ApplyPreconditioner(UnitQuadTestCase& testCase, unsigned short nVar) {
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<ScalarType> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  FillMatrix(matrix, *geometry, nVar);
+
+  VectorType b(nPoint, nPointDomain, nVar, 0.0), x(nPoint, nPointDomain, nVar, 0.0);
+  for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+  const auto kind = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec());
+
+  SU2_OMP_PARALLEL {
+    auto* precond = CPreconditioner<ScalarType>::Create(kind, matrix, geometry, config);
+    precond->Build();
+    (*precond)(b, x);
+    delete precond;
+  }
+  END_SU2_OMP_PARALLEL
+
+  return x;
+}
+
+/*--- Compare the kernels specialized for block size N with the generic ones (the order of the sums may differ). ---*/
+template <size_t N>
+void CheckFixedKernels() {
+  using T = passivedouble;
+  constexpr size_t nBlk = 3;
+  const auto all = [](unsigned long) { return true; };
+  const auto skip1 = [](unsigned long j) { return j != 1; };
+
+  T a[nBlk * N * N], b[N * N], x[nBlk * N], y[N], yRef[N];
+  float aFlt[N * N];
+
+  for (size_t k = 0; k < nBlk; ++k)
+    for (size_t i = 0; i < N; ++i)
+      for (size_t j = 0; j < N; ++j)
+        a[(k * N + i) * N + j] = (i == j && k == 0) ? 4.0 + N : 0.1 * (i + 1) - 0.07 * j + 0.3 * k;
+  for (size_t i = 0; i < N * N; ++i) {
+    b[i] = 1.0 - 0.05 * i;
+    aFlt[i] = a[i];
+  }
+  for (size_t i = 0; i < nBlk * N; ++i) x[i] = 1.0 + 0.1 * i;
+
+  /*--- Some values cancel (e.g. "gemv sub" of y = A x), hence the absolute margin. ---*/
+  auto check = [&](const char* kernel) {
+    CAPTURE(N, kernel);
+    for (size_t i = 0; i < N; ++i) CHECK(y[i] == Approx(yRef[i]).epsilon(1e-14).margin(1e-12));
+  };
+
+  gemv_fixed<N, true, false>(a, x, y);
+  gemv_impl<T, true, false, false>(N, N, a, x, yRef);
+  check("gemv");
+
+  for (size_t i = 0; i < N; ++i) y[i] = yRef[i] = 0.5 * i;
+  gemv_fixed<N, true, true>(a, x, y);
+  gemv_impl<T, true, true, false>(N, N, a, x, yRef);
+  check("gemv add");
+
+  gemv_fixed<N, false, true>(a, x, y);
+  gemv_impl<T, false, true, false>(N, N, a, x, yRef);
+  check("gemv sub");
+
+  gemv_fixed<N, true, false>(aFlt, x, y);
+  gemv_impl<T, true, false, false, float>(N, N, aFlt, x, yRef);
+  check("gemv float");
+
+  T c[N * N], cRef[N * N];
+  gemm_fixed<N>(a, b, c);
+  gemm_impl<T>(N, a, b, cRef);
+  for (size_t i = 0; i < N * N; ++i) {
+    CAPTURE(N, i);
+    CHECK(c[i] == Approx(cRef[i]).epsilon(1e-14).margin(1e-12));
+  }
+
+  /*--- The solution of the specialized elimination satisfies the (generic) product. ---*/
+  T lu[N * N];
+  for (size_t i = 0; i < N * N; ++i) lu[i] = a[i];
+  for (size_t i = 0; i < N; ++i) y[i] = x[i];
+  gauss_fixed<N>(lu, y);
+  gemv_impl<T, true, false, false>(N, N, a, y, yRef);
+  for (size_t i = 0; i < N; ++i) y[i] = x[i];
+  check("gauss");
+
+  /*--- A row of 3 blocks, with and without filtering the columns. ---*/
+  const unsigned long col_ind[nBlk] = {0, 2, 1};
+  for (const bool filter : {false, true}) {
+    if (filter)
+      rowprod_fixed<N>(a, col_ind, 0, nBlk, x, y, skip1);
+    else
+      rowprod_fixed<N>(a, col_ind, 0, nBlk, x, y, all);
+
+    for (size_t i = 0; i < N; ++i) yRef[i] = 0.0;
+    for (size_t k = 0; k < nBlk; ++k)
+      if (!filter || skip1(col_ind[k])) gemv_impl<T, true, true, false>(N, N, &a[k * N * N], &x[col_ind[k] * N], yRef);
+    check(filter ? "row product (filtered)" : "row product");
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Level-scheduled threaded LU_SGS and ILU match the serial sweeps", "[Linear algebra]") {
+  const int maxThreads = omp_get_max_threads();
+
+  for (const std::string prec : {"LU_SGS", "ILU"}) {
+    for (const unsigned short nVar : {3, 5}) {
+      /*--- One partition, the sweeps of the serial implementation. ---*/
+      omp_set_num_threads(1);
+      auto serialCase = MakeTestCase("LINEAR_SOLVER_PREC= " + prec + "\nLINEAR_SOLVER_PREC_THREADS= 1");
+      const auto reference = ApplyPreconditioner(*serialCase, nVar);
+
+      for (const int numThreads : {1, 2, 4}) {
+        omp_set_num_threads(numThreads);
+        auto levelCase = MakeTestCase("LINEAR_SOLVER_PREC= " + prec + "\nLINEAR_SOLVER_PREC_LEVEL_SCHEDULING= YES");
+        const auto result = ApplyPreconditioner(*levelCase, nVar);
+
+        for (auto i = 0ul; i < reference.GetLocSize(); ++i) {
+          CAPTURE(prec, nVar, numThreads, i);
+          CHECK(result[i] == Approx(reference[i]).epsilon(1e-12));
+        }
+      }
+    }
+  }
+  omp_set_num_threads(maxThreads);
+}
+
+TEST_CASE("AMG preconditioned FGMRES", "[Linear algebra]") {
+  const int maxThreads = omp_get_max_threads();
+  const unsigned short nVar = 2;
+  const ScalarType tol = (sizeof(ScalarType) < sizeof(double)) ? 1e-4 : 1e-8;
+  const unsigned long maxIter = 200;
+
+  /*--- Iterations, residual, and solution of a solve on 9x9x9 points. ---*/
+  auto solve = [&](const std::string& options, int numThreads) {
+    omp_set_num_threads(numThreads);
+    auto testCase = MakeTestCase("LINEAR_SOLVER_PREC= AMG\nLINEAR_SOLVER_RESTART_FREQUENCY= 200\n" + options, "9,9,9");
+    auto* geometry = testCase->geometry.get();
+    const auto* config = testCase->config.get();
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+
+    CSysMatrix<ScalarType> matrix;
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    FillDiffusionMatrix(matrix, *geometry, nVar);
+
+    VectorType b(nPoint, nPointDomain, nVar, 0.0), x(nPoint, nPointDomain, nVar, 0.0);
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+    CSysSolve<ScalarType> solver;
+    unsigned long iter = 0;
+    ScalarType residual = 0;
+
+    SU2_OMP_PARALLEL {
+      CSysMatrixVectorProduct<ScalarType> mat_vec(matrix, geometry, config);
+      auto* precond = CPreconditioner<ScalarType>::Create(AMG, matrix, geometry, config);
+      precond->Build();
+      const auto it = solver.FGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, residual, false, config);
+      SU2_OMP_MASTER
+      iter = it;
+      END_SU2_OMP_MASTER
+      delete precond;
+    }
+    END_SU2_OMP_PARALLEL
+
+    return std::make_tuple(iter, residual, x);
+  };
+
+  for (const std::string smoother : {"ILU", "LU_SGS", "JACOBI"}) {
+    CAPTURE(smoother);
+    const auto options = "LINEAR_SOLVER_AMG_SMOOTHER= " + smoother;
+
+    /*--- With one level AMG is only its smoother. ---*/
+    const auto smootherOnly = solve(options + "\nLINEAR_SOLVER_AMG_LEVELS= 1", 1);
+    const auto reference = solve(options, 1);
+
+    CHECK(std::get<1>(reference) < tol);
+    CHECK(std::get<0>(reference) < std::get<0>(smootherOnly));
+
+    /*--- The V-cycle gives the same result with any number of threads, but the reductions of FGMRES do not,
+     *    the last iteration may be needed or not when the residual is close to the tolerance. ---*/
+    for (const int numThreads : {2, 4}) {
+      CAPTURE(numThreads);
+      const auto threaded = solve(options, numThreads);
+
+      CHECK(std::get<1>(threaded) < tol);
+      CHECK(std::get<0>(threaded) <= std::get<0>(reference) + 1);
+      CHECK(std::get<0>(threaded) + 1 >= std::get<0>(reference));
+      const auto& x = std::get<2>(threaded);
+      const auto& xRef = std::get<2>(reference);
+      for (auto i = 0ul; i < xRef.GetLocSize(); ++i) {
+        CHECK(x[i] == Approx(xRef[i]).epsilon(100 * tol));
+      }
+    }
+  }
+  omp_set_num_threads(maxThreads);
+}
+
+TEST_CASE("Single precision storage sees the blocks modified after a build", "[Linear algebra]") {
+  const unsigned short nVar = 3;
+
+  for (const std::string prec : {"LU_SGS", "ILU", "JACOBI"}) {
+    CAPTURE(prec);
+    auto testCase = MakeTestCase("LINEAR_SOLVER_PREC= " + prec);
+    auto* geometry = testCase->geometry.get();
+    const auto* config = testCase->config.get();
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto kind = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec());
+
+    VectorType b(nPoint, nPointDomain, nVar, 0.0);
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+    /*--- Build the preconditioner, apply it, and compute a matrix-vector product. ---*/
+    auto apply = [&](CSysMatrix<ScalarType>& matrix, VectorType& x, VectorType& Ab) {
+      SU2_OMP_PARALLEL {
+        auto* precond = CPreconditioner<ScalarType>::Create(kind, matrix, geometry, config);
+        precond->Build();
+        (*precond)(b, x);
+        matrix.MatrixVectorProduct(b, Ab, geometry, config);
+        delete precond;
+      }
+      END_SU2_OMP_PARALLEL
+    };
+
+    /*--- Modifications that do not go through SetValZero. ---*/
+    std::vector<ScalarType> block(nVar * nVar, 0.5);
+    auto modify = [&](CSysMatrix<ScalarType>& matrix) {
+      matrix.AddVal2Diag(7, 5.0);
+      matrix.SetBlock(3, geometry->nodes->GetPoint(3, 0), block.data());
+      matrix.AddBlock(60, 60, block.data());
+    };
+
+    CSysMatrix<ScalarType> matrix;
+    matrix.SetFloatStorage(true);
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    FillMatrix(matrix, *geometry, nVar);
+
+    VectorType x0(nPoint, nPointDomain, nVar, 0.0), Ab0(nPoint, nPointDomain, nVar, 0.0);
+    apply(matrix, x0, Ab0);
+
+    modify(matrix);
+    VectorType x1(nPoint, nPointDomain, nVar, 0.0), Ab1(nPoint, nPointDomain, nVar, 0.0);
+    apply(matrix, x1, Ab1);
+
+    /*--- Reference, the same matrix that was never used before the modifications. ---*/
+    CSysMatrix<ScalarType> reference;
+    reference.SetFloatStorage(true);
+    reference.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    FillMatrix(reference, *geometry, nVar);
+    modify(reference);
+
+    VectorType xRef(nPoint, nPointDomain, nVar, 0.0), AbRef(nPoint, nPointDomain, nVar, 0.0);
+    apply(reference, xRef, AbRef);
+
+    ScalarType change = 0;
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) {
+      CHECK(x1[i] == xRef[i]);
+      CHECK(Ab1[i] == AbRef[i]);
+      change = std::max<ScalarType>(change, fabs(x1[i] - x0[i]) + fabs(Ab1[i] - Ab0[i]));
+    }
+    CHECK(change > 1e-3);
+  }
+}
+
+TEST_CASE("Block-size specialized kernels match the generic ones", "[Linear algebra]") {
+#define FIXED_CASE(N) CheckFixedKernels<N>();
+  FOREACH_FIXED_BLOCK_SIZE(FIXED_CASE)
+#undef FIXED_CASE
+}
+
+TEST_CASE("Restricted additive Schwarz overlap of LU_SGS", "[Linear algebra][MPI]") {
+  /*--- One partition per rank, the reference below is the serial sweep. ---*/
+  const int maxThreads = omp_get_max_threads();
+  omp_set_num_threads(1);
+
+  auto testCase = MakeTestCase("LINEAR_SOLVER_PREC= LU_SGS\nLINEAR_SOLVER_SCHWARZ_OVERLAP= 1");
+  auto* geometry = testCase->geometry.get();
+  const auto* config = testCase->config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Values that only depend on the global indices, so that they are the same on all ranks. The halo rows have
+   *    the off-diagonal blocks of the local edges, and an incomplete diagonal block that the owner must replace. ---*/
+  const auto global = [&](unsigned long iPoint) { return geometry->nodes->GetGlobalIndex(iPoint); };
+  const auto diagonal = [&](unsigned long iPoint) { return 10.0 + 0.1 * (global(iPoint) % 7); };
+  const auto offDiagonal = [&](unsigned long iPoint, unsigned long jPoint) {
+    return (global(jPoint) > global(iPoint) ? -1.0 : -0.5) + 0.01 * (global(jPoint) % 5);
+  };
+  const auto rhsValue = [&](unsigned long iPoint) { return 1.0 + 0.1 * (global(iPoint) % 9); };
+
+  CSysMatrix<ScalarType> matrix;
+  matrix.Initialize(nPoint, nPointDomain, 1, 1, true, geometry, config);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const ScalarType dia = (iPoint < nPointDomain) ? diagonal(iPoint) : 1.0;
+    matrix.SetBlock(iPoint, iPoint, &dia);
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      const ScalarType off = offDiagonal(iPoint, jPoint);
+      matrix.SetBlock(iPoint, jPoint, &off);
+    }
+  }
+
+  VectorType b(nPoint, nPointDomain, 1, 0.0), x(nPoint, nPointDomain, 1, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) b[iPoint] = rhsValue(iPoint);
+
+  SU2_OMP_PARALLEL {
+    auto* precond = CPreconditioner<ScalarType>::Create(LU_SGS, matrix, geometry, config);
+    precond->Build();
+    (*precond)(b, x);
+    delete precond;
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- With one layer of overlap, the subdomain includes the halo points connected to the domain. ---*/
+  std::vector<bool> inOverlap(nPoint, true);
+  for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint) {
+    inOverlap[iPoint] = false;
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint))
+      if (jPoint < nPointDomain) inOverlap[iPoint] = true;
+  }
+
+  /*--- The halo rows in the overlap are complete, the others are decoupled. ---*/
+  for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint) {
+    CAPTURE(iPoint, inOverlap[iPoint]);
+    CHECK(*matrix.GetBlock(iPoint, iPoint) == (inOverlap[iPoint] ? diagonal(iPoint) : 1.0));
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint))
+      CHECK(*matrix.GetBlock(iPoint, jPoint) == (inOverlap[iPoint] ? offDiagonal(iPoint, jPoint) : 0.0));
+  }
+
+  /*--- Symmetric Gauss-Seidel sweeps of the subdomain system, whose right hand side has the values of the owners
+   *    in the overlap, and zero in the decoupled points. ---*/
+  const auto coeff = [&](unsigned long iPoint, unsigned long jPoint) {
+    if (!inOverlap[iPoint]) return (iPoint == jPoint) ? 1.0 : 0.0;
+    return (iPoint == jPoint) ? diagonal(iPoint) : offDiagonal(iPoint, jPoint);
+  };
+  std::vector<passivedouble> ref(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    passivedouble sum = inOverlap[iPoint] ? rhsValue(iPoint) : 0.0;
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint))
+      if (jPoint < iPoint) sum -= coeff(iPoint, jPoint) * ref[jPoint];
+    ref[iPoint] = sum / coeff(iPoint, iPoint);
+  }
+  for (auto iPoint = nPoint; iPoint-- > 0;) {
+    passivedouble sum = 0.0;
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint))
+      if (jPoint > iPoint) sum += coeff(iPoint, jPoint) * ref[jPoint];
+    ref[iPoint] -= sum / coeff(iPoint, iPoint);
+  }
+
+  /*--- Only the domain values are kept (restricted additive Schwarz). ---*/
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    CAPTURE(iPoint);
+    CHECK(x[iPoint] == Approx(ref[iPoint]).epsilon(1e-12));
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+TEST_CASE("AMG hierarchy across ranks", "[Linear algebra][MPI]") {
+  const int maxThreads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  const ScalarType tol = (sizeof(ScalarType) < sizeof(double)) ? 1e-4 : 1e-8;
+
+  auto makeCase = [](const std::string& options) {
+    return MakeTestCase("LINEAR_SOLVER_PREC= AMG\nLINEAR_SOLVER_RESTART_FREQUENCY= 200\n" + options, "9,9,9");
+  };
+  auto globalDot = [](const VectorType& a, const VectorType& b) {
+    passivedouble local = 0.0, global = 0.0;
+    for (auto i = 0ul; i < a.GetNElmDomain(); ++i) local += SU2_TYPE::GetValue(a[i] * b[i]);
+    SU2_MPI::Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    return global;
+  };
+
+  SECTION("The V-cycle of a symmetric matrix is symmetric") {
+    /*--- With Jacobi smoothing, this requires Galerkin operators and transfers that are consistent across ranks,
+     *    e.g. contributions of the restriction to aggregates of other ranks that are not sent to their owners,
+     *    or halos of the prolongation that are not updated, break the symmetry. ---*/
+    auto testCase = makeCase("LINEAR_SOLVER_AMG_SMOOTHER= JACOBI");
+    auto* geometry = testCase->geometry.get();
+    const auto* config = testCase->config.get();
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto global = [&](unsigned long iPoint) { return geometry->nodes->GetGlobalIndex(iPoint); };
+
+    /*--- Graph Laplacian plus a small shift, the halo neighbors are included in the number of neighbors. ---*/
+    CSysMatrix<ScalarType> matrix;
+    matrix.Initialize(nPoint, nPointDomain, 1, 1, true, geometry, config);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const ScalarType dia = geometry->nodes->GetnPoint(iPoint) + 0.01, off = -1.0;
+      matrix.SetBlock(iPoint, iPoint, &dia);
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) matrix.SetBlock(iPoint, jPoint, &off);
+    }
+
+    VectorType x(nPoint, nPointDomain, 1, 0.0), y(nPoint, nPointDomain, 1, 0.0);
+    VectorType Mx(nPoint, nPointDomain, 1, 0.0), My(nPoint, nPointDomain, 1, 0.0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      x[iPoint] = 1.0 + 0.1 * (global(iPoint) % 9);
+      y[iPoint] = 0.5 - 0.03 * (global(iPoint) % 11);
+    }
+
+    SU2_OMP_PARALLEL {
+      auto* precond = CPreconditioner<ScalarType>::Create(AMG, matrix, geometry, config);
+      precond->Build();
+      (*precond)(x, Mx);
+      (*precond)(y, My);
+      delete precond;
+    }
+    END_SU2_OMP_PARALLEL
+
+    CHECK(globalDot(y, Mx) == Approx(globalDot(x, My)).epsilon(tol));
+    CHECK(globalDot(x, Mx) > 0.0);
+  }
+
+  SECTION("The coarse levels accelerate FGMRES on any number of ranks") {
+    const unsigned short nVar = 2;
+
+    auto solve = [&](const std::string& options) {
+      auto testCase = makeCase(options);
+      auto* geometry = testCase->geometry.get();
+      const auto* config = testCase->config.get();
+      const auto nPoint = geometry->GetnPoint();
+      const auto nPointDomain = geometry->GetnPointDomain();
+
+      CSysMatrix<ScalarType> matrix;
+      matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+      FillDiffusionMatrix(matrix, *geometry, nVar);
+
+      VectorType b(nPoint, nPointDomain, nVar, 0.0), x(nPoint, nPointDomain, nVar, 0.0);
+      for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+      CSysSolve<ScalarType> solver;
+      unsigned long iter = 0;
+      ScalarType residual = 0;
+
+      SU2_OMP_PARALLEL {
+        CSysMatrixVectorProduct<ScalarType> mat_vec(matrix, geometry, config);
+        auto* precond = CPreconditioner<ScalarType>::Create(AMG, matrix, geometry, config);
+        precond->Build();
+        const auto it = solver.FGMRES_LinSolver(b, x, mat_vec, *precond, tol, 200, residual, false, config);
+        SU2_OMP_MASTER
+        iter = it;
+        END_SU2_OMP_MASTER
+        delete precond;
+      }
+      END_SU2_OMP_PARALLEL
+
+      return std::make_pair(iter, residual);
+    };
+
+    for (const std::string smoother : {"ILU", "LU_SGS", "JACOBI"}) {
+      CAPTURE(smoother);
+      const auto options = "LINEAR_SOLVER_AMG_SMOOTHER= " + smoother;
+      const auto smootherOnly = solve(options + "\nLINEAR_SOLVER_AMG_LEVELS= 1");
+      const auto amg = solve(options);
+
+      CHECK(amg.second < tol);
+      CHECK(amg.first < smootherOnly.first);
+    }
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+TEST_CASE("Chebyshev preconditioner and smoother", "[Linear algebra]") {
+  const int maxThreads = omp_get_max_threads();
+  const unsigned short nVar = 2;
+  const ScalarType tol = (sizeof(ScalarType) < sizeof(double)) ? 1e-4 : 1e-8;
+
+  /*--- Iterations, residual, and solution of a FGMRES or smoother solve on 9x9x9 points. ---*/
+  auto solve = [&](const std::string& options, int numThreads, bool smoother, unsigned long maxIter) {
+    omp_set_num_threads(numThreads);
+    auto testCase = MakeTestCase("LINEAR_SOLVER_RESTART_FREQUENCY= 500\n" + options, "9,9,9");
+    auto* geometry = testCase->geometry.get();
+    const auto* config = testCase->config.get();
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    const auto kind = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec());
+
+    CSysMatrix<ScalarType> matrix;
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    FillDiffusionMatrix(matrix, *geometry, nVar);
+
+    VectorType b(nPoint, nPointDomain, nVar, 0.0), x(nPoint, nPointDomain, nVar, 0.0);
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+    CSysSolve<ScalarType> solver;
+    unsigned long iter = 0;
+    ScalarType residual = 0;
+
+    SU2_OMP_PARALLEL {
+      CSysMatrixVectorProduct<ScalarType> mat_vec(matrix, geometry, config);
+      auto* precond = CPreconditioner<ScalarType>::Create(kind, matrix, geometry, config);
+      precond->Build();
+      const auto it = smoother
+                          ? solver.Smoother_LinSolver(b, x, mat_vec, *precond, tol, maxIter, residual, false, config)
+                          : solver.FGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, residual, false, config);
+      SU2_OMP_MASTER
+      iter = it;
+      END_SU2_OMP_MASTER
+      delete precond;
+    }
+    END_SU2_OMP_PARALLEL
+
+    return std::make_tuple(iter, residual, x);
+  };
+
+  /*--- A higher degree costs more products per iteration but needs fewer iterations. ---*/
+  const auto jacobi = solve("LINEAR_SOLVER_PREC= JACOBI", 1, false, 500);
+  const auto reference = solve("LINEAR_SOLVER_PREC= CHEBYSHEV", 1, false, 500);
+  const auto degree8 = solve("LINEAR_SOLVER_PREC= CHEBYSHEV\nLINEAR_SOLVER_CHEBYSHEV_DEGREE= 8", 1, false, 500);
+
+  CHECK(std::get<1>(reference) < tol);
+  CHECK(std::get<1>(degree8) < tol);
+  CHECK(std::get<0>(reference) < std::get<0>(jacobi));
+  CHECK(std::get<0>(degree8) < std::get<0>(reference));
+
+  /*--- The polynomial does not depend on the number of threads, only the reductions do (those of FGMRES,
+   *    and those of the Lanczos steps that estimate the spectrum). ---*/
+  for (const int numThreads : {2, 4}) {
+    CAPTURE(numThreads);
+    const auto threaded = solve("LINEAR_SOLVER_PREC= CHEBYSHEV", numThreads, false, 500);
+
+    CHECK(std::get<1>(threaded) < tol);
+    CHECK(std::get<0>(threaded) <= std::get<0>(reference) + 1);
+    CHECK(std::get<0>(threaded) + 1 >= std::get<0>(reference));
+    const auto& x = std::get<2>(threaded);
+    const auto& xRef = std::get<2>(reference);
+    for (auto i = 0ul; i < xRef.GetLocSize(); ++i) {
+      CHECK(x[i] == Approx(xRef[i]).epsilon(100 * tol));
+    }
+  }
+
+  /*--- As a smoother (LINEAR_SOLVER= SMOOTHER) it converges where the Jacobi smoother stagnates. The norm of
+   *    the residual is not monotonic (the matrix is not symmetric), hence the large number of iterations. ---*/
+  const unsigned long nSmooth = 200;
+  const auto jacobiSmoother = solve("LINEAR_SOLVER_PREC= JACOBI", 1, true, nSmooth);
+  const auto chebSmoother = solve("LINEAR_SOLVER_PREC= CHEBYSHEV", 1, true, nSmooth);
+  const auto chebSmoother4 = solve("LINEAR_SOLVER_PREC= CHEBYSHEV", 4, true, nSmooth);
+
+  CHECK(std::get<1>(chebSmoother) < 0.1);
+  CHECK(std::get<1>(jacobiSmoother) > 0.5);
+  CHECK(std::get<1>(chebSmoother4) == Approx(std::get<1>(chebSmoother)).epsilon(1e-6));
+
+  omp_set_num_threads(maxThreads);
+}
+
+TEST_CASE("Batched linelet solves", "[Linear algebra]") {
+  const int maxThreads = omp_get_max_threads();
+  constexpr auto nLane = simd::Array<ScalarType>::Size;
+
+  /*--- A thin box with walls on two adjacent faces. The linelets start at the wall points and grow along the
+   *    short direction, those of the corner region are cut short or turn, which gives a mix of lengths. ---*/
+  auto testCase = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  auto& base = testCase->config_options;
+  auto replace = [&base](const std::string& from, const std::string& to) {
+    base.replace(base.find(from), from.size(), to);
+  };
+  replace("MESH_BOX_SIZE=5,5,5", "MESH_BOX_SIZE=5,9,7");
+  replace("MESH_BOX_LENGTH=1,1,1", "MESH_BOX_LENGTH=1,0.1,1");
+  replace("MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)", "MARKER_HEATFLUX= (y_minus, 0.0, x_plus, 0.0)");
+  replace("MARKER_CUSTOM= ( x_minus, x_plus, z_plus, z_minus)", "MARKER_CUSTOM= ( x_minus, y_plus, z_plus, z_minus)");
+  testCase->AddOption("LINEAR_SOLVER_PREC= LINELET");
+  testCase->InitConfig();
+  testCase->InitGeometry();
+
+  auto* geometry = testCase->geometry.get();
+  const auto* config = testCase->config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto& linelets = geometry->GetLineletInfo(config).linelets;
+
+  /*--- Linelets of different lengths, and (with more than one lane) a batch that is not full. ---*/
+  std::vector<unsigned long> lengths;
+  for (const auto& linelet : linelets) lengths.push_back(linelet.size());
+  std::sort(lengths.begin(), lengths.end());
+  REQUIRE(lengths.size() > 1);
+  REQUIRE(lengths.front() < lengths.back());
+  if (nLane > 1) REQUIRE(linelets.size() % nLane != 0);
+
+  for (const unsigned short nVar : {1, 3}) {
+    for (const int numThreads : {1, 4}) {
+      CAPTURE(nVar, numThreads);
+      omp_set_num_threads(numThreads);
+
+      CSysMatrix<ScalarType> matrix;
+      matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+      FillMatrix(matrix, *geometry, nVar);
+
+      VectorType b(nPoint, nPointDomain, nVar, 0.0), x(nPoint, nPointDomain, nVar, 0.0);
+      for (auto i = 0ul; i < nPointDomain * nVar; ++i) b[i] = 1.0 + 0.1 * (i % 9);
+
+      SU2_OMP_PARALLEL {
+        auto* precond = CPreconditioner<ScalarType>::Create(LINELET, matrix, geometry, config);
+        precond->Build();
+        (*precond)(b, x);
+        delete precond;
+      }
+      END_SU2_OMP_PARALLEL
+
+      /*--- x solves the block-tridiagonal system of each linelet, and the block-diagonal system elsewhere. ---*/
+      std::vector<bool> onLinelet(nPoint, false);
+      std::vector<passivedouble> lhs(nVar);
+
+      auto addProduct = [&](unsigned long iPoint, unsigned long jPoint) {
+        const auto* block = matrix.GetBlock(iPoint, jPoint);
+        REQUIRE(block != nullptr);
+        for (auto iVar = 0u; iVar < nVar; ++iVar)
+          for (auto jVar = 0u; jVar < nVar; ++jVar) lhs[iVar] += block[iVar * nVar + jVar] * x(jPoint, jVar);
+      };
+      auto checkRow = [&](unsigned long iPoint) {
+        CAPTURE(iPoint);
+        for (auto iVar = 0u; iVar < nVar; ++iVar) CHECK(lhs[iVar] == Approx(b(iPoint, iVar)).epsilon(1e-10));
+      };
+
+      for (const auto& linelet : linelets) {
+        for (auto iElem = 0ul; iElem < linelet.size(); ++iElem) {
+          const auto iPoint = linelet[iElem];
+          onLinelet[iPoint] = true;
+          std::fill(lhs.begin(), lhs.end(), 0.0);
+          if (iElem > 0) addProduct(iPoint, linelet[iElem - 1]);
+          addProduct(iPoint, iPoint);
+          if (iElem + 1 < linelet.size()) addProduct(iPoint, linelet[iElem + 1]);
+          checkRow(iPoint);
+        }
+      }
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        if (onLinelet[iPoint]) continue;
+        std::fill(lhs.begin(), lhs.end(), 0.0);
+        addProduct(iPoint, iPoint);
+        checkRow(iPoint);
+      }
+    }
+  }
+  omp_set_num_threads(maxThreads);
+}
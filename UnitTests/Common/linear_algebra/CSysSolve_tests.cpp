@@ -0,0 +1,170 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the Krylov linear solvers.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+
+using ScalarType = su2mixedfloat;
+using VectorType = CSysVector<ScalarType>;
+
+/*--- Non-symmetric tridiagonal operator (convection-diffusion like). ---*/
+class CTestProduct final : public CMatrixVectorProduct<ScalarType> {
+ public:
+  void operator()(const VectorType& u, VectorType& v) const override {
+    const auto n = u.GetLocSize();
+    for (auto i = 0ul; i < n; ++i) {
+      v[i] = 3.0 * u[i];
+      if (i > 0) v[i] -= 1.5 * u[i - 1];
+      if (i + 1 < n) v[i] -= 0.5 * u[i + 1];
+    }
+  }
+};
+
+/*--- Non-symmetric bidiagonal operator with a few small eigenvalues (the first diagonal entries), those
+ * make restarted methods stagnate unless their eigenvectors are kept (recycled) between restarts. ---*/
+class CSmallEigenvaluesProduct final : public CMatrixVectorProduct<ScalarType> {
+ public:
+  void operator()(const VectorType& u, VectorType& v) const override {
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) {
+      v[i] = (i < 3 ? 0.01 * (i + 1) : 1.0 + 0.1 * (i % 10)) * u[i];
+      if (i > 0) v[i] -= 0.1 * u[i - 1];
+    }
+  }
+};
+
+/*--- Variable scaling, to make the method "flexible". ---*/
+class CTestPreconditioner final : public CPreconditioner<ScalarType> {
+ public:
+  void operator()(const VectorType& u, VectorType& v) const override {
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) v[i] = u[i] / (3.0 + 0.01 * (i % 7));
+  }
+};
+
+CConfig* MakeConfig(const std::string& orthogonalization, unsigned long restart = 4, unsigned long recycle = 1) {
+  std::stringstream config_options;
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "LINEAR_SOLVER_RESTART_FREQUENCY= " << restart << std::endl;
+  config_options << "LINEAR_SOLVER_RECYCLE_SIZE= " << recycle << std::endl;
+  config_options << "LINEAR_SOLVER_ORTHOGONALIZATION= " << orthogonalization << std::endl;
+  return new CConfig(config_options, SU2_COMPONENT::SU2_CFD, false);
+}
+
+}  // namespace
+
+TEST_CASE("FGMRES residual history does not depend on the orthogonalization", "[Linear solvers]") {
+  CConfig* mgs = MakeConfig("MGS");
+  CConfig* cgs2 = MakeConfig("CGS2");
+
+  const unsigned long n = 64;
+  VectorType b(n), x(n);
+  for (auto i = 0ul; i < n; ++i) b[i] = 1.0 + 0.1 * (i % 5);
+
+  const CTestProduct mat_vec;
+  const CTestPreconditioner precond;
+  const auto tol = (sizeof(ScalarType) < sizeof(double)) ? 1e-4 : 1e-10;
+
+  CSysSolve<ScalarType> solver;
+
+  for (unsigned long m = 1; m <= 12; ++m) {
+    ScalarType resMGS = 0, resCGS2 = 0;
+
+    x = ScalarType(0);
+    solver.FGMRES_LinSolver(b, x, mat_vec, precond, 0.0, m, resMGS, false, mgs);
+    x = ScalarType(0);
+    solver.FGMRES_LinSolver(b, x, mat_vec, precond, 0.0, m, resCGS2, false, cgs2);
+
+    CHECK(resCGS2 == Approx(resMGS).epsilon(tol));
+  }
+
+  for (unsigned long m = 4; m <= 12; m += 4) {
+    ScalarType resMGS = 0, resCGS2 = 0;
+
+    x = ScalarType(0);
+    solver.RFGMRES_LinSolver(b, x, mat_vec, precond, 0.0, m, resMGS, false, mgs);
+    x = ScalarType(0);
+    solver.RFGMRES_LinSolver(b, x, mat_vec, precond, 0.0, m, resCGS2, false, cgs2);
+
+    CHECK(resCGS2 == Approx(resMGS).epsilon(tol));
+  }
+
+  delete mgs;
+  delete cgs2;
+}
+
+TEST_CASE("GCRO-DR converges with a recycled subspace", "[Linear solvers]") {
+  CConfig* config = MakeConfig("MGS", 8, 3);
+
+  const unsigned long n = 64, maxIter = 500;
+  VectorType b(n), x(n), r(n);
+
+  const CSmallEigenvaluesProduct mat_vec;
+  const CTestPreconditioner precond;
+  const ScalarType tol = (sizeof(ScalarType) < sizeof(double)) ? 1e-4 : 1e-8;
+
+  CSysSolve<ScalarType> solver;
+
+  /*--- Consecutive solves (different rhs) start with the subspace recycled from the previous,
+   * therefore they should need fewer iterations than the first solve, and than restarted
+   * FGMRES (same restart frequency, without recycling). ---*/
+
+  unsigned long firstIter = 0;
+
+  for (int iSolve = 0; iSolve < 3; ++iSolve) {
+    for (auto i = 0ul; i < n; ++i) b[i] = 1.0 + 0.1 * ((i + iSolve) % 5);
+    x = ScalarType(0);
+
+    ScalarType residual = 0;
+    const auto iter = solver.GCRODR_LinSolver(b, x, mat_vec, precond, tol, maxIter, residual, false, config);
+
+    mat_vec(x, r);
+    r -= b;
+
+    CAPTURE(iSolve, iter, firstIter);
+    CHECK(iter < maxIter);
+    CHECK(residual < tol);
+    CHECK(r.norm() < 2 * tol * b.norm());
+
+    if (iSolve == 0) {
+      firstIter = iter;
+      continue;
+    }
+    CHECK(iter < firstIter);
+
+    CSysSolve<ScalarType> restarted;
+    x = ScalarType(0);
+    const auto iterFGMRES =
+        restarted.RFGMRES_LinSolver(b, x, mat_vec, precond, tol, maxIter, residual, false, config);
+    CAPTURE(iterFGMRES);
+    CHECK(iter < iterFGMRES);
+  }
+
+  delete config;
+}
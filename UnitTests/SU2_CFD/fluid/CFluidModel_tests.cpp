@@ -26,9 +26,13 @@
  */
 
 #include "catch.hpp"
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include "../../../SU2_CFD/include/fluid/CFluidModel.hpp"
 #include "../../../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CVanDerWaalsGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
 #include "../../../SU2_CFD/include/fluid/CDataDrivenFluid.hpp"
 
 void FluidModelChecks(CFluidModel* fluid_model, const su2double val_p, const su2double val_T) {
@@ -93,6 +97,39 @@ TEST_CASE("Test case for ideal gas fluid model") {
   delete fluid_model;
 }
 
+void BatchedFluidModelChecks(CFluidModel* fluid_model, const su2double val_p, const su2double val_T) {
+  /*--- The batched evaluation must match the point-wise one, use
+   *    an odd number of points to exercise the vectorization tail. ---*/
+  constexpr unsigned short nPoint = 13;
+
+  CFluidModel::TDStateBatch state;
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    fluid_model->SetTDState_PT(val_p * (1 + 0.01 * i), val_T * (1 + 0.02 * i));
+    state.Density[i] = fluid_model->GetDensity();
+    state.StaticEnergy[i] = fluid_model->GetStaticEnergy();
+  }
+  fluid_model->SetTDStateBatch_rhoe(nPoint, state);
+
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    fluid_model->SetTDState_rhoe(state.Density[i], state.StaticEnergy[i]);
+    CHECK(state.Pressure[i] == Approx(fluid_model->GetPressure()));
+    CHECK(state.Temperature[i] == Approx(fluid_model->GetTemperature()));
+    CHECK(state.SoundSpeed2[i] == Approx(fluid_model->GetSoundSpeed2()));
+    CHECK(state.dPdrho_e[i] == Approx(fluid_model->GetdPdrho_e()));
+    CHECK(state.dPde_rho[i] == Approx(fluid_model->GetdPde_rho()));
+  }
+}
+
+TEST_CASE("Test case for batched evaluation of fluid models") {
+  CIdealGas ideal_gas(1.4, 287.0);
+  CVanDerWaalsGas van_der_waals(1.4, 287.0, 4.0e6, 300.0);
+  CPengRobinson peng_robinson(1.1, 100.0, 4.0e6, 500.0, 0.3);
+
+  BatchedFluidModelChecks(&ideal_gas, 101325, 300.0);
+  BatchedFluidModelChecks(&van_der_waals, 1e6, 600.0);
+  BatchedFluidModelChecks(&peng_robinson, 1e6, 600.0);
+}
+
 TEST_CASE("Test case for data-driven fluid model") {
   std::stringstream config_options;
 
@@ -120,3 +157,82 @@ TEST_CASE("Test case for data-driven fluid model") {
   delete config;
   delete fluid_model;
 }
+
+/*--- Look-up table of ideal gas entropy (and derivatives) as a function of density and energy, on a
+ *    structured grid of triangles, in the format read by CLookUpTable. ---*/
+void WriteIdealGasTable(const std::string& fileName) {
+  constexpr int nx = 9, ny = 9;
+  const su2double cv = 717.5, R = 287.0;
+
+  std::ofstream file(fileName);
+  file << "Dragon library\n\n<Header>\n[Version]\n1.0.1\n\n";
+  file << "[Number of points]\n" << nx * ny << "\n\n";
+  file << "[Number of triangles]\n" << 2 * (nx - 1) * (ny - 1) << "\n\n";
+  file << "[Number of hull points]\n" << 2 * (nx + ny) - 4 << "\n\n";
+  file << "[Number of variables]\n8\n\n[Variable names]\n";
+  file << "Density\nEnergy\ns\ndsde_rho\ndsdrho_e\nd2sde2\nd2sdedrho\nd2sdrho2\n\n</Header>\n\n<Data>\n";
+  file.precision(17);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const su2double rho = 0.5 + 1.5 * i / (nx - 1), e = 1.5e5 + 2e5 * j / (ny - 1);
+      file << rho << " " << e << " " << cv * log(e) - R * log(rho) << " " << cv / e << " " << -R / rho << " "
+           << -cv / (e * e) << " 0 " << R / (rho * rho) << "\n";
+    }
+  }
+  file << "</Data>\n\n<Connectivity>\n";
+  auto id = [&](int i, int j) { return j * nx + i + 1; };
+  for (int j = 0; j < ny - 1; ++j) {
+    for (int i = 0; i < nx - 1; ++i) {
+      file << id(i, j) << " " << id(i + 1, j) << " " << id(i + 1, j + 1) << "\n";
+      file << id(i, j) << " " << id(i + 1, j + 1) << " " << id(i, j + 1) << "\n";
+    }
+  }
+  file << "</Connectivity>\n\n<Hull>\n";
+  for (int i = 0; i < nx; ++i) file << id(i, 0) << "\n";
+  for (int j = 1; j < ny; ++j) file << id(nx - 1, j) << "\n";
+  for (int i = nx - 2; i >= 0; --i) file << id(i, ny - 1) << "\n";
+  for (int j = ny - 2; j > 0; --j) file << id(0, j) << "\n";
+  file << "</Hull>\n";
+}
+
+TEST_CASE("Test case for batched evaluation of data-driven fluid model") {
+  const std::string tableName = "batched_datadriven_fluid.drg";
+  WriteIdealGasTable(tableName);
+
+  std::stringstream config_options;
+  config_options << "SOLVER=EULER" << std::endl;
+  config_options << "FLUID_MODEL=DATADRIVEN_FLUID" << std::endl;
+  config_options << "INTERPOLATION_METHOD=LUT" << std::endl;
+  config_options << "FILENAMES_INTERPOLATOR=(" << tableName << ")" << std::endl;
+  config_options << "CONV_NUM_METHOD_FLOW=JST" << std::endl;
+
+  CConfig* config = new CConfig(config_options, SU2_COMPONENT::SU2_CFD, false);
+  CDataDrivenFluid* fluid_model = new CDataDrivenFluid(config, false);
+
+  /*--- Points inside the table, in different triangles, odd number for the vectorization tail. ---*/
+  constexpr unsigned short nPoint = 13;
+
+  CFluidModel::TDStateBatch state;
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    state.Density[i] = 0.6 + 0.1 * i;
+    state.StaticEnergy[i] = 3.4e5 - 1.45e4 * i;
+  }
+  fluid_model->SetTDStateBatch_rhoe(nPoint, state);
+
+  for (unsigned short i = 0; i < nPoint; ++i) {
+    fluid_model->SetTDState_rhoe(state.Density[i], state.StaticEnergy[i]);
+    CHECK(state.Pressure[i] == Approx(fluid_model->GetPressure()));
+    CHECK(state.Temperature[i] == Approx(fluid_model->GetTemperature()));
+    CHECK(state.SoundSpeed2[i] == Approx(fluid_model->GetSoundSpeed2()));
+    CHECK(state.dPdrho_e[i] == Approx(fluid_model->GetdPdrho_e()));
+    CHECK(state.dPde_rho[i] == Approx(fluid_model->GetdPde_rho()));
+    CHECK(state.Cp[i] == Approx(fluid_model->GetCp()));
+    CHECK(state.Cv[i] == Approx(fluid_model->GetCv()));
+    CHECK(state.Entropy[i] == Approx(fluid_model->GetEntropy()));
+    CHECK(state.Extrapolation[i] == fluid_model->GetExtrapolation());
+  }
+
+  delete config;
+  delete fluid_model;
+  std::remove(tableName.c_str());
+}
@@ -31,6 +31,7 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeLimiters.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -138,9 +139,21 @@ void testGreenGauss() {
 }
 
 template <class TestField>
-void testLeastSquares(bool weighted) {
+void testLeastSquares(bool weighted, bool storeWeights = false) {
   TestField field;
   const auto nDim = field.geometry->GetnDim();
+
+  if (storeWeights) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    stringstream ss(field.configOptions + "STORE_LS_GRADIENT_WEIGHTS= YES\n" +
+                    (weighted ? "NUM_METHOD_GRAD= WEIGHTED_LEAST_SQUARES\n" : "NUM_METHOD_GRAD_RECON= LEAST_SQUARES\n"));
+    CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+    cout.rdbuf(origBuf);
+
+    field.geometry->SetLeastSquaresWeights(&config);
+    REQUIRE(!field.geometry->nodes->GetLeastSquaresWeights(weighted).empty());
+  }
   C3DDoubleMatrix R(field.geometry->GetnPoint(), nDim, nDim);
   C3DDoubleMatrix gradient(field.geometry->GetnPoint(), field.nVar, nDim);
 
@@ -149,8 +162,117 @@ void testLeastSquares(bool weighted) {
   check(field, gradient);
 }
 
+template <class TestField>
+void testGreenGaussLimiter(LIMITER kindLimiter) {
+  TestField field;
+  const auto nPoint = field.geometry->GetnPoint();
+  const auto nDim = field.geometry->GetnDim();
+
+  /*--- Nonlinear field such that the limiters are not trivial. ---*/
+  su2activematrix values(nPoint, field.nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) values(iPoint, 0) = pow(field(iPoint, 0), 3);
+
+  C3DDoubleMatrix gradient(nPoint, field.nVar, nDim), gradientFused(nPoint, field.nVar, nDim);
+  su2activematrix fieldMin(nPoint, field.nVar), fieldMax(nPoint, field.nVar);
+  su2activematrix limiter(nPoint, field.nVar), limiterFused(nPoint, field.nVar);
+
+  computeGradientsGreenGauss(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, *field.geometry.get(),
+                             *field.config.get(), values, 0, field.nVar, -1, gradient);
+  computeLimiters(kindLimiter, nullptr, MPI_QUANTITIES::SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE,
+                  *field.geometry.get(), *field.config.get(), 0, field.nVar, values, gradient, fieldMin, fieldMax,
+                  limiter);
+
+  computeGradientsLimitersGreenGauss(kindLimiter, nullptr, MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER,
+                                     *field.geometry.get(), *field.config.get(), 0, field.nVar, -1, values,
+                                     gradientFused, fieldMin, fieldMax, limiterFused);
+
+  su2double errGrad = 0.0, errLim = 0.0, minLim = 1.0;
+  for (auto iPoint = 0ul; iPoint < field.geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iDim = 0ul; iDim < nDim; ++iDim)
+      errGrad = max(errGrad, abs(gradient(iPoint, 0, iDim) - gradientFused(iPoint, 0, iDim)));
+    errLim = max(errLim, abs(limiter(iPoint, 0) - limiterFused(iPoint, 0)));
+    minLim = min(minLim, limiterFused(iPoint, 0));
+  }
+  CHECK(errGrad == 0.0);
+  CHECK(errLim == 0.0);
+  CHECK(minLim < 1.0);
+}
+
+template <class TestField>
+void testCommOverlap() {
+  TestField field;
+  const auto nPoint = field.geometry->GetnPoint();
+  const auto nDim = field.geometry->GetnDim();
+  auto& geometry = *field.geometry.get();
+  const auto& config = *field.config.get();
+
+  su2activematrix values(nPoint, field.nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) values(iPoint, 0) = pow(field(iPoint, 0), 3);
+
+  su2activematrix fieldMin(nPoint, field.nVar), fieldMax(nPoint, field.nVar);
+  C3DDoubleMatrix R(nPoint, nDim, nDim);
+
+  /*--- Gradients and limiters of each method, computed without (0) and with (1) overlap. ---*/
+  C3DDoubleMatrix gradGG[2], gradLS[2], gradFused[2];
+  su2activematrix limiter[2], limiterFused[2];
+
+  for (int overlap = 0; overlap < 2; ++overlap) {
+    if (overlap) {
+      auto origBuf = cout.rdbuf();
+      cout.rdbuf(nullptr);
+      stringstream ss(field.configOptions + "COMM_OVERLAP= YES\n");
+      CConfig overlapConfig(ss, SU2_COMPONENT::SU2_CFD, false);
+      cout.rdbuf(origBuf);
+
+      geometry.SetCommOverlapPoints(&overlapConfig);
+      REQUIRE(geometry.GetCommOverlap());
+      REQUIRE(!geometry.GetPointsBeforeComms().empty());
+      REQUIRE(!geometry.GetPointsDuringComms().empty());
+    }
+    gradGG[overlap].resize(nPoint, field.nVar, nDim);
+    gradLS[overlap].resize(nPoint, field.nVar, nDim);
+    gradFused[overlap].resize(nPoint, field.nVar, nDim);
+    limiter[overlap].resize(nPoint, field.nVar);
+    limiterFused[overlap].resize(nPoint, field.nVar);
+
+    computeGradientsGreenGauss(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config, values, 0,
+                               field.nVar, -1, gradGG[overlap]);
+    computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config, true, values, 0,
+                                 field.nVar, -1, gradLS[overlap], R);
+    computeLimiters(LIMITER::VENKATAKRISHNAN, nullptr, MPI_QUANTITIES::SOLUTION_LIMITER, PERIODIC_NONE,
+                    PERIODIC_NONE, geometry, config, 0, field.nVar, values, gradGG[overlap], fieldMin, fieldMax,
+                    limiter[overlap]);
+    computeGradientsLimitersGreenGauss(LIMITER::VENKATAKRISHNAN, nullptr, MPI_QUANTITIES::PRIMITIVE_GRAD_REC_LIMITER,
+                                       geometry, config, 0, field.nVar, -1, values, gradFused[overlap], fieldMin,
+                                       fieldMax, limiterFused[overlap]);
+  }
+
+  su2double err = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+      err = max(err, abs(gradGG[0](iPoint, 0, iDim) - gradGG[1](iPoint, 0, iDim)));
+      err = max(err, abs(gradLS[0](iPoint, 0, iDim) - gradLS[1](iPoint, 0, iDim)));
+      err = max(err, abs(gradFused[0](iPoint, 0, iDim) - gradFused[1](iPoint, 0, iDim)));
+    }
+    err = max(err, abs(limiter[0](iPoint, 0) - limiter[1](iPoint, 0)));
+    err = max(err, abs(limiterFused[0](iPoint, 0) - limiterFused[1](iPoint, 0)));
+  }
+  CHECK(err == 0.0);
+}
+
 TEST_CASE("GG", "[Gradients]") { testGreenGauss<LinearFunction>(); }
 
 TEST_CASE("LS", "[Gradients]") { testLeastSquares<LinearFunction>(false); }
 
 TEST_CASE("WLS", "[Gradients]") { testLeastSquares<LinearFunction>(true); }
+
+TEST_CASE("LS stored weights", "[Gradients]") { testLeastSquares<LinearFunction>(false, true); }
+
+TEST_CASE("WLS stored weights", "[Gradients]") { testLeastSquares<LinearFunction>(true, true); }
+
+TEST_CASE("GG fused limiter", "[Gradients]") {
+  testGreenGaussLimiter<LinearFunction>(LIMITER::VENKATAKRISHNAN);
+  testGreenGaussLimiter<LinearFunction>(LIMITER::BARTH_JESPERSEN);
+}
+
+TEST_CASE("Comm overlap", "[Gradients]") { testCommOverlap<LinearFunction>(); }
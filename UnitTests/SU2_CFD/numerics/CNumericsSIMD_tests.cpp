@@ -0,0 +1,663 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Compares the vectorized edge numerics with the scalar CNumerics classes.
+ * \version 8.2.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/fds.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/centered.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_diffusion.hpp"
+#include "../../../SU2_CFD/include/variables/CIncEulerVariable.hpp"
+
+namespace {
+
+/*--- Options shared by all cases, the physics and the schemes are appended by each test. ---*/
+const std::string commonOptions =
+    "MESH_FORMAT= BOX\n"
+    "MESH_BOX_SIZE= 5,5,5\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "INIT_OPTION= TD_CONDITIONS\n"
+    "MACH_NUMBER= 0.5\n"
+    "AOA= 10.0\n"
+    "SIDESLIP_ANGLE= 5.0\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "USE_ACCURATE_FLUX_JACOBIANS= NO\n"
+    "REF_ORIGIN_MOMENT_X= 0.0\n"
+    "REF_ORIGIN_MOMENT_Y= 0.0\n"
+    "REF_ORIGIN_MOMENT_Z= 0.0\n";
+
+const std::string eulerOptions =
+    "SOLVER= EULER\n"
+    "MARKER_EULER= (y_minus, y_plus)\n"
+    "MARKER_CUSTOM= (x_minus, x_plus, z_plus, z_minus)\n";
+
+/*!
+ * \brief Builds the geometry and the solvers of the unit box for a set of options.
+ */
+std::unique_ptr<UnitQuadTestCase> MakeSolverCase(const std::string& options) {
+  auto testCase = std::make_unique<UnitQuadTestCase>();
+  testCase->config_options = commonOptions + options;
+  testCase->InitConfig();
+  testCase->InitGeometry();
+  testCase->InitSolver();
+  return testCase;
+}
+
+/*!
+ * \brief Smooth point-wise perturbation of the initial solution, so that no edge has equal states.
+ * \param[in] amplitude - Size of the perturbation of each conservative variable.
+ */
+void PerturbSolution(const CGeometry& geometry, CSolver& solver, const std::vector<su2double>& amplitude) {
+  auto* nodes = solver.GetNodes();
+  const auto nVar = solver.GetnVar();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const auto global = static_cast<su2double>(geometry.nodes->GetGlobalIndex(iPoint));
+    std::vector<su2double> solution(nVar);
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      const su2double wave = sin(0.37 * global + 1.1 * iVar) * cos(0.23 * global - 0.5 * iVar);
+      solution[iVar] = nodes->GetSolution(iPoint, iVar) + amplitude[iVar] * wave;
+    }
+    nodes->SetSolution(iPoint, solution.data());
+  }
+}
+
+/*!
+ * \brief Amplitudes for the conservative variables of the compressible solvers.
+ */
+std::vector<su2double> CompressibleAmplitude(const CGeometry& geometry, CSolver& solver) {
+  const auto* U = solver.GetNodes()->GetSolution(0);
+  const auto nDim = geometry.GetnDim();
+  const su2double momentum = GeometryToolbox::Norm(nDim, U + 1);
+
+  std::vector<su2double> amplitude(solver.GetnVar(), 0.2 * momentum);
+  amplitude[0] = 0.1 * U[0];
+  amplitude[nDim + 1] = 0.05 * U[nDim + 1];
+  return amplitude;
+}
+
+/*!
+ * \brief Amplitudes for the primitive solution (pressure, velocity, temperature) of the incompressible solvers.
+ */
+std::vector<su2double> IncompressibleAmplitude(const CGeometry& geometry, CSolver& solver) {
+  std::vector<su2double> amplitude(solver.GetnVar(), 0.3);
+  amplitude[geometry.GetnDim() + 1] = 10.0;
+  return amplitude;
+}
+
+/*!
+ * \brief Updates the primitives, gradients and limiters, and clears the linear system.
+ */
+void PreprocessFlow(UnitQuadTestCase& testCase) {
+  SU2_OMP_PARALLEL {
+    testCase.solver[FLOW_SOL]->Preprocessing(testCase.geometry.get(), testCase.solver, testCase.config.get(), MESH_0,
+                                             0, RUNTIME_FLOW_SYS, false);
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+/*!
+ * \brief Copy of the residual and of the Jacobian blocks of the domain points.
+ */
+struct LinearSystemValues {
+  std::vector<passivedouble> residual, jacobian;
+};
+
+LinearSystemValues CaptureLinearSystem(const CGeometry& geometry, const CSolver& solver, bool withJacobian = true) {
+  LinearSystemValues values;
+  const auto nVar = solver.GetnVar();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      values.residual.push_back(SU2_TYPE::GetValue(solver.LinSysRes(iPoint, iVar)));
+
+    if (!withJacobian) continue;
+
+    auto appendBlock = [&](unsigned long jPoint) {
+      const auto* block = solver.Jacobian.GetBlock(iPoint, jPoint);
+      for (auto k = 0u; k < nVar * nVar; ++k) values.jacobian.push_back(SU2_TYPE::GetValue(block[k]));
+    };
+    appendBlock(iPoint);
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) appendBlock(jPoint);
+  }
+  return values;
+}
+
+/*!
+ * \brief Checks the entries of two vectors with a tolerance relative to the largest reference value.
+ */
+void CheckClose(const std::vector<passivedouble>& values, const std::vector<passivedouble>& reference,
+                passivedouble tol) {
+  REQUIRE(values.size() == reference.size());
+  passivedouble scale = 0;
+  for (const auto x : reference) scale = std::max(scale, std::abs(x));
+  REQUIRE(scale > 0);
+
+  unsigned long mismatches = 0;
+  for (auto i = 0ul; i < values.size(); ++i) {
+    if (std::abs(values[i] - reference[i]) > tol * scale) {
+      if (mismatches == 0) CHECK(values[i] == Approx(reference[i]).margin(tol * scale));
+      ++mismatches;
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+/*!
+ * \brief First order flux loop of the flow solver over all edges, with a scalar numerics object.
+ */
+void ScalarUpwindResidual(UnitQuadTestCase& testCase, CNumerics& numerics) {
+  auto& geometry = *testCase.geometry;
+  auto& solver = *testCase.solver[FLOW_SOL];
+  auto* nodes = solver.GetNodes();
+
+  solver.LinSysRes.SetValZero();
+  solver.Jacobian.SetValZero();
+
+  for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry.edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry.edges->GetNode(iEdge, 1);
+
+    numerics.SetNormal(geometry.edges->GetNormal(iEdge));
+    numerics.SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+    numerics.SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(jPoint));
+
+    auto residual = numerics.ComputeResidual(testCase.config.get());
+
+    solver.LinSysRes.AddBlock(iPoint, residual);
+    solver.LinSysRes.SubtractBlock(jPoint, residual);
+    solver.Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+}
+
+using NumericsFactory = std::function<CNumerics*(unsigned short nDim, unsigned short nVar, const CConfig* config)>;
+
+/*!
+ * \brief Runs the (vectorized) Upwind_Residual of the flow solver and the scalar loop with the
+ *        numerics from "factory" on the same perturbed state, and compares the linear systems.
+ */
+void CompareUpwindWithScalar(const std::string& scheme, const NumericsFactory& factory) {
+  auto testCase = MakeSolverCase(eulerOptions + "CONV_NUM_METHOD_FLOW= " + scheme + "\nMUSCL_FLOW= NO\n");
+  auto& geometry = *testCase->geometry;
+  auto& solver = *testCase->solver[FLOW_SOL];
+
+  PerturbSolution(geometry, solver, CompressibleAmplitude(geometry, solver));
+  PreprocessFlow(*testCase);
+
+  SU2_OMP_PARALLEL {
+    solver.Upwind_Residual(&geometry, testCase->solver, nullptr, testCase->config.get(), MESH_0);
+  }
+  END_SU2_OMP_PARALLEL
+  const auto vectorized = CaptureLinearSystem(geometry, solver);
+
+  std::unique_ptr<CNumerics> numerics(factory(geometry.GetnDim(), solver.GetnVar(), testCase->config.get()));
+  ScalarUpwindResidual(*testCase, *numerics);
+  const auto scalar = CaptureLinearSystem(geometry, solver);
+
+  CheckClose(vectorized.residual, scalar.residual, 1e-12);
+  CheckClose(vectorized.jacobian, scalar.jacobian, 1e-10);
+}
+
+/*!
+ * \brief Numerics container with one object per thread for each term, as built by the driver.
+ */
+struct NumericsContainer {
+  std::vector<std::unique_ptr<CNumerics>> objects;
+  std::vector<CNumerics*> container;
+
+  NumericsContainer(const std::vector<std::pair<unsigned short, NumericsFactory>>& terms, unsigned short nDim,
+                    unsigned short nVar, const CConfig* config)
+      : container(MAX_TERMS * omp_get_max_threads(), nullptr) {
+    for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread) {
+      for (const auto& term : terms) {
+        objects.emplace_back(term.second(nDim, nVar, config));
+        container[term.first + iThread * MAX_TERMS] = objects.back().get();
+      }
+    }
+  }
+};
+
+using AmplitudeFunction = std::function<std::vector<su2double>(const CGeometry&, CSolver&)>;
+
+/*!
+ * \brief Convective (and viscous) residual of the flow solver on the perturbed state, with the scalar
+ *        numerics from "terms" when the solver does not use vectorization.
+ */
+LinearSystemValues FlowEdgeResidual(const std::string& options,
+                                    const std::vector<std::pair<unsigned short, NumericsFactory>>& terms,
+                                    const AmplitudeFunction& amplitude = CompressibleAmplitude) {
+  auto testCase = MakeSolverCase(options);
+  auto& geometry = *testCase->geometry;
+  auto& solver = *testCase->solver[FLOW_SOL];
+  auto* config = testCase->config.get();
+
+  PerturbSolution(geometry, solver, amplitude(geometry, solver));
+  PreprocessFlow(*testCase);
+
+  NumericsContainer numerics(terms, geometry.GetnDim(), solver.GetnVar(), config);
+  const bool centered = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
+
+  SU2_OMP_PARALLEL {
+    if (centered) {
+      solver.Centered_Residual(&geometry, testCase->solver, numerics.container.data(), config, MESH_0, 0);
+    } else {
+      solver.Upwind_Residual(&geometry, testCase->solver, numerics.container.data(), config, MESH_0);
+    }
+  }
+  END_SU2_OMP_PARALLEL
+  return CaptureLinearSystem(geometry, solver);
+}
+
+/*!
+ * \brief Amplitudes proportional to the initial (free-stream) value of each variable.
+ */
+std::vector<su2double> RelativeAmplitude(const CGeometry&, CSolver& solver) {
+  const auto* U = solver.GetNodes()->GetSolution(0);
+  std::vector<su2double> amplitude(solver.GetnVar());
+  for (auto iVar = 0u; iVar < solver.GetnVar(); ++iVar) amplitude[iVar] = 0.3 * fabs(U[iVar]);
+  return amplitude;
+}
+
+/*!
+ * \brief Builds a case with a scalar solver and preprocesses it on the perturbed flow and scalar states.
+ */
+std::unique_ptr<UnitQuadTestCase> MakeScalarCase(const std::string& options, unsigned short iSol,
+                                                 const AmplitudeFunction& flowAmplitude) {
+  auto testCase = MakeSolverCase(options);
+  auto& geometry = *testCase->geometry;
+  auto* config = testCase->config.get();
+  auto** solvers = testCase->solver;
+  auto& solver = *solvers[iSol];
+
+  /*--- Distance to the walls at y = 0 and y = 1, kept away from 0. ---*/
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const su2double y = geometry.nodes->GetCoord(iPoint, 1);
+    geometry.nodes->SetWall_Distance(iPoint, 0.05 + fmin(y, 1 - y));
+  }
+
+  PerturbSolution(geometry, *solvers[FLOW_SOL], flowAmplitude(geometry, *solvers[FLOW_SOL]));
+  PerturbSolution(geometry, solver, RelativeAmplitude(geometry, solver));
+  PreprocessFlow(*testCase);
+
+  const auto runTime = (iSol == TURB_SOL) ? RUNTIME_TURB_SYS : RUNTIME_SPECIES_SYS;
+  SU2_OMP_PARALLEL {
+    solver.Preprocessing(&geometry, solvers, config, MESH_0, 0, runTime, false);
+    if (iSol == TURB_SOL) solver.Postprocessing(&geometry, solvers, config, MESH_0);
+  }
+  END_SU2_OMP_PARALLEL
+  return testCase;
+}
+
+/*!
+ * \brief Convective and diffusive residual of a scalar transport solver on the perturbed state, with the
+ *        scalar numerics from "terms" when the solver does not use vectorization.
+ */
+LinearSystemValues ScalarEdgeResidual(const std::string& options, unsigned short iSol,
+                                      const std::vector<std::pair<unsigned short, NumericsFactory>>& terms,
+                                      const AmplitudeFunction& flowAmplitude) {
+  auto testCase = MakeScalarCase(options, iSol, flowAmplitude);
+  auto& geometry = *testCase->geometry;
+  auto& solver = *testCase->solver[iSol];
+
+  NumericsContainer numerics(terms, geometry.GetnDim(), solver.GetnVar(), testCase->config.get());
+
+  SU2_OMP_PARALLEL {
+    solver.Upwind_Residual(&geometry, testCase->solver, numerics.container.data(), testCase->config.get(), MESH_0);
+  }
+  END_SU2_OMP_PARALLEL
+  return CaptureLinearSystem(geometry, solver);
+}
+
+/*!
+ * \brief Source residual of the turbulence solver on the perturbed state, with the scalar numerics
+ *        from "factory" when the solver does not use vectorization.
+ */
+LinearSystemValues TurbSourceResidual(const std::string& options, const NumericsFactory& factory) {
+  auto testCase = MakeScalarCase(options, TURB_SOL, CompressibleAmplitude);
+  auto& geometry = *testCase->geometry;
+  auto& solver = *testCase->solver[TURB_SOL];
+
+  NumericsContainer numerics({{SOURCE_FIRST_TERM, factory}}, geometry.GetnDim(), solver.GetnVar(),
+                             testCase->config.get());
+
+  SU2_OMP_PARALLEL {
+    solver.Source_Residual(&geometry, testCase->solver, numerics.container.data(), testCase->config.get(), MESH_0);
+  }
+  END_SU2_OMP_PARALLEL
+  return CaptureLinearSystem(geometry, solver);
+}
+
+}  // namespace
+
+TEST_CASE("Vectorized HLLC and AUSM/SLAU schemes match the scalar numerics", "[Numerics SIMD]") {
+  SECTION("HLLC") {
+    CompareUpwindWithScalar("HLLC", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwHLLC_Flow(nDim, nVar, config);
+    });
+  }
+  SECTION("AUSM") {
+    CompareUpwindWithScalar("AUSM", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwAUSM_Flow(nDim, nVar, config);
+    });
+  }
+  SECTION("AUSM+up") {
+    CompareUpwindWithScalar("AUSMPLUSUP", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwAUSMPLUSUP_Flow(nDim, nVar, config);
+    });
+  }
+  SECTION("AUSM+up2") {
+    CompareUpwindWithScalar("AUSMPLUSUP2", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config);
+    });
+  }
+  SECTION("SLAU") {
+    CompareUpwindWithScalar("SLAU", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSLAU_Flow(nDim, nVar, config, false);
+    });
+  }
+  SECTION("SLAU2") {
+    CompareUpwindWithScalar("SLAU2", [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSLAU2_Flow(nDim, nVar, config, false);
+    });
+  }
+}
+
+TEST_CASE("Vectorized Roe and HLLC schemes for non-ideal gases", "[Numerics SIMD]") {
+  /*--- First order, with MUSCL the vectorized schemes linearize the equation of state. ---*/
+  const std::string options = eulerOptions +
+                              "FLUID_MODEL= PR_GAS\n"
+                              "MUSCL_FLOW= NO\n";
+
+  SECTION("Roe") {
+    const NumericsFactory factory = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwGeneralRoe_Flow(nDim, nVar, config);
+    };
+    const auto scheme = options + "CONV_NUM_METHOD_FLOW= ROE\n";
+    const auto vectorized = FlowEdgeResidual(scheme + "USE_VECTORIZATION= YES\n", {{CONV_TERM, factory}});
+    const auto scalar = FlowEdgeResidual(scheme + "USE_VECTORIZATION= NO\n", {{CONV_TERM, factory}});
+
+    CheckClose(vectorized.residual, scalar.residual, 1e-12);
+    CheckClose(vectorized.jacobian, scalar.jacobian, 1e-10);
+  }
+  SECTION("HLLC") {
+    const NumericsFactory factory = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwGeneralHLLC_Flow(nDim, nVar, config);
+    };
+    const auto scheme = options + "CONV_NUM_METHOD_FLOW= HLLC\n";
+    const auto vectorized = FlowEdgeResidual(scheme + "USE_VECTORIZATION= YES\n", {{CONV_TERM, factory}});
+    const auto scalar = FlowEdgeResidual(scheme + "USE_VECTORIZATION= NO\n", {{CONV_TERM, factory}});
+
+    /*--- The scalar Jacobian has the opposite sign of the kinetic term in dP/drho. ---*/
+    CheckClose(vectorized.residual, scalar.residual, 1e-12);
+  }
+}
+
+TEST_CASE("Limiter exchange overlapped with the vectorized edge loop", "[Numerics SIMD][MPI]") {
+  /*--- The first residual evaluation creates the vectorized numerics, from the second one the exchange
+   *    of the limiters is completed inside the edge loop. ---*/
+  auto residual = [](bool overlap, std::vector<passivedouble>& limiters) {
+    auto testCase = MakeSolverCase(eulerOptions +
+                                   "CONV_NUM_METHOD_FLOW= ROE\n"
+                                   "MUSCL_FLOW= YES\n"
+                                   "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+                                   "COMM_OVERLAP= " + std::string(overlap ? "YES" : "NO") + "\n");
+    auto& geometry = *testCase->geometry;
+    auto& solver = *testCase->solver[FLOW_SOL];
+    auto* config = testCase->config.get();
+
+    PerturbSolution(geometry, solver, CompressibleAmplitude(geometry, solver));
+
+    for (int iter = 0; iter < 2; ++iter) {
+      PreprocessFlow(*testCase);
+      CHECK(solver.GetDeferredCommsPending() == (overlap && iter > 0));
+
+      SU2_OMP_PARALLEL {
+        solver.Upwind_Residual(&geometry, testCase->solver, nullptr, config, MESH_0);
+      }
+      END_SU2_OMP_PARALLEL
+      CHECK(!solver.GetDeferredCommsPending());
+    }
+
+    const auto& limiter = solver.GetNodes()->GetLimiter_Primitive();
+    limiters.clear();
+    for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < limiter.cols(); ++iVar) limiters.push_back(SU2_TYPE::GetValue(limiter(iPoint, iVar)));
+
+    return CaptureLinearSystem(geometry, solver);
+  };
+
+  std::vector<passivedouble> limiters, limitersOverlap;
+  const auto reference = residual(false, limiters);
+  const auto overlapped = residual(true, limitersOverlap);
+
+  /*--- The halo limiters arrive intact, only the order of the edge contributions differs. ---*/
+  CHECK(limitersOverlap == limiters);
+  CheckClose(overlapped.residual, reference.residual, 1e-12);
+  CheckClose(overlapped.jacobian, reference.jacobian, 1e-12);
+}
+
+TEST_CASE("Vectorized incompressible schemes match the scalar numerics", "[Numerics SIMD]") {
+  const std::string eulerInc =
+      "SOLVER= INC_EULER\n"
+      "MARKER_EULER= (y_minus, y_plus)\n"
+      "MARKER_CUSTOM= (x_minus, x_plus, z_plus, z_minus)\n";
+  const std::string navierStokesInc =
+      "SOLVER= INC_NAVIER_STOKES\n"
+      "INC_ENERGY_EQUATION= YES\n"
+      "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+      "MU_CONSTANT= 0.01\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_CUSTOM= (x_minus, x_plus, z_plus, z_minus)\n";
+
+  const NumericsFactory fds = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+    return new CUpwFDSInc_Flow(nDim, nVar, config);
+  };
+  const NumericsFactory jst = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+    return new CCentJSTInc_Flow(nDim, nVar, config);
+  };
+  const NumericsFactory lax = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+    return new CCentLaxInc_Flow(nDim, nVar, config);
+  };
+  const NumericsFactory viscous = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+    return new CAvgGradInc_Flow(nDim, nVar, true, config);
+  };
+
+  auto compare = [](const std::string& options, const std::vector<std::pair<unsigned short, NumericsFactory>>& terms) {
+    const auto vectorized = FlowEdgeResidual(options + "USE_VECTORIZATION= YES\n", terms, IncompressibleAmplitude);
+    const auto scalar = FlowEdgeResidual(options + "USE_VECTORIZATION= NO\n", terms, IncompressibleAmplitude);
+
+    CheckClose(vectorized.residual, scalar.residual, 1e-12);
+    CheckClose(vectorized.jacobian, scalar.jacobian, 1e-10);
+  };
+
+  SECTION("FDS") {
+    compare(eulerInc + "CONV_NUM_METHOD_FLOW= FDS\nMUSCL_FLOW= NO\n", {{CONV_TERM, fds}});
+  }
+  SECTION("FDS with MUSCL") {
+    compare(eulerInc + "CONV_NUM_METHOD_FLOW= FDS\nMUSCL_FLOW= YES\nSLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n",
+            {{CONV_TERM, fds}});
+  }
+  SECTION("JST") {
+    compare(eulerInc + "CONV_NUM_METHOD_FLOW= JST\n", {{CONV_TERM, jst}});
+  }
+  SECTION("LAX") {
+    compare(eulerInc + "CONV_NUM_METHOD_FLOW= LAX-FRIEDRICH\n", {{CONV_TERM, lax}});
+  }
+  SECTION("FDS and viscous decorator") {
+    compare(navierStokesInc + "CONV_NUM_METHOD_FLOW= FDS\nMUSCL_FLOW= NO\n", {{CONV_TERM, fds}, {VISC_TERM, viscous}});
+  }
+  SECTION("JST and viscous decorator") {
+    compare(navierStokesInc + "CONV_NUM_METHOD_FLOW= JST\n", {{CONV_TERM, jst}, {VISC_TERM, viscous}});
+  }
+}
+
+TEST_CASE("Vectorized scalar transport fluxes match the scalar numerics", "[Numerics SIMD]") {
+  using Indices = CEulerVariable::CIndices<unsigned short>;
+  using IncIndices = CIncEulerVariable::CIndices<unsigned short>;
+
+  const std::string walls =
+      "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+      "MU_CONSTANT= 0.01\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_CUSTOM= (x_minus, x_plus, z_plus, z_minus)\n";
+  const std::string rans = walls +
+                           "SOLVER= RANS\n"
+                           "CONV_NUM_METHOD_FLOW= ROE\n"
+                           "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n";
+  const std::string incRans = walls +
+                              "SOLVER= INC_RANS\n"
+                              "CONV_NUM_METHOD_FLOW= FDS\n"
+                              "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n";
+
+  auto compare = [](const std::string& options, unsigned short iSol,
+                    const std::vector<std::pair<unsigned short, NumericsFactory>>& terms,
+                    const AmplitudeFunction& flowAmplitude) {
+    const auto vectorized = ScalarEdgeResidual(options + "USE_VECTORIZATION= YES\n", iSol, terms, flowAmplitude);
+    const auto scalar = ScalarEdgeResidual(options + "USE_VECTORIZATION= NO\n", iSol, terms, flowAmplitude);
+
+    CheckClose(vectorized.residual, scalar.residual, 1e-12);
+    CheckClose(vectorized.jacobian, scalar.jacobian, 1e-10);
+  };
+
+  SECTION("SA") {
+    const NumericsFactory convection = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSca_TurbSA<Indices>(nDim, nVar, config);
+    };
+    const NumericsFactory diffusion = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config);
+    };
+    compare(rans + "KIND_TURB_MODEL= SA\nMUSCL_TURB= NO\n", TURB_SOL, {{CONV_TERM, convection}, {VISC_TERM, diffusion}},
+            CompressibleAmplitude);
+    compare(rans + "KIND_TURB_MODEL= SA\nMUSCL_TURB= YES\nSLOPE_LIMITER_TURB= VENKATAKRISHNAN\n", TURB_SOL,
+            {{CONV_TERM, convection}, {VISC_TERM, diffusion}}, CompressibleAmplitude);
+  }
+  SECTION("SA-neg, incompressible") {
+    const NumericsFactory convection = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSca_TurbSA<IncIndices>(nDim, nVar, config);
+    };
+    const NumericsFactory diffusion = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CAvgGrad_TurbSA_Neg<IncIndices>(nDim, nVar, true, config);
+    };
+    compare(incRans + "KIND_TURB_MODEL= SA\nSA_OPTIONS= NEGATIVE, WITHFT2\nMUSCL_TURB= NO\n", TURB_SOL,
+            {{CONV_TERM, convection}, {VISC_TERM, diffusion}}, IncompressibleAmplitude);
+  }
+  SECTION("SST") {
+    const NumericsFactory convection = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSca_TurbSST<Indices>(nDim, nVar, config);
+    };
+    /*--- The model constants are owned by the solver, any instance gives the same values. ---*/
+    const std::string options = rans + "KIND_TURB_MODEL= SST\nMUSCL_TURB= NO\n";
+    const auto sstCase = MakeSolverCase(options);
+    const auto* constants = sstCase->solver[TURB_SOL]->GetConstants();
+    const NumericsFactory diffusion = [constants](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CAvgGrad_TurbSST<Indices>(nDim, nVar, constants, true, config);
+    };
+    compare(options, TURB_SOL, {{CONV_TERM, convection}, {VISC_TERM, diffusion}}, CompressibleAmplitude);
+  }
+  SECTION("Species") {
+    const NumericsFactory convection = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CUpwSca_Species<IncIndices>(nDim, nVar, config);
+    };
+    const NumericsFactory diffusion = [](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+      return new CAvgGrad_Species<IncIndices>(nDim, nVar, true, config);
+    };
+    const std::string species = walls +
+                                "SOLVER= INC_NAVIER_STOKES\n"
+                                "CONV_NUM_METHOD_FLOW= FDS\n"
+                                "KIND_SCALAR_MODEL= SPECIES_TRANSPORT\n"
+                                "DIFFUSIVITY_MODEL= CONSTANT_DIFFUSIVITY\n"
+                                "DIFFUSIVITY_CONSTANT= 0.001\n"
+                                "CONV_NUM_METHOD_SPECIES= SCALAR_UPWIND\n"
+                                "SPECIES_INIT= 0.6, 0.3\n";
+    compare(species + "MUSCL_SPECIES= NO\n", SPECIES_SOL, {{CONV_TERM, convection}, {VISC_TERM, diffusion}},
+            IncompressibleAmplitude);
+    compare(species + "MUSCL_SPECIES= YES\nSLOPE_LIMITER_SPECIES= NONE\n", SPECIES_SOL,
+            {{CONV_TERM, convection}, {VISC_TERM, diffusion}}, IncompressibleAmplitude);
+  }
+}
+
+TEST_CASE("Vectorized turbulence source terms match the scalar numerics", "[Numerics SIMD]") {
+  using Indices = CEulerVariable::CIndices<unsigned short>;
+
+  const std::string rans =
+      "SOLVER= RANS\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+      "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+      "MU_CONSTANT= 0.01\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_CUSTOM= (x_minus, x_plus, z_plus, z_minus)\n";
+
+  auto compare = [](const std::string& options, const NumericsFactory& factory) {
+    const auto vectorized = TurbSourceResidual(options + "USE_VECTORIZATION= YES\n", factory);
+    const auto scalar = TurbSourceResidual(options + "USE_VECTORIZATION= NO\n", factory);
+
+    CheckClose(vectorized.residual, scalar.residual, 1e-12);
+    CheckClose(vectorized.jacobian, scalar.jacobian, 1e-10);
+  };
+
+  SECTION("SA") {
+    const NumericsFactory factory = [](unsigned short nDim, unsigned short, const CConfig* config) {
+      return SAFactory<Indices>(nDim, config);
+    };
+    for (const std::string saOptions : {"NONE", "NEGATIVE, WITHFT2", "EDWARDS", "COMPRESSIBILITY, ROTATION"}) {
+      CAPTURE(saOptions);
+      compare(rans + "KIND_TURB_MODEL= SA\nSA_OPTIONS= " + saOptions + "\n", factory);
+    }
+  }
+  SECTION("SST") {
+    for (const std::string sstOptions : {"V2003m", "V1994m", "V2003m, KATO-LAUNDER, SUSTAINING",
+                                         "V2003m, VORTICITY, COMPRESSIBILITY-SARKAR"}) {
+      CAPTURE(sstOptions);
+      const auto options = rans + "KIND_TURB_MODEL= SST\nSST_OPTIONS= " + sstOptions + "\n";
+
+      /*--- The model constants and free-stream values come from the solver, they do not depend on the state. ---*/
+      const auto sstCase = MakeSolverCase(options);
+      const auto* sst = sstCase->solver[TURB_SOL];
+      const auto* constants = sst->GetConstants();
+      const su2double kineInf = sst->GetTke_Inf(), omegaInf = sst->GetOmega_Inf();
+
+      const NumericsFactory factory = [=](unsigned short nDim, unsigned short nVar, const CConfig* config) {
+        return new CSourcePieceWise_TurbSST<Indices>(nDim, nVar, constants, kineInf, omegaInf, config);
+      };
+      compare(options, factory);
+    }
+  }
+}
@@ -87,6 +87,8 @@ struct UnitQuadTestCase {
     cout.rdbuf(nullptr);
     {
       auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      /*--- Partition the mesh when the tests run on multiple ranks. ---*/
+      aux_geometry->SetColorGrid_Parallel(config.get());
       geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
     }
     geometry->SetSendReceive(config.get());
@@ -111,7 +113,9 @@ struct UnitQuadTestCase {
    * \brief Desctructor
    */
   ~UnitQuadTestCase() {
-    if (solver != nullptr) delete solver[FLOW_SOL];
+    if (solver != nullptr) {
+      for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) delete solver[iSol];
+    }
     delete[] solver;
   }
 };